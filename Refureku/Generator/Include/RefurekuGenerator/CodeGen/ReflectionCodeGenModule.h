@@ -10,7 +10,9 @@
 #include <string>
 #include <functional>	//std::hash
 #include <unordered_map>
-#include <algorithm>	//std::all_of
+#include <algorithm>	//std::all_of, std::stable_sort
+#include <vector>
+#include <limits>		//std::numeric_limits
 
 #include <Kodgen/CodeGen/Macro/MacroCodeGenModule.h>
 #include "Kodgen/InfoStructures/EnumInfo.h"
@@ -18,6 +20,7 @@
 
 #include "RefurekuGenerator/Properties/InstantiatorPropertyCodeGen.h"
 #include "RefurekuGenerator/Properties/PropertySettingsPropertyCodeGen.h"
+#include "RefurekuGenerator/Misc/Helpers.h"
 
 namespace rfk
 {
@@ -39,6 +42,9 @@ namespace rfk
 			/** Flag that determines whether the currently generated code is hidden from the parser or not. */
 			bool										_isGeneratingHiddenCode;
 
+			/** Flag that determines whether the metadata arena of the generated source file has been defined or not. */
+			bool										_isMetadataArenaDefined;
+
 			/**
 			*	@brief Compute the unique id of an entity. The returned string contains an unsigned integer.
 			*
@@ -48,6 +54,27 @@ namespace rfk
 			*/
 			inline static std::string		getEntityId(kodgen::EntityInfo const& entity)										noexcept;
 
+			/**
+			*	@brief Get a C++ literal evaluating to the provided int64 value, including INT64_MIN.
+			*
+			*	@param value Value to write.
+			*
+			*	@return The literal as a string.
+			*/
+			static std::string				getInt64Literal(kodgen::int64 value)												noexcept;
+
+			/**
+			*	@brief	Compute a 2 levels perfect hash of enum value names: a name is first dispatched to a bucket with
+			*			Helpers::hashEnumName(name, 0), then to a slot with Helpers::hashEnumName(name, bucketSeed).
+			*
+			*	@param names			Distinct names to hash.
+			*	@param out_bucketSeeds	Seed of each bucket. The number of buckets is a power of 2.
+			*	@param out_slots		Index in names of the name stored in each slot, names.size() for unused slots. The number of slots is a power of 2.
+			*/
+			static void						computeEnumNamesPerfectHash(std::vector<std::string> const&	names,
+																		std::vector<kodgen::uint64>&		out_bucketSeeds,
+																		std::vector<std::size_t>&			out_slots)	noexcept;
+
 			/**
 			*	@brief Convert the name of a kodgen::EEntityType to its equivalent rfk::EEntityKind name.
 			* 
@@ -136,6 +163,15 @@ namespace rfk
 			static std::string			computeNamespaceFragmentRegistererName(kodgen::NamespaceInfo const&	namespace_,
 																			   fs::path const&				sourceFile)		noexcept;
 
+			/**
+			*	@brief Compute the name of the getMetadataArena function for the given source file.
+			* 
+			*	@param sourceFile The path to the parsed file.
+			* 
+			*	@return The name of the getMetadataArena function for the target file.
+			*/
+			static std::string			computeGetMetadataArenaFunctionName(fs::path const& sourceFile)						noexcept;
+
 			/**
 			*	@brief Compute the name of the generated variable for the provided property.
 			* 
@@ -282,6 +318,19 @@ namespace rfk
 												   kodgen::MacroCodeGenEnv&		env,
 												   std::string&					inout_result)							noexcept;
 
+			/**
+			*	@brief Generate code for setting the memory alignment and layout/lifetime traits of a struct or class.
+			* 
+			*	@param structClass				Target struct/class.
+			*	@param env						Code generation environment.
+			*	@param generatedClassVarName	Name of the variable holding the class metadata in the generated code.
+			*	@param inout_result				String to append the generated code.
+			*/
+			void	fillClassLayoutTraits(kodgen::StructClassInfo const&	structClass,
+										  kodgen::MacroCodeGenEnv&			env,
+										  std::string const&				generatedClassVarName,
+										  std::string&						inout_result)						const	noexcept;
+
 			/**
 			*	@brief Generate code for registering the default constructor of a struct or class.
 			* 
@@ -463,6 +512,18 @@ namespace rfk
 														kodgen::MacroCodeGenEnv&	env,
 														std::string&				inout_result)			noexcept;
 
+			/**
+			*	@brief	Define the rfk::EnumTable specialization of an enum, holding its sorted values, its names
+			*			and a perfect hash of its names used by rfk::enumToString and rfk::stringToEnum.
+			*
+			*	@param enum_		Enum to generate the table for.
+			*	@param env			Code generation environment.
+			*	@param inout_result	String to append the generated code.
+			*/
+			void	defineEnumTableTemplateSpecialization(kodgen::EnumInfo const&	enum_,
+														  kodgen::MacroCodeGenEnv&	env,
+														  std::string&				inout_result)	const	noexcept;
+
 			/**
 			*	@brief	Define the content of a get enum method from the { to the }.
 			*			Does not include the method prototype.
@@ -568,6 +629,38 @@ namespace rfk
 																			   kodgen::MacroCodeGenEnv&		env,
 																			   std::string&					inout_result)	noexcept;
 
+			/**
+			*	@brief	Declare and define the function returning the metadata arena of the generated source file.
+			*			The arena reserves memory for all the entities defined in the source file.
+			*			No code is generated if the file doesn't define any non-template entity.
+			*
+			*	@param env			Code generation environment.
+			*	@param inout_result	String to append the generated code.
+			*/
+			void	declareAndDefineGetMetadataArenaFunction(kodgen::MacroCodeGenEnv&	env,
+															 std::string&				inout_result)						noexcept;
+
+			/**
+			*	@brief	Open a scope allocating the metadata of an entity from the source file metadata arena.
+			*			Must be generated before the entity static variable, and closed at the end of the entity initialization.
+			*			No code is generated if the metadata arena is not defined.
+			*
+			*	@param env			Code generation environment.
+			*	@param inout_result	String to append the generated code.
+			*/
+			void	openMetadataArenaScope(kodgen::MacroCodeGenEnv&	env,
+										   std::string&				inout_result)								const	noexcept;
+
+			/**
+			*	@brief	Close the scope opened by openMetadataArenaScope.
+			*			No code is generated if the metadata arena is not defined.
+			*
+			*	@param env			Code generation environment.
+			*	@param inout_result	String to append the generated code.
+			*/
+			void	closeMetadataArenaScope(kodgen::MacroCodeGenEnv&	env,
+											std::string&				inout_result)							const	noexcept;
+
 
 		protected:
 			virtual ReflectionCodeGenModule*	clone()																		const	noexcept	override;
@@ -11,7 +11,8 @@ inline std::string ReflectionCodeGenModule::getEntityId(kodgen::EntityInfo const
 }
 
 ReflectionCodeGenModule::ReflectionCodeGenModule() noexcept:
-	_isGeneratingHiddenCode{false}
+	_isGeneratingHiddenCode{false},
+	_isMetadataArenaDefined{false}
 {
 	addPropertyCodeGen(_instantiatorProperty);
 	addPropertyCodeGen(_propertySettingsProperty);
@@ -170,6 +171,7 @@ kodgen::ETraversalBehaviour ReflectionCodeGenModule::generateHeaderFileFooterCod
 
 		case kodgen::EEntityType::Enum:
 			declareGetEnumTemplateSpecialization(static_cast<kodgen::EnumInfo const&>(entity), env, inout_result);
+			defineEnumTableTemplateSpecialization(static_cast<kodgen::EnumInfo const&>(entity), env, inout_result);
 
 			result = kodgen::ETraversalBehaviour::Continue; //Go to next enum
 			break;
@@ -229,6 +231,7 @@ kodgen::ETraversalBehaviour ReflectionCodeGenModule::generateHeaderFileFooterCod
 bool ReflectionCodeGenModule::initialGenerateSourceFileHeaderCode(kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept
 {
 	includeSourceFileHeaders(env, inout_result);
+	declareAndDefineGetMetadataArenaFunction(env, inout_result);
 
 	return true;
 }
@@ -333,6 +336,7 @@ void ReflectionCodeGenModule::includeHeaderFileHeaders(kodgen::MacroCodeGenEnv&
 		"#include <Refureku/TypeInfo/Variables/StaticField.h>" + env.getSeparator() +
 		"#include <Refureku/TypeInfo/Archetypes/Enum.h>" + env.getSeparator() +
 		"#include <Refureku/TypeInfo/Archetypes/EnumValue.h>" + env.getSeparator() +
+		"#include <Refureku/TypeInfo/Archetypes/EnumTable.h>" + env.getSeparator() +
 		"#include <Refureku/TypeInfo/Variables/Variable.h>" + env.getSeparator() +											//TODO: Only if there is a variable
 		"#include <Refureku/TypeInfo/Functions/Function.h>" + env.getSeparator() +											//TODO: Only if there is a function
 		"#include <Refureku/TypeInfo/Archetypes/Template/ClassTemplate.h>" + env.getSeparator() +							//TODO: Only when there is a template class
@@ -347,6 +351,7 @@ void ReflectionCodeGenModule::includeHeaderFileHeaders(kodgen::MacroCodeGenEnv&
 void ReflectionCodeGenModule::includeSourceFileHeaders(kodgen::MacroCodeGenEnv& env, std::string& inout_result) const noexcept
 {
 	inout_result += "#include <Refureku/TypeInfo/Entity/DefaultEntityRegisterer.h>" + env.getSeparator() +					//TODO: Only if there is a variable or function
+		"#include <Refureku/TypeInfo/MetadataArena.h>" + env.getSeparator() +
 		"#include <Refureku/TypeInfo/Archetypes/ArchetypeRegisterer.h>" + env.getSeparator() +
 		"#include <Refureku/TypeInfo/Namespace/Namespace.h>" + env.getSeparator() +								//TODO: Only if there is a namespace
 		"#include <Refureku/TypeInfo/Namespace/NamespaceFragment.h>" + env.getSeparator() +						//TODO: Only if there is a namespace
@@ -513,8 +518,11 @@ void ReflectionCodeGenModule::defineStaticGetArchetypeMethod(kodgen::StructClass
 	std::string returnType = (structClass.isClass()) ? "rfk::Class" : "rfk::Struct";
 
 	inout_result += returnType + " const& " + structClass.type.getCanonicalName() + "::staticGetArchetype() noexcept {" + env.getSeparator() +
-		"static bool initialized = false;" + env.getSeparator() +
-		"static " + returnType + " type(\"" + structClass.name + "\", " +
+		"static bool initialized = false;" + env.getSeparator();
+
+	openMetadataArenaScope(env, inout_result);
+
+	inout_result += "static " + returnType + " type(\"" + structClass.name + "\", " +
 		getEntityId(structClass) + ", "
 		"sizeof(" + structClass.name + "), " +
 		std::to_string(structClass.isClass()) +
@@ -523,6 +531,7 @@ void ReflectionCodeGenModule::defineStaticGetArchetypeMethod(kodgen::StructClass
 		"initialized = true;" + env.getSeparator();
 
 	//Inside the if statement, initialize the Struct metadata
+	fillClassLayoutTraits(structClass, env, "type.", inout_result);
 	fillEntityProperties(structClass, env, "type.", inout_result);
 	fillClassParents(structClass, env, "type.", inout_result);
 	fillClassFields(structClass, env, "type", inout_result);
@@ -532,6 +541,8 @@ void ReflectionCodeGenModule::defineStaticGetArchetypeMethod(kodgen::StructClass
 	fillClassMethods(structClass, env, "type.", inout_result);
 	fillClassNestedArchetypes(structClass, env, "type.", inout_result);
 
+	closeMetadataArenaScope(env, inout_result);
+
 	//End of the initialization if statement
 	inout_result += "}" + env.getSeparator();
 
@@ -576,7 +587,8 @@ std::string ReflectionCodeGenModule::computeClassTemplateEntityId(kodgen::Struct
 
 std::string ReflectionCodeGenModule::computeClassNestedEntityId(std::string className, kodgen::EntityInfo const& entity) noexcept
 {
-	return "std::hash<std::string>()(std::string(\"" + entity.id + "\") + rfk::internal::getTypename<" + std::move(className) + ">())";
+	//Wrap the id in an integral_constant to force its evaluation at compile time
+	return "std::integral_constant<std::size_t, rfk::internal::computeClassNestedEntityId<" + std::move(className) + ">(\"" + entity.id + "\")>::value";
 }
 
 std::string ReflectionCodeGenModule::computeGetArchetypeFunctionSignature(kodgen::StructClassInfo const& structClass) noexcept
@@ -605,6 +617,7 @@ void ReflectionCodeGenModule::endHiddenGeneratedCode(kodgen::MacroCodeGenEnv& en
 void ReflectionCodeGenModule::reset() noexcept
 {
 	_isGeneratingHiddenCode = false;
+	_isMetadataArenaDefined = false;
 }
 
 void ReflectionCodeGenModule::checkHiddenGeneratedCodeState() const noexcept
@@ -655,27 +668,28 @@ void ReflectionCodeGenModule::fillEntityProperties(kodgen::EntityInfo const& ent
 		_propertiesCount.clear();
 		for (kodgen::uint8 i = 0; i < entity.properties.size(); i++)
 		{
-			generatedPropertyVariableName = computePropertyVariableName(entity, i);
-
 			//Generate static_asserts bound to this property
 			inout_result += generatePropertyStaticAsserts(entity.properties[i]);
 
+			//Properties without arguments are all identical, so share a single instance across all entities
+			if (entity.properties[i].arguments.empty())
+			{
+				inout_result += generatedEntityVarName + "addProperty(rfk::internal::CodeGenerationHelpers::getDefaultProperty<" + entity.properties[i].name + ">());" + env.getSeparator();
+				continue;
+			}
+
+			generatedPropertyVariableName = computePropertyVariableName(entity, i);
+
 			//Declare property
-			inout_result += "static " + entity.properties[i].name + " " + generatedPropertyVariableName;
+			inout_result += "static " + entity.properties[i].name + " " + generatedPropertyVariableName + "{";
 
 			//Construct the property with the provided arguments
-			if (!entity.properties[i].arguments.empty())
+			for (std::string const& argument : entity.properties[i].arguments)
 			{
-				inout_result += "{";
-
-				for (std::string const& argument : entity.properties[i].arguments)
-				{
-					inout_result += argument + ",";
-				}
-
-				inout_result.back() = '}';	//Replace the last , by a }
+				inout_result += argument + ",";
 			}
 
+			inout_result.back() = '}';	//Replace the last , by a }
 			inout_result.push_back(';');
 
 			inout_result += generatedEntityVarName + "addProperty(" + generatedPropertyVariableName + ");" + env.getSeparator();
@@ -683,17 +697,27 @@ void ReflectionCodeGenModule::fillEntityProperties(kodgen::EntityInfo const& ent
 	}
 }
 
+void ReflectionCodeGenModule::fillClassLayoutTraits(kodgen::StructClassInfo const& structClass, kodgen::MacroCodeGenEnv& env,
+												   std::string const& generatedClassVarName, std::string& inout_result) const noexcept
+{
+	inout_result += generatedClassVarName + "setMemoryAlignment(alignof(" + structClass.name + "));" + env.getSeparator();
+	inout_result += generatedClassVarName + "setTraits(rfk::internal::CodeGenerationHelpers::computeArchetypeTraits<" + structClass.name + ">());" + env.getSeparator();
+}
+
 void ReflectionCodeGenModule::setClassDefaultInstantiators(kodgen::StructClassInfo const& structClass, kodgen::MacroCodeGenEnv& env,
 														  std::string const& generatedClassVarName, std::string& inout_result) noexcept
 {
+	//Callables are stored in static storage so that no dynamic allocation is required
+	inout_result += "static rfk::NonMemberFunction<rfk::SharedPtr<" + structClass.name + ">()> defaultSharedInstantiatorCallable(&rfk::internal::CodeGenerationHelpers::defaultSharedInstantiator<" + structClass.name + ">);" + env.getSeparator();
 	inout_result += "static rfk::StaticMethod defaultSharedInstantiator(\"\", 0u, rfk::getType<rfk::SharedPtr<" + structClass.name +">>(),"
-		"new rfk::NonMemberFunction<rfk::SharedPtr<" + structClass.name + ">()>(&rfk::internal::CodeGenerationHelpers::defaultSharedInstantiator<" + structClass.name + ">),"
+		"defaultSharedInstantiatorCallable,"
 		"rfk::EMethodFlags::Default, nullptr);" + env.getSeparator();
 
 	inout_result += generatedClassVarName + "addSharedInstantiator(defaultSharedInstantiator);" + env.getSeparator();
 
+	inout_result += "static rfk::NonMemberFunction<rfk::UniquePtr<" + structClass.name + ">()> defaultUniqueInstantiatorCallable(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<" + structClass.name + ">);" + env.getSeparator();
 	inout_result += "static rfk::StaticMethod defaultUniqueInstantiator(\"\", 0u, rfk::getType<rfk::UniquePtr<" + structClass.name +">>(),"
-		"new rfk::NonMemberFunction<rfk::UniquePtr<" + structClass.name + ">()>(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<" + structClass.name + ">),"
+		"defaultUniqueInstantiatorCallable,"
 		"rfk::EMethodFlags::Default, nullptr);" + env.getSeparator();
 
 	inout_result += generatedClassVarName + "addUniqueInstantiator(defaultUniqueInstantiator);" + env.getSeparator();
@@ -733,30 +757,45 @@ void ReflectionCodeGenModule::fillClassMethods(kodgen::StructClassInfo const& st
 
 	std::string generatedCode;
 	std::string currentMethodVariable;
+	std::string callableVariable;
 	for (kodgen::MethodInfo const& method : structClass.methods)
 	{
 		if (method.isStatic)
 		{
 			staticMethodsCount++;
 
+			//The callable lives in static storage next to the other metadata instead of being dynamically allocated
+			callableVariable = "staticMethodCallable" + std::to_string(staticMethodsCount);
+			inout_result += "static rfk::NonMemberFunction<" + method.getPrototype(true) + "> " + callableVariable + "(& " + structClass.name + "::" + method.name + ");" + env.getSeparator();
+
 			inout_result += "staticMethod = " + generatedEntityVarName + "addStaticMethod(\"" + method.name + "\", " +
 				(structClass.type.isTemplateType() ? computeClassTemplateEntityId(structClass, method) : std::to_string(_stringHasher(method.id)) + "u") + ", "
-				"rfk::getType<" + method.returnType.getName() + ">(), "
-				"new rfk::NonMemberFunction<" + method.getPrototype(true) + ">(& " + structClass.name + "::" + method.name + "), "
+				"rfk::getType<" + method.returnType.getName() + ">(), " +
+				callableVariable + ", "
 				"static_cast<rfk::EMethodFlags>(" + std::to_string(computeRefurekuMethodFlags(method)) + "));" + env.getSeparator();
 
+			inout_result += "staticMethod->setErasedCallThunk(&rfk::internal::ErasedCallThunkHelper<static_cast<" + computeFullMethodPointerType(structClass, method) + ">(& " + structClass.name + "::" + method.name + ")>::invoke);" + env.getSeparator();
+			inout_result += "staticMethod->setNativeEntryPoint(&rfk::internal::NativeEntryPointHelper<static_cast<" + computeFullMethodPointerType(structClass, method) + ">(& " + structClass.name + "::" + method.name + ")>::get());" + env.getSeparator();
+
 			currentMethodVariable = "staticMethod";
 		}
 		else
 		{
 			methodsCount++;
 
+			//The callable lives in static storage next to the other metadata instead of being dynamically allocated
+			callableVariable = "methodCallable" + std::to_string(methodsCount);
+			inout_result += "static rfk::MemberFunction<" + structClass.name + ", " + method.getPrototype(true) + "> " + callableVariable + "(static_cast<" + computeFullMethodPointerType(structClass, method) + ">(& " + structClass.name + "::" + method.name + "));" + env.getSeparator();
+
 			inout_result += "method = " + generatedEntityVarName + "addMethod(\"" + method.name + "\", " +
 				(structClass.type.isTemplateType() ? computeClassTemplateEntityId(structClass, method) : std::to_string(_stringHasher(method.id)) + "u") + ", "
-				"rfk::getType<" + method.returnType.getName() + ">(), "
-				"new rfk::MemberFunction<" + structClass.name + ", " + method.getPrototype(true) + ">(static_cast<" + computeFullMethodPointerType(structClass, method) + ">(& " + structClass.name + "::" + method.name + ")), "
+				"rfk::getType<" + method.returnType.getName() + ">(), " +
+				callableVariable + ", "
 				"static_cast<rfk::EMethodFlags>(" + std::to_string(computeRefurekuMethodFlags(method)) + "));" + env.getSeparator();
 
+			inout_result += "method->setErasedCallThunk(&rfk::internal::ErasedCallThunkHelper<static_cast<" + computeFullMethodPointerType(structClass, method) + ">(& " + structClass.name + "::" + method.name + ")>::invoke);" + env.getSeparator();
+			inout_result += "method->setNativeEntryPoint(&rfk::internal::NativeEntryPointHelper<static_cast<" + computeFullMethodPointerType(structClass, method) + ">(& " + structClass.name + "::" + method.name + ")>::get());" + env.getSeparator();
+
 			currentMethodVariable = "method";
 		}
 
@@ -1009,6 +1048,9 @@ void ReflectionCodeGenModule::declareAndDefineClassTemplateStaticGetArchetypeMet
 {
 	inout_result += "public: static rfk::ClassTemplateInstantiation const& staticGetArchetype() noexcept {" + env.getSeparator();
 	inout_result += "static bool initialized = false;" + env.getSeparator();
+
+	//Instantiations are shared by all the translation units using them, so don't allocate them from the arena of a scope open in the thread
+	inout_result += "static rfk::MetadataArenaScope metadataArenaScope(nullptr);" + env.getSeparator();
 	inout_result += "static rfk::ClassTemplateInstantiation type(\"" + structClass.type.getName(false, true) + "\"," +
 		computeClassTemplateEntityId(structClass, structClass) + ", " +
 		"sizeof(" + structClass.getFullName() + "), " + 
@@ -1020,6 +1062,7 @@ void ReflectionCodeGenModule::declareAndDefineClassTemplateStaticGetArchetypeMet
 	inout_result += "initialized = true;" + env.getSeparator();
 
 	//Inside the if statement, initialize the Struct metadata
+	fillClassLayoutTraits(structClass, env, "type.", inout_result);
 	fillClassTemplateArguments(structClass, "type.", env, inout_result);
 	fillEntityProperties(structClass, env, "type.", inout_result);
 	fillClassParents(structClass, env, "type.", inout_result);
@@ -1030,6 +1073,8 @@ void ReflectionCodeGenModule::declareAndDefineClassTemplateStaticGetArchetypeMet
 	fillClassMethods(structClass, env, "type.", inout_result);
 	fillClassNestedArchetypes(structClass, env, "type.", inout_result);
 
+	inout_result += "metadataArenaScope.close();" + env.getSeparator();
+
 	//End init
 	inout_result += "}" + env.getSeparator();
 
@@ -1172,6 +1217,107 @@ void ReflectionCodeGenModule::declareAndDefineClassTemplateRegistererVariable(ko
 	}
 }
 
+std::string ReflectionCodeGenModule::getInt64Literal(kodgen::int64 value) noexcept
+{
+	//-9223372036854775808 is the negation of a literal which doesn't fit in an int64
+	return (value == std::numeric_limits<kodgen::int64>::min()) ? "(-9223372036854775807 - 1)" : std::to_string(value);
+}
+
+void ReflectionCodeGenModule::computeEnumNamesPerfectHash(std::vector<std::string> const& names, std::vector<kodgen::uint64>& out_bucketSeeds, std::vector<std::size_t>& out_slots) noexcept
+{
+	constexpr kodgen::uint64 maxSeed = 1u << 16;
+
+	std::size_t bucketsCount = 1u;
+
+	while (bucketsCount < names.size())
+	{
+		bucketsCount <<= 1;
+	}
+
+	//Dispatch names to buckets
+	std::vector<std::vector<std::size_t>> buckets(bucketsCount);
+
+	for (std::size_t i = 0u; i < names.size(); i++)
+	{
+		buckets[Helpers::hashEnumName(names[i], 0u) & (bucketsCount - 1u)].push_back(i);
+	}
+
+	//Place the largest buckets first since they are the hardest to place
+	std::vector<std::size_t> bucketsOrder(bucketsCount);
+
+	for (std::size_t i = 0u; i < bucketsCount; i++)
+	{
+		bucketsOrder[i] = i;
+	}
+
+	std::stable_sort(bucketsOrder.begin(), bucketsOrder.end(), [&buckets](std::size_t lhs, std::size_t rhs)
+					 {
+						 return buckets[lhs].size() > buckets[rhs].size();
+					 });
+
+	//Find a seed per bucket sending its names to unused slots, and retry with more slots on failure
+	for (std::size_t slotsCount = bucketsCount * 2u; ; slotsCount *= 2u)
+	{
+		bool						success = true;
+		std::vector<std::size_t>	bucketSlots;
+
+		out_bucketSeeds.assign(bucketsCount, 0u);
+		out_slots.assign(slotsCount, names.size());
+
+		for (std::size_t bucketIndex : bucketsOrder)
+		{
+			std::vector<std::size_t> const& bucket = buckets[bucketIndex];
+
+			if (bucket.empty())
+			{
+				break;
+			}
+
+			kodgen::uint64 seed = 1u;
+
+			for (; seed <= maxSeed; seed++)
+			{
+				bucketSlots.clear();
+
+				for (std::size_t nameIndex : bucket)
+				{
+					std::size_t slot = Helpers::hashEnumName(names[nameIndex], seed) & (slotsCount - 1u);
+
+					if (out_slots[slot] != names.size() || std::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end())
+					{
+						break;
+					}
+
+					bucketSlots.push_back(slot);
+				}
+
+				if (bucketSlots.size() == bucket.size())
+				{
+					break;
+				}
+			}
+
+			if (seed > maxSeed)
+			{
+				success = false;
+				break;
+			}
+
+			out_bucketSeeds[bucketIndex] = seed;
+
+			for (std::size_t i = 0u; i < bucket.size(); i++)
+			{
+				out_slots[bucketSlots[i]] = bucket[i];
+			}
+		}
+
+		if (success)
+		{
+			return;
+		}
+	}
+}
+
 std::string ReflectionCodeGenModule::convertEntityTypeToEntityKind(kodgen::EEntityType entityType) noexcept
 {
 	switch (entityType)
@@ -1316,6 +1462,86 @@ void ReflectionCodeGenModule::declareGetEnumTemplateSpecialization(kodgen::EnumI
 	inout_result += "template <> " + env.getExportSymbolMacro() + " rfk::Enum const* rfk::getEnum<" + enum_.type.getCanonicalName() + ">() noexcept;" + env.getSeparator();
 }
 
+void ReflectionCodeGenModule::defineEnumTableTemplateSpecialization(kodgen::EnumInfo const& enum_, kodgen::MacroCodeGenEnv& env, std::string& inout_result) const noexcept
+{
+	//Distinct values sorted by increasing value, keeping the first declared enum value for each value
+	std::vector<kodgen::EnumValueInfo const*> sortedEnumValues;
+
+	sortedEnumValues.reserve(enum_.enumValues.size());
+
+	for (kodgen::EnumValueInfo const& enumValue : enum_.enumValues)
+	{
+		sortedEnumValues.push_back(&enumValue);
+	}
+
+	std::stable_sort(sortedEnumValues.begin(), sortedEnumValues.end(), [](kodgen::EnumValueInfo const* lhs, kodgen::EnumValueInfo const* rhs)
+					 {
+						 return lhs->value < rhs->value;
+					 });
+
+	sortedEnumValues.erase(std::unique(sortedEnumValues.begin(), sortedEnumValues.end(), [](kodgen::EnumValueInfo const* lhs, kodgen::EnumValueInfo const* rhs)
+									   {
+										   return lhs->value == rhs->value;
+									   }), sortedEnumValues.end());
+
+	//Perfect hash of the names
+	std::vector<std::string>	names;
+	std::vector<kodgen::uint64>	bucketSeeds;
+	std::vector<std::size_t>	slots;
+
+	names.reserve(enum_.enumValues.size());
+
+	for (kodgen::EnumValueInfo const& enumValue : enum_.enumValues)
+	{
+		names.push_back(enumValue.name);
+	}
+
+	computeEnumNamesPerfectHash(names, bucketSeeds, slots);
+
+	//Arrays can't be empty, so enums without value get a single unused element
+	std::string values;
+	std::string valueNames;
+	std::string nameValues;
+	std::string nameStrings;
+	std::string bucketSeedsStr;
+	std::string slotsStr;
+
+	for (kodgen::EnumValueInfo const* enumValue : sortedEnumValues)
+	{
+		values		+= getInt64Literal(enumValue->value) + ", ";
+		valueNames	+= "\"" + enumValue->name + "\", ";
+	}
+
+	for (kodgen::EnumValueInfo const& enumValue : enum_.enumValues)
+	{
+		nameValues	+= getInt64Literal(enumValue.value) + ", ";
+		nameStrings	+= "\"" + enumValue.name + "\", ";
+	}
+
+	for (kodgen::uint64 bucketSeed : bucketSeeds)
+	{
+		bucketSeedsStr += std::to_string(bucketSeed) + "u, ";
+	}
+
+	for (std::size_t slot : slots)
+	{
+		slotsStr += std::to_string(slot) + "u, ";
+	}
+
+	inout_result += "namespace rfk { template <> struct EnumTable<" + enum_.type.getCanonicalName() + "> {" + env.getSeparator() +
+		"static constexpr std::size_t valuesCount = " + std::to_string(sortedEnumValues.size()) + "u;" + env.getSeparator() +
+		"static constexpr rfk::int64 values[] = { " + (values.empty() ? "0" : values) + " };" + env.getSeparator() +
+		"static constexpr std::string_view valueNames[] = { " + (valueNames.empty() ? "\"\"" : valueNames) + " };" + env.getSeparator() +
+		"static constexpr std::size_t namesCount = " + std::to_string(names.size()) + "u;" + env.getSeparator() +
+		"static constexpr std::string_view names[] = { " + (nameStrings.empty() ? "\"\"" : nameStrings) + " };" + env.getSeparator() +
+		"static constexpr rfk::int64 nameValues[] = { " + (nameValues.empty() ? "0" : nameValues) + " };" + env.getSeparator() +
+		"static constexpr rfk::uint64 nameBucketsMask = " + std::to_string(bucketSeeds.size() - 1u) + "u;" + env.getSeparator() +
+		"static constexpr rfk::uint64 nameBucketSeeds[] = { " + bucketSeedsStr + " };" + env.getSeparator() +
+		"static constexpr rfk::uint64 nameSlotsMask = " + std::to_string(slots.size() - 1u) + "u;" + env.getSeparator() +
+		"static constexpr std::size_t nameSlots[] = { " + slotsStr + " };" + env.getSeparator() +
+		"}; }" + env.getSeparator();
+}
+
 void ReflectionCodeGenModule::defineGetEnumTemplateSpecialization(kodgen::EnumInfo const& enum_, kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept
 {
 	//Don't generate template specialization code on non-public enums
@@ -1329,8 +1555,11 @@ void ReflectionCodeGenModule::defineGetEnumTemplateSpecialization(kodgen::EnumIn
 void ReflectionCodeGenModule::defineGetEnumContent(kodgen::EnumInfo const& enum_, kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept
 {
 	inout_result += "{" + env.getSeparator() +
-		"static bool initialized = false;" + env.getSeparator() +
-		"static rfk::Enum type(\"" + enum_.name + "\", " +
+		"static bool initialized = false;" + env.getSeparator();
+
+	openMetadataArenaScope(env, inout_result);
+
+	inout_result += "static rfk::Enum type(\"" + enum_.name + "\", " +
 		getEntityId(enum_) + ", "
 		"rfk::getArchetype<" + enum_.underlyingType.getCanonicalName() + ">());" + env.getSeparator();
 
@@ -1354,6 +1583,8 @@ void ReflectionCodeGenModule::defineGetEnumContent(kodgen::EnumInfo const& enum_
 		}
 	}
 
+	closeMetadataArenaScope(env, inout_result);
+
 	//End initialization if
 	inout_result += "}" + env.getSeparator();
 
@@ -1383,8 +1614,11 @@ void ReflectionCodeGenModule::defineGetVariableFunction(kodgen::VariableInfo con
 	std::string fullName = variable.getFullName();
 
 	inout_result += "template <> rfk::Variable const* rfk::getVariable<&" + variable.getFullName() + ">() noexcept {" + env.getSeparator() +
-		"static bool initialized = false;" + env.getSeparator() + 
-		"static rfk::Variable variable(\"" + variable.name + "\", " +
+		"static bool initialized = false;" + env.getSeparator();
+
+	openMetadataArenaScope(env, inout_result);
+
+	inout_result += "static rfk::Variable variable(\"" + variable.name + "\", " +
 		getEntityId(variable) + ", "
 		"rfk::getType<decltype(" + fullName + ")>(), "
 		"&" + fullName + ", "
@@ -1397,6 +1631,8 @@ void ReflectionCodeGenModule::defineGetVariableFunction(kodgen::VariableInfo con
 
 	fillEntityProperties(variable, env, "variable.", inout_result);
 
+	closeMetadataArenaScope(env, inout_result);
+
 	//End initialization if
 	inout_result += "}";
 
@@ -1437,10 +1673,14 @@ void ReflectionCodeGenModule::defineGetFunctionFunction(kodgen::FunctionInfo con
 {
 	inout_result += "template <> rfk::Function const* rfk::getFunction<static_cast<" + computeFunctionPtrType(function) + ">(&" + function.getFullName() + ")>() noexcept {" + env.getSeparator() +
 		"static bool initialized = false;" + env.getSeparator() + 
-		"static rfk::Function function(\"" + function.name + "\", " +
+		"static rfk::NonMemberFunction<" + function.getPrototype(true) + "> functionCallable(&" + function.getFullName() + ");" + env.getSeparator();
+
+	openMetadataArenaScope(env, inout_result);
+
+	inout_result += "static rfk::Function function(\"" + function.name + "\", " +
 		getEntityId(function) + ", "
 		"rfk::getType<" + function.returnType.getCanonicalName() + ">(), "
-		"new rfk::NonMemberFunction<" + function.getPrototype(true) + ">(&" + function.getFullName() + "), "
+		"functionCallable, "
 		"static_cast<rfk::EFunctionFlags>(" + std::to_string(computeRefurekuFunctionFlags(function)) + ")"
 		");" + env.getSeparator();
 
@@ -1448,6 +1688,9 @@ void ReflectionCodeGenModule::defineGetFunctionFunction(kodgen::FunctionInfo con
 	inout_result += "if (!initialized) {" + env.getSeparator() +
 		"initialized = true;" + env.getSeparator();
 
+	inout_result += "function.setErasedCallThunk(&rfk::internal::ErasedCallThunkHelper<static_cast<" + computeFunctionPtrType(function) + ">(&" + function.getFullName() + ")>::invoke);" + env.getSeparator();
+	inout_result += "function.setNativeEntryPoint(&rfk::internal::NativeEntryPointHelper<static_cast<" + computeFunctionPtrType(function) + ">(&" + function.getFullName() + ")>::get());" + env.getSeparator();
+
 	fillEntityProperties(function, env, "function.", inout_result);
 
 	//Setup parameters
@@ -1463,6 +1706,8 @@ void ReflectionCodeGenModule::defineGetFunctionFunction(kodgen::FunctionInfo con
 		inout_result += ";" + env.getSeparator();
 	}
 
+	closeMetadataArenaScope(env, inout_result);
+
 	//End initialization if
 	inout_result += "}";
 
@@ -1502,8 +1747,11 @@ std::string ReflectionCodeGenModule::computeFunctionPtrType(kodgen::FunctionInfo
 
 void ReflectionCodeGenModule::declareAndDefineGetNamespaceFragmentFunction(kodgen::NamespaceInfo const& namespace_, kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept
 {
-	inout_result += env.getInternalSymbolMacro() + " static rfk::NamespaceFragment const& " + computeGetNamespaceFragmentFunctionName(namespace_, env.getFileParsingResult()->parsedFile) + "() noexcept {" + env.getSeparator() +
-		"static rfk::NamespaceFragment fragment(\"" + namespace_.name + "\", " + getEntityId(namespace_) + ");" + env.getSeparator() +
+	inout_result += env.getInternalSymbolMacro() + " static rfk::NamespaceFragment const& " + computeGetNamespaceFragmentFunctionName(namespace_, env.getFileParsingResult()->parsedFile) + "() noexcept {" + env.getSeparator();
+
+	openMetadataArenaScope(env, inout_result);
+
+	inout_result += "static rfk::NamespaceFragment fragment(\"" + namespace_.name + "\", " + getEntityId(namespace_) + ");" + env.getSeparator() +
 		"static bool initialized = false;" + env.getSeparator();
 
 
@@ -1559,6 +1807,8 @@ void ReflectionCodeGenModule::declareAndDefineGetNamespaceFragmentFunction(kodge
 		}
 	}
 
+	closeMetadataArenaScope(env, inout_result);
+
 	//End initialization if
 	inout_result += "}" + env.getSeparator();
 
@@ -1611,4 +1861,155 @@ std::string ReflectionCodeGenModule::computeGetNamespaceFragmentFunctionName(kod
 std::string ReflectionCodeGenModule::computeNamespaceFragmentRegistererName(kodgen::NamespaceInfo const& namespace_, fs::path const& sourceFile) noexcept
 {
 	return "namespaceFragmentRegisterer_" + getEntityId(namespace_) + "_" + std::to_string(_stringHasher(sourceFile.string()));
+}
+
+std::string ReflectionCodeGenModule::computeGetMetadataArenaFunctionName(fs::path const& sourceFile) noexcept
+{
+	return "getMetadataArena_" + std::to_string(_stringHasher(sourceFile.string()));
+}
+
+void ReflectionCodeGenModule::declareAndDefineGetMetadataArenaFunction(kodgen::MacroCodeGenEnv& env, std::string& inout_result) noexcept
+{
+	std::size_t namespaceFragmentsCount	= 0u;
+	std::size_t structsCount			= 0u;
+	std::size_t classesCount			= 0u;
+	std::size_t enumsCount				= 0u;
+	std::size_t enumValuesCount			= 0u;
+	std::size_t fieldsCount				= 0u;
+	std::size_t methodsCount			= 0u;
+	std::size_t variablesCount			= 0u;
+	std::size_t functionsCount			= 0u;
+
+	auto const countEnum = [&](kodgen::EnumInfo const& enum_) -> void
+	{
+		enumsCount++;
+		enumValuesCount += enum_.enumValues.size();
+	};
+
+	//Class templates are instantiated in the user code, so their metadata is not allocated from the arena
+	auto const countStructClass = [&](kodgen::StructClassInfo const& structClass, auto const& countStructClassRef) -> void
+	{
+		if (structClass.isForwardDeclaration || structClass.type.isTemplateType())
+		{
+			return;
+		}
+
+		((structClass.entityType == kodgen::EEntityType::Struct) ? structsCount : classesCount)++;
+		fieldsCount += structClass.fields.size();
+		methodsCount += structClass.methods.size() + 2u;	//+2 for the default shared and unique instantiators
+
+		for (std::shared_ptr<kodgen::NestedStructClassInfo> const& nestedStruct : structClass.nestedStructs)
+		{
+			countStructClassRef(*nestedStruct, countStructClassRef);
+		}
+
+		for (std::shared_ptr<kodgen::NestedStructClassInfo> const& nestedClass : structClass.nestedClasses)
+		{
+			countStructClassRef(*nestedClass, countStructClassRef);
+		}
+
+		for (kodgen::NestedEnumInfo const& nestedEnum : structClass.nestedEnums)
+		{
+			countEnum(nestedEnum);
+		}
+	};
+
+	//Static variables and functions are defined in the header file, so their metadata is not allocated from the arena
+	auto const countNamespaceContent = [&](auto const& entity, auto const& countNamespaceContentRef) -> void
+	{
+		for (kodgen::NamespaceInfo const& namespace_ : entity.namespaces)
+		{
+			namespaceFragmentsCount++;
+			countNamespaceContentRef(namespace_, countNamespaceContentRef);
+		}
+
+		for (kodgen::StructClassInfo const& struct_ : entity.structs)
+		{
+			countStructClass(struct_, countStructClass);
+		}
+
+		for (kodgen::StructClassInfo const& class_ : entity.classes)
+		{
+			countStructClass(class_, countStructClass);
+		}
+
+		for (kodgen::EnumInfo const& enum_ : entity.enums)
+		{
+			countEnum(enum_);
+		}
+
+		for (kodgen::VariableInfo const& variable : entity.variables)
+		{
+			if (!variable.isStatic)
+			{
+				variablesCount++;
+			}
+		}
+
+		for (kodgen::FunctionInfo const& function : entity.functions)
+		{
+			if (!function.isStatic)
+			{
+				functionsCount++;
+			}
+		}
+	};
+
+	countNamespaceContent(*env.getFileParsingResult(), countNamespaceContent);
+
+	std::string reservations;
+
+	auto const reserveEntities = [&reservations, &env](char const* entityKind, std::size_t count) -> void
+	{
+		if (count != 0u)
+		{
+			reservations += "arena.reserveEntities(rfk::EEntityKind::" + std::string(entityKind) + ", " + std::to_string(count) + "u);" + env.getSeparator();
+		}
+	};
+
+	reserveEntities("NamespaceFragment", namespaceFragmentsCount);
+	reserveEntities("Struct", structsCount);
+	reserveEntities("Class", classesCount);
+	reserveEntities("Enum", enumsCount);
+	reserveEntities("EnumValue", enumValuesCount);
+	reserveEntities("Field", fieldsCount);
+	reserveEntities("Method", methodsCount);
+	reserveEntities("Variable", variablesCount);
+	reserveEntities("Function", functionsCount);
+
+	//Don't generate an arena for files which don't define any entity
+	if (reservations.empty())
+	{
+		return;
+	}
+
+	inout_result += "namespace rfk::generated { " + env.getSeparator() +
+		"static rfk::MetadataArena& " + computeGetMetadataArenaFunctionName(env.getFileParsingResult()->parsedFile) + "() noexcept {" + env.getSeparator() +
+		"static rfk::MetadataArena arena;" + env.getSeparator() +
+		"static bool initialized = false;" + env.getSeparator() +
+		"if (!initialized) {" + env.getSeparator() +
+		"initialized = true;" + env.getSeparator() +
+		reservations +
+		"}" + env.getSeparator() +
+		"return arena; }" + env.getSeparator() +
+		"}" + env.getSeparator();
+
+	_isMetadataArenaDefined = true;
+}
+
+void ReflectionCodeGenModule::openMetadataArenaScope(kodgen::MacroCodeGenEnv& env, std::string& inout_result) const noexcept
+{
+	if (_isMetadataArenaDefined)
+	{
+		//The scope is static so that it is opened only once, by the call constructing the entity
+		inout_result += "static rfk::MetadataArenaScope metadataArenaScope(rfk::generated::" + computeGetMetadataArenaFunctionName(env.getFileParsingResult()->parsedFile) + "());" + env.getSeparator();
+	}
+}
+
+void ReflectionCodeGenModule::closeMetadataArenaScope(kodgen::MacroCodeGenEnv& env, std::string& inout_result) const noexcept
+{
+	if (_isMetadataArenaDefined)
+	{
+		inout_result += "metadataArenaScope.close();" + env.getSeparator();
+	}
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <cassert>
+#include <string_view>
 
 #include <Kodgen/Misc/FundamentalTypes.h>
 #include <Kodgen/InfoStructures/EEntityType.h>
@@ -30,6 +31,17 @@ namespace rfk
 			*	@return The converted value.
 			*/
 			constexpr static kodgen::uint16 convertToEntityKind(kodgen::EEntityType entityType) noexcept;
+
+			/**
+			*	@brief	Seeded FNV-1a hash of an enum value name.
+			*			Must stay identical to rfk::internal::hashEnumName since the generated enum tables are looked up with it.
+			*
+			*	@param name	Name to hash.
+			*	@param seed	Seed of the hash.
+			*
+			*	@return The hash of the name.
+			*/
+			constexpr static kodgen::uint64 hashEnumName(std::string_view name, kodgen::uint64 seed) noexcept;
 	};
 
 	#include "RefurekuGenerator/Misc/Helpers.inl"
@@ -37,4 +37,23 @@ constexpr kodgen::uint16 Helpers::convertToEntityKind(kodgen::EEntityType entity
 	}
 
 	return 0u;
+}
+
+constexpr kodgen::uint64 Helpers::hashEnumName(std::string_view name, kodgen::uint64 seed) noexcept
+{
+	kodgen::uint64 hash = 14695981039346656037ull;
+
+	for (std::size_t i = 0u; i < sizeof(kodgen::uint64); i++)
+	{
+		hash ^= (seed >> (i * 8u)) & 0xFFu;
+		hash *= 1099511628211ull;
+	}
+
+	for (char c : name)
+	{
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
 }
\ No newline at end of file
@@ -0,0 +1,212 @@
+#include <chrono>
+#include <cstdlib>	//EXIT_SUCCESS
+#include <cstring>	//std::memcpy
+#include <iomanip>	//std::setw
+#include <iostream>
+#include <vector>
+
+#include <Refureku/Refureku.h>
+
+#include "TestSerialization.h"
+
+namespace
+{
+	/** Number of iterations of each benchmark. */
+	constexpr std::size_t	iterationsCount = 1000000u;
+
+	/** Bytes read after each iteration so that the benchmarked code can't be optimized away. */
+	volatile unsigned char	benchmarkSink;
+
+	/**
+	*	@brief Run a function iterationsCount times and print the average time of an iteration.
+	*
+	*	@param name	Name of the benchmark.
+	*	@param func	Function to benchmark, returning a byte depending on its result.
+	*/
+	template <typename Func>
+	void runBenchmark(char const* name, Func&& func)
+	{
+		//Warm up caches and lazily built metadata (the binary schema for example)
+		for (std::size_t i = 0u; i < iterationsCount / 100u; i++)
+		{
+			benchmarkSink = func();
+		}
+
+		auto start = std::chrono::steady_clock::now();
+
+		for (std::size_t i = 0u; i < iterationsCount; i++)
+		{
+			benchmarkSink = func();
+		}
+
+		std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+		std::cout << std::left << std::setw(64) << name << std::right << std::setw(10) << std::fixed << std::setprecision(2) << elapsed.count() / iterationsCount << " ns/op" << std::endl;
+	}
+
+	/**
+	*	@brief	Hand-written memberwise serialization, writing the same serializable fields as rfk::serializeBinary.
+	*			No header nor field table is written, so this is the lower bound of any versioned format.
+	*/
+	class HandWrittenSerializer
+	{
+		private:
+			unsigned char* _cursor;
+
+		public:
+			HandWrittenSerializer(unsigned char* buffer) noexcept:
+				_cursor{buffer}
+			{
+			}
+
+			template <typename T>
+			void write(T const& value) noexcept
+			{
+				std::memcpy(_cursor, &value, sizeof(T));
+				_cursor += sizeof(T);
+			}
+
+			void write(TestSerializationVector const& value) noexcept
+			{
+				write(value.x);
+				write(value.y);
+			}
+
+			void write(TestSerializationStruct const& value) noexcept
+			{
+				write(value.intField);
+				write(value.enumField);
+				write(value.doubleArray[0]);
+				write(value.doubleArray[1]);
+				write(value.position);
+				write(value.path[0]);
+				write(value.path[1]);
+			}
+	};
+
+	/** Hand-written memberwise deserialization, reading the bytes written by HandWrittenSerializer. */
+	class HandWrittenDeserializer
+	{
+		private:
+			unsigned char const* _cursor;
+
+		public:
+			HandWrittenDeserializer(unsigned char const* buffer) noexcept:
+				_cursor{buffer}
+			{
+			}
+
+			template <typename T>
+			void read(T& out_value) noexcept
+			{
+				std::memcpy(&out_value, _cursor, sizeof(T));
+				_cursor += sizeof(T);
+			}
+
+			void read(TestSerializationVector& out_value) noexcept
+			{
+				read(out_value.x);
+				read(out_value.y);
+			}
+
+			void read(TestSerializationStruct& out_value) noexcept
+			{
+				read(out_value.intField);
+				read(out_value.enumField);
+				read(out_value.doubleArray[0]);
+				read(out_value.doubleArray[1]);
+				read(out_value.position);
+				read(out_value.path[0]);
+				read(out_value.path[1]);
+			}
+	};
+
+	/**
+	*	@brief Benchmark the serialization and deserialization of an instance against the hand-written memberwise code.
+	*
+	*	@param structName	Name of the benchmarked struct.
+	*	@param instance		Instance to serialize.
+	*/
+	template <typename T>
+	void runBinarySerializationBenchmarks(char const* structName, T const& instance)
+	{
+		rfk::Struct const&			archetype = T::staticGetArchetype();
+		std::vector<unsigned char>	record(archetype.getBinarySchema().getRecordSize());
+		std::vector<unsigned char>	mismatchingRecord(record.size());
+		std::vector<unsigned char>	handWrittenBuffer(record.size());
+		T							result;
+
+		std::cout << structName << " (record: " << record.size() << " bytes)" << std::endl;
+
+		runBenchmark("  hand-written serialization", [&]()
+					 {
+						 HandWrittenSerializer(handWrittenBuffer.data()).write(instance);
+
+						 return handWrittenBuffer[0];
+					 });
+
+		runBenchmark("  rfk::serializeBinary (buffer)", [&]()
+					 {
+						 rfk::serializeBinary(archetype, &instance, record.data(), record.size());
+
+						 return record[0];
+					 });
+
+		std::size_t streamedSize;
+
+		runBenchmark("  rfk::serializeBinary (sink)", [&]()
+					 {
+						 streamedSize = 0u;
+
+						 rfk::serializeBinary(archetype, &instance, [&](void const* data, std::size_t size)
+											  {
+												  std::memcpy(record.data() + streamedSize, data, size);
+												  streamedSize += size;
+											  });
+
+						 return record[0];
+					 });
+
+		runBenchmark("  hand-written deserialization", [&]()
+					 {
+						 HandWrittenDeserializer(handWrittenBuffer.data()).read(result);
+
+						 return *reinterpret_cast<unsigned char const*>(&result);
+					 });
+
+		runBenchmark("  rfk::deserializeBinary (matching schema id)", [&]()
+					 {
+						 return static_cast<unsigned char>(rfk::deserializeBinary(archetype, &result, record.data(), record.size()));
+					 });
+
+		//Change the schema id of the record so that its fields are matched by id through the field table
+		mismatchingRecord = record;
+		mismatchingRecord[0] ^= 0xFFu;
+
+		runBenchmark("  rfk::deserializeBinary (field matching)", [&]()
+					 {
+						 return static_cast<unsigned char>(rfk::deserializeBinary(archetype, &result, mismatchingRecord.data(), mismatchingRecord.size()));
+					 });
+	}
+}
+
+int main()
+{
+	TestSerializationVector vector;
+
+	vector.x = 1.0f;
+	vector.y = 2.0f;
+
+	TestSerializationStruct instance;
+
+	instance.intField		= 1;
+	instance.enumField		= TestEnumClass::Value3;
+	instance.doubleArray[1]	= 2.0;
+	instance.position		= vector;
+	instance.path[1]		= vector;
+
+	runBinarySerializationBenchmarks("TestSerializationVector", vector);
+	runBinarySerializationBenchmarks("TestSerializationStruct", instance);
+
+	return EXIT_SUCCESS;
+}
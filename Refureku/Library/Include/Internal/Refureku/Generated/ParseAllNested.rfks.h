@@ -4,6 +4,7 @@
 
 #include <type_traits>
 #include <Refureku/TypeInfo/Entity/DefaultEntityRegisterer.h>
+#include <Refureku/TypeInfo/MetadataArena.h>
 #include <Refureku/TypeInfo/Archetypes/ArchetypeRegisterer.h>
 #include <Refureku/TypeInfo/Namespace/Namespace.h>
 #include <Refureku/TypeInfo/Namespace/NamespaceFragment.h>
@@ -12,35 +13,55 @@
 #include <Refureku/TypeInfo/Archetypes/Template/NonTypeTemplateParameter.h>
 #include <Refureku/TypeInfo/Archetypes/Template/TemplateTemplateParameter.h>
 
+namespace rfk::generated { 
+static rfk::MetadataArena& getMetadataArena_5959650475308226396() noexcept {
+static rfk::MetadataArena arena;
+static bool initialized = false;
+if (!initialized) {
+initialized = true;
+arena.reserveEntities(rfk::EEntityKind::NamespaceFragment, 1u);
+arena.reserveEntities(rfk::EEntityKind::Class, 1u);
+arena.reserveEntities(rfk::EEntityKind::Method, 2u);
+}
+return arena; }
+}
 rfk::EEntityKind kodgen::ParseAllNested::getTargetEntityKind() const noexcept { return targetEntityKind; }
 static_assert(std::is_base_of_v<rfk::Property, kodgen::ParseAllNested>, "[Refureku] Can't attach rfk::PropertySettings property to kodgen::ParseAllNested as it doesn't inherit from rfk::Property.");
 namespace rfk::generated { 
  static rfk::NamespaceFragment const& getNamespaceFragment_5603044350098704190u_5959650475308226396() noexcept {
+static rfk::MetadataArenaScope metadataArenaScope(rfk::generated::getMetadataArena_5959650475308226396());
 static rfk::NamespaceFragment fragment("kodgen", 5603044350098704190u);
 static bool initialized = false;
 if (!initialized) {
 initialized = true;
 fragment.setNestedEntitiesCapacity(1u);
 fragment.addNestedEntity(*rfk::getArchetype<kodgen::ParseAllNested>());
+metadataArenaScope.close();
 }
 return fragment; }
 static rfk::NamespaceFragmentRegisterer const namespaceFragmentRegisterer_5603044350098704190u_5959650475308226396(rfk::generated::getNamespaceFragment_5603044350098704190u_5959650475308226396());
  }
 rfk::Class const& kodgen::ParseAllNested::staticGetArchetype() noexcept {
 static bool initialized = false;
+static rfk::MetadataArenaScope metadataArenaScope(rfk::generated::getMetadataArena_5959650475308226396());
 static rfk::Class type("ParseAllNested", 1518429735798145968u, sizeof(ParseAllNested), 1);
 if (!initialized) {
 initialized = true;
+type.setMemoryAlignment(alignof(ParseAllNested));
+type.setTraits(rfk::internal::CodeGenerationHelpers::computeArchetypeTraits<ParseAllNested>());
 type.setPropertiesCapacity(1);
 static_assert((rfk::PropertySettings::targetEntityKind & rfk::EEntityKind::Class) != rfk::EEntityKind::Undefined, "[Refureku] rfk::PropertySettings can't be applied to a rfk::EEntityKind::Class");static rfk::PropertySettings property_1518429735798145968u_0{rfk::EEntityKind::Namespace | rfk::EEntityKind::Class | rfk::EEntityKind::Struct};type.addProperty(property_1518429735798145968u_0);
 type.setDirectParentsCapacity(1);
 type.addDirectParent(rfk::getArchetype<rfk::Property>(), static_cast<rfk::EAccessSpecifier>(1));
 ParseAllNested::_rfk_registerChildClass<ParseAllNested>(type);
-static rfk::StaticMethod defaultSharedInstantiator("", 0u, rfk::getType<rfk::SharedPtr<ParseAllNested>>(),new rfk::NonMemberFunction<rfk::SharedPtr<ParseAllNested>()>(&rfk::internal::CodeGenerationHelpers::defaultSharedInstantiator<ParseAllNested>),rfk::EMethodFlags::Default, nullptr);
+static rfk::NonMemberFunction<rfk::SharedPtr<ParseAllNested>()> defaultSharedInstantiatorCallable(&rfk::internal::CodeGenerationHelpers::defaultSharedInstantiator<ParseAllNested>);
+static rfk::StaticMethod defaultSharedInstantiator("", 0u, rfk::getType<rfk::SharedPtr<ParseAllNested>>(),defaultSharedInstantiatorCallable,rfk::EMethodFlags::Default, nullptr);
 type.addSharedInstantiator(defaultSharedInstantiator);
-static rfk::StaticMethod defaultUniqueInstantiator("", 0u, rfk::getType<rfk::UniquePtr<ParseAllNested>>(),new rfk::NonMemberFunction<rfk::UniquePtr<ParseAllNested>()>(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<ParseAllNested>),rfk::EMethodFlags::Default, nullptr);
+static rfk::NonMemberFunction<rfk::UniquePtr<ParseAllNested>()> defaultUniqueInstantiatorCallable(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<ParseAllNested>);
+static rfk::StaticMethod defaultUniqueInstantiator("", 0u, rfk::getType<rfk::UniquePtr<ParseAllNested>>(),defaultUniqueInstantiatorCallable,rfk::EMethodFlags::Default, nullptr);
 type.addUniqueInstantiator(defaultUniqueInstantiator);
 type.setMethodsCapacity(0u); type.setStaticMethodsCapacity(0u); 
+metadataArenaScope.close();
 }
 return type; }
 
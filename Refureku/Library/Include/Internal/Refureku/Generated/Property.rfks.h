@@ -4,6 +4,7 @@
 
 #include <type_traits>
 #include <Refureku/TypeInfo/Entity/DefaultEntityRegisterer.h>
+#include <Refureku/TypeInfo/MetadataArena.h>
 #include <Refureku/TypeInfo/Archetypes/ArchetypeRegisterer.h>
 #include <Refureku/TypeInfo/Namespace/Namespace.h>
 #include <Refureku/TypeInfo/Namespace/NamespaceFragment.h>
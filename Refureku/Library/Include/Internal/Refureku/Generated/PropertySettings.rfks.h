@@ -4,6 +4,7 @@
 
 #include <type_traits>
 #include <Refureku/TypeInfo/Entity/DefaultEntityRegisterer.h>
+#include <Refureku/TypeInfo/MetadataArena.h>
 #include <Refureku/TypeInfo/Archetypes/ArchetypeRegisterer.h>
 #include <Refureku/TypeInfo/Namespace/Namespace.h>
 #include <Refureku/TypeInfo/Namespace/NamespaceFragment.h>
@@ -12,35 +13,55 @@
 #include <Refureku/TypeInfo/Archetypes/Template/NonTypeTemplateParameter.h>
 #include <Refureku/TypeInfo/Archetypes/Template/TemplateTemplateParameter.h>
 
+namespace rfk::generated { 
+static rfk::MetadataArena& getMetadataArena_15963945972659803745() noexcept {
+static rfk::MetadataArena arena;
+static bool initialized = false;
+if (!initialized) {
+initialized = true;
+arena.reserveEntities(rfk::EEntityKind::NamespaceFragment, 1u);
+arena.reserveEntities(rfk::EEntityKind::Class, 1u);
+arena.reserveEntities(rfk::EEntityKind::Method, 2u);
+}
+return arena; }
+}
 rfk::EEntityKind rfk::PropertySettings::getTargetEntityKind() const noexcept { return targetEntityKind; }
 static_assert(std::is_base_of_v<rfk::Property, rfk::PropertySettings>, "[Refureku] Can't attach rfk::PropertySettings property to rfk::PropertySettings as it doesn't inherit from rfk::Property.");
 namespace rfk::generated { 
  static rfk::NamespaceFragment const& getNamespaceFragment_6202377051882013391u_15963945972659803745() noexcept {
+static rfk::MetadataArenaScope metadataArenaScope(rfk::generated::getMetadataArena_15963945972659803745());
 static rfk::NamespaceFragment fragment("rfk", 6202377051882013391u);
 static bool initialized = false;
 if (!initialized) {
 initialized = true;
 fragment.setNestedEntitiesCapacity(1u);
 fragment.addNestedEntity(*rfk::getArchetype<rfk::PropertySettings>());
+metadataArenaScope.close();
 }
 return fragment; }
 static rfk::NamespaceFragmentRegisterer const namespaceFragmentRegisterer_6202377051882013391u_15963945972659803745(rfk::generated::getNamespaceFragment_6202377051882013391u_15963945972659803745());
  }
 rfk::Class const& rfk::PropertySettings::staticGetArchetype() noexcept {
 static bool initialized = false;
+static rfk::MetadataArenaScope metadataArenaScope(rfk::generated::getMetadataArena_15963945972659803745());
 static rfk::Class type("PropertySettings", 9343641787758265814u, sizeof(PropertySettings), 1);
 if (!initialized) {
 initialized = true;
+type.setMemoryAlignment(alignof(PropertySettings));
+type.setTraits(rfk::internal::CodeGenerationHelpers::computeArchetypeTraits<PropertySettings>());
 type.setPropertiesCapacity(1);
 static_assert((rfk::PropertySettings::targetEntityKind & rfk::EEntityKind::Class) != rfk::EEntityKind::Undefined, "[Refureku] rfk::PropertySettings can't be applied to a rfk::EEntityKind::Class");static rfk::PropertySettings property_9343641787758265814u_0{rfk::EEntityKind::Struct | rfk::EEntityKind::Class};type.addProperty(property_9343641787758265814u_0);
 type.setDirectParentsCapacity(1);
 type.addDirectParent(rfk::getArchetype<rfk::Property>(), static_cast<rfk::EAccessSpecifier>(1));
 PropertySettings::_rfk_registerChildClass<PropertySettings>(type);
-static rfk::StaticMethod defaultSharedInstantiator("", 0u, rfk::getType<rfk::SharedPtr<PropertySettings>>(),new rfk::NonMemberFunction<rfk::SharedPtr<PropertySettings>()>(&rfk::internal::CodeGenerationHelpers::defaultSharedInstantiator<PropertySettings>),rfk::EMethodFlags::Default, nullptr);
+static rfk::NonMemberFunction<rfk::SharedPtr<PropertySettings>()> defaultSharedInstantiatorCallable(&rfk::internal::CodeGenerationHelpers::defaultSharedInstantiator<PropertySettings>);
+static rfk::StaticMethod defaultSharedInstantiator("", 0u, rfk::getType<rfk::SharedPtr<PropertySettings>>(),defaultSharedInstantiatorCallable,rfk::EMethodFlags::Default, nullptr);
 type.addSharedInstantiator(defaultSharedInstantiator);
-static rfk::StaticMethod defaultUniqueInstantiator("", 0u, rfk::getType<rfk::UniquePtr<PropertySettings>>(),new rfk::NonMemberFunction<rfk::UniquePtr<PropertySettings>()>(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<PropertySettings>),rfk::EMethodFlags::Default, nullptr);
+static rfk::NonMemberFunction<rfk::UniquePtr<PropertySettings>()> defaultUniqueInstantiatorCallable(&rfk::internal::CodeGenerationHelpers::defaultUniqueInstantiator<PropertySettings>);
+static rfk::StaticMethod defaultUniqueInstantiator("", 0u, rfk::getType<rfk::UniquePtr<PropertySettings>>(),defaultUniqueInstantiatorCallable,rfk::EMethodFlags::Default, nullptr);
 type.addUniqueInstantiator(defaultUniqueInstantiator);
 type.setMethodsCapacity(0u); type.setStaticMethodsCapacity(0u); 
+metadataArenaScope.close();
 }
 return type; }
 
@@ -21,6 +21,12 @@ namespace rfk
 			/** Size in bytes an instance of this archetype takes in memory, basically what sizeof(Type) returns */
 			std::size_t			_memorySize			= 0;
 
+			/** Alignment requirement in bytes of an instance of this archetype, basically what alignof(Type) returns. 0 if unknown. */
+			std::size_t			_memoryAlignment	= 0;
+
+			/** Layout and lifetime traits of this archetype. */
+			EArchetypeTraits	_traits				= EArchetypeTraits::Default;
+
 		public:
 			inline ArchetypeImpl(char const*		name,
 								 std::size_t		id,
@@ -35,6 +41,20 @@ namespace rfk
 			*/
 			inline std::size_t		getMemorySize()					const	noexcept;
 
+			/**
+			*	@brief Getter for the field _memoryAlignment.
+			* 
+			*	@return _memoryAlignment.
+			*/
+			inline std::size_t		getMemoryAlignment()			const	noexcept;
+
+			/**
+			*	@brief Getter for the field _traits.
+			* 
+			*	@return _traits.
+			*/
+			inline EArchetypeTraits	getTraits()						const	noexcept;
+
 			/**
 			*	@brief Getter for the field _accessSpecifier.
 			* 
@@ -48,6 +68,20 @@ namespace rfk
 			*	@param The access specifier to set.
 			*/
 			inline void				setAccessSpecifier(EAccessSpecifier)	noexcept;
+
+			/**
+			*	@brief Setter for the field _memoryAlignment.
+			* 
+			*	@param The alignment to set.
+			*/
+			inline void				setMemoryAlignment(std::size_t)			noexcept;
+
+			/**
+			*	@brief Setter for the field _traits.
+			* 
+			*	@param The traits to set.
+			*/
+			inline void				setTraits(EArchetypeTraits)				noexcept;
 	};
 
 	#include "Refureku/TypeInfo/Archetypes/ArchetypeImpl.inl"
@@ -25,4 +25,24 @@ inline void Archetype::ArchetypeImpl::setAccessSpecifier(EAccessSpecifier access
 inline std::size_t Archetype::ArchetypeImpl::getMemorySize() const noexcept
 {
 	return _memorySize;
+}
+
+inline std::size_t Archetype::ArchetypeImpl::getMemoryAlignment() const noexcept
+{
+	return _memoryAlignment;
+}
+
+inline void Archetype::ArchetypeImpl::setMemoryAlignment(std::size_t memoryAlignment) noexcept
+{
+	_memoryAlignment = memoryAlignment;
+}
+
+inline EArchetypeTraits Archetype::ArchetypeImpl::getTraits() const noexcept
+{
+	return _traits;
+}
+
+inline void Archetype::ArchetypeImpl::setTraits(EArchetypeTraits traits) noexcept
+{
+	_traits = traits;
 }
\ No newline at end of file
@@ -8,6 +8,10 @@
 #pragma once
 
 #include <vector>
+#include <array>
+#include <unordered_map>
+#include <limits>		//std::numeric_limits
+#include <string_view>	//std::hash<std::string_view>
 
 #include "Refureku/TypeInfo/Archetypes/Enum.h"
 #include "Refureku/TypeInfo/Archetypes/ArchetypeImpl.h"
@@ -17,12 +21,109 @@ namespace rfk
 {
 	class Enum::EnumImpl final : public Archetype::ArchetypeImpl
 	{
+		public:
+			/** Index returned by the lookups when no enum value matches. */
+			static constexpr std::size_t	invalidIndex		= std::numeric_limits<std::size_t>::max();
+
+			/** Number of unused slots tolerated in the dense value index on top of 1 per enum value. */
+			static constexpr std::size_t	denseIndexSlack		= 16u;
+
 		private:
-			/** Values contained in this enum. */
-			std::vector<EnumValue>	_enumValues;
+			/** Values contained in this enum, in registration order. */
+			std::vector<EnumValue>							_enumValues;
+
+			/** For each enum value, index of the next enum value holding the same value, or invalidIndex. */
+			std::vector<std::size_t>						_nextSameValueIndices;
+
+			/** Index of each enum value, keyed by the hash of its name. */
+			std::unordered_multimap<std::size_t, std::size_t>	_indicesByNameHash;
+
+			/**
+			*	Index of the first enum value holding each value from _denseBaseValue, used when the values form a compact range.
+			*	The table covers at least [_minValue, _maxValue] and may hold unused slots below _minValue.
+			*/
+			std::vector<std::size_t>						_denseValueIndices;
+
+			/** Index of the first enum value holding each value, used when the values don't form a compact range. */
+			std::unordered_map<int64, std::size_t>			_sparseValueIndices;
+
+			/** Smallest value held by an enum value. */
+			int64											_minValue	= 0;
+
+			/** Greatest value held by an enum value. */
+			int64											_maxValue	= 0;
+
+			/** Value indexed by the first slot of _denseValueIndices. */
+			int64											_denseBaseValue	= 0;
+
+			/** Is the value index stored in _denseValueIndices or in _sparseValueIndices? */
+			bool											_isDense	= false;
+
+			/** Index of the first enum value holding exactly 1 << bit for each bit, or invalidIndex. */
+			std::array<std::size_t, 64u>					_flagEnumValueIndices;
+
+			/** Union of the enum values holding a single bit. */
+			uint64											_singleBitsMask		= 0u;
+
+			/** Union of the enum values holding several bits. */
+			uint64											_multipleBitsMask	= 0u;
+
+			/** Has the flag enum state been set explicitly, overriding its detection? */
+			bool											_isFlagEnumSet		= false;
+
+			/** Explicitly set flag enum state, only relevant if _isFlagEnumSet is true. */
+			bool											_isFlagEnum			= false;
 
 			/** Underlying type of this enum. */
-			Archetype const&			_underlyingArchetype;
+			Archetype const&								_underlyingArchetype;
+
+			/**
+			*	@brief Check whether the values in [minValue, maxValue] held by valuesCount enum values should be indexed by a dense table.
+			*
+			*	@return true if the dense table would have at most 2 slots per enum value plus denseIndexSlack, else false.
+			*/
+			static inline bool				isCompactRange(int64		minValue,
+														   int64		maxValue,
+														   std::size_t	valuesCount)				noexcept;
+
+			/**
+			*	@brief Compute the hash used to index an enum value name.
+			*
+			*	@param name Name to hash.
+			*
+			*	@return The hash of the name.
+			*/
+			static inline std::size_t		hashName(std::string_view name)							noexcept;
+
+			/**
+			*	@brief	Append an enum value to the chain of enum values holding the same value in the current value index.
+			*			The slot of the value must be allocated in the value index.
+			*
+			*	@param index Index of the enum value in _enumValues.
+			*/
+			inline void						linkEnumValue(std::size_t index)						noexcept;
+
+			/**
+			*	@brief Get the slot of a value in the dense value index.
+			*
+			*	@param value The value. Must be covered by the dense value index.
+			*
+			*	@return The slot of the value in _denseValueIndices.
+			*/
+			inline std::size_t				getDenseSlot(int64 value)						const	noexcept;
+
+			/**
+			*	@brief	Grow the dense value index so that it covers the provided value.
+			*			The table grows geometrically in both directions so that registering values in any monotonic order is amortized O(1).
+			*
+			*	@param value The value to cover.
+			*/
+			inline void						growDenseValueIndex(int64 value)						noexcept;
+
+			/**
+			*	@brief Rebuild the value index from scratch, as a dense table if _isDense is true, as a hash map otherwise.
+			*/
+			inline void						rebuildValueIndex()										noexcept;
 
 		public:
 			inline EnumImpl(char const*			name,
@@ -61,12 +162,84 @@ namespace rfk
 			*/
 			inline std::vector<EnumValue> const&	getEnumValues()							const	noexcept;
 
+			/**
+			*	@brief Get the index of the first registered enum value having the provided name.
+			*
+			*	@param name Name of the enum value to look for.
+			*
+			*	@return The index of the enum value in _enumValues if any, else invalidIndex.
+			*/
+			inline std::size_t						getEnumValueIndexByName(std::string_view name)	const	noexcept;
+
+			/**
+			*	@brief Get the index of the first registered enum value holding the provided value.
+			*
+			*	@param value Value of the enum value to look for.
+			*
+			*	@return The index of the enum value in _enumValues if any, else invalidIndex.
+			*/
+			inline std::size_t						getEnumValueIndex(int64 value)				const	noexcept;
+
+			/**
+			*	@brief Get the index of the next registered enum value holding the same value as the provided one.
+			*
+			*	@param index Index of an enum value in _enumValues.
+			*
+			*	@return The index of the next enum value holding the same value if any, else invalidIndex.
+			*/
+			inline std::size_t						getNextSameValueIndex(std::size_t index)	const	noexcept;
+
+			/**
+			*	@brief Get the index of the first registered enum value holding exactly 1 << bit.
+			*
+			*	@param bit Index of the bit, in [0, 64[.
+			*
+			*	@return The index of the enum value in _enumValues if any, else invalidIndex.
+			*/
+			inline std::size_t						getFlagEnumValueIndex(std::size_t bit)		const	noexcept;
+
+			/**
+			*	@brief	Get the bits of a value of this enum, masked to the size of the underlying type
+			*			so that negative values of a signed underlying type are not sign-extended.
+			*
+			*	@param value The value.
+			*
+			*	@return The bits of the value in the underlying type.
+			*/
+			inline uint64							getValueBits(int64 value)					const	noexcept;
+
+			/**
+			*	@brief	Check whether this enum is a flag enum.
+			*			Unless set with setFlagEnum, an enum is a flag enum if it has single bit values and all its
+			*			other non-zero values are combinations of them.
+			*
+			*	@return true if this enum is a flag enum, else false.
+			*/
+			inline bool								isFlagEnum()								const	noexcept;
+
+			/**
+			*	@brief Set whether this enum is a flag enum, overriding its detection.
+			*
+			*	@param isFlagEnum Is this enum a flag enum?
+			*/
+			inline void								setFlagEnum(bool isFlagEnum)						noexcept;
+
 			/**
 			*	@brief Getter for the field _underlyingArchetype.
 			* 
 			*	@return _underlyingArchetype.
 			*/
 			inline Archetype const&				getUnderlyingArchetype()				const	noexcept;
+
+			/**
+			*	@brief Get the size of this implementation, so that rfk::MetadataArena can reserve memory for rfk::Enum entities.
+			* 
+			*	@return The size in bytes of this implementation.
+			*/
+			friend constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<Enum>)	noexcept
+			{
+				return sizeof(EnumImpl);
+			}
 	};
 
 	#include "Refureku/TypeInfo/Archetypes/EnumImpl.inl"
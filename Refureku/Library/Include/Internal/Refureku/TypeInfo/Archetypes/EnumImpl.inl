@@ -9,16 +9,229 @@ inline Enum::EnumImpl::EnumImpl(char const* name, std::size_t id, Archetype cons
 	ArchetypeImpl(name, id, EEntityKind::Enum, underlyingArchetype->getMemorySize(), outerEntity),
 	_underlyingArchetype{*underlyingArchetype}
 {
+	//An enum shares the layout and traits of its underlying type
+	setMemoryAlignment(underlyingArchetype->getMemoryAlignment());
+	setTraits(underlyingArchetype->getTraits());
+
+	_flagEnumValueIndices.fill(invalidIndex);
+}
+
+inline bool Enum::EnumImpl::isCompactRange(int64 minValue, int64 maxValue, std::size_t valuesCount) noexcept
+{
+	//Unsigned difference so that the full int64 range doesn't overflow
+	return static_cast<uint64>(maxValue) - static_cast<uint64>(minValue) < 2u * static_cast<uint64>(valuesCount) + denseIndexSlack;
+}
+
+inline std::size_t Enum::EnumImpl::hashName(std::string_view name) noexcept
+{
+	return std::hash<std::string_view>()(name);
+}
+
+inline void Enum::EnumImpl::linkEnumValue(std::size_t index) noexcept
+{
+	int64		value	= _enumValues[index].getValue();
+	std::size_t& first	= _isDense ?
+								_denseValueIndices[getDenseSlot(value)] :
+								_sparseValueIndices.try_emplace(value, invalidIndex).first->second;
+
+	if (first == invalidIndex)
+	{
+		first = index;
+	}
+	else
+	{
+		//Keep the registration order among enum values holding the same value
+		std::size_t last = first;
+
+		while (_nextSameValueIndices[last] != invalidIndex)
+		{
+			last = _nextSameValueIndices[last];
+		}
+
+		_nextSameValueIndices[last] = index;
+	}
+}
+
+inline std::size_t Enum::EnumImpl::getDenseSlot(int64 value) const noexcept
+{
+	//Unsigned difference so that the full int64 range doesn't overflow
+	return static_cast<std::size_t>(static_cast<uint64>(value) - static_cast<uint64>(_denseBaseValue));
+}
+
+inline void Enum::EnumImpl::growDenseValueIndex(int64 value) noexcept
+{
+	if (value < _denseBaseValue)
+	{
+		//Prepend at least as many slots as the table already holds, without going below the smallest int64
+		uint64 missingSlots	= static_cast<uint64>(_denseBaseValue) - static_cast<uint64>(value);
+		uint64 extraSlots	= (_denseValueIndices.size() > missingSlots) ? _denseValueIndices.size() - missingSlots : 0u;
+		uint64 headroom		= static_cast<uint64>(value) - static_cast<uint64>(std::numeric_limits<int64>::min());
+		uint64 addedSlots	= missingSlots + ((extraSlots < headroom) ? extraSlots : headroom);
+
+		_denseValueIndices.insert(_denseValueIndices.begin(), static_cast<std::size_t>(addedSlots), invalidIndex);
+		_denseBaseValue = static_cast<int64>(static_cast<uint64>(_denseBaseValue) - addedSlots);
+	}
+	else if (getDenseSlot(value) >= _denseValueIndices.size())
+	{
+		//The vector capacity already grows geometrically when appending slots
+		_denseValueIndices.resize(getDenseSlot(value) + 1u, invalidIndex);
+	}
+}
+
+inline void Enum::EnumImpl::rebuildValueIndex() noexcept
+{
+	if (_isDense)
+	{
+		_denseBaseValue = _minValue;
+		_sparseValueIndices = std::unordered_map<int64, std::size_t>();
+		_denseValueIndices.assign(static_cast<std::size_t>(static_cast<uint64>(_maxValue) - static_cast<uint64>(_minValue)) + 1u, invalidIndex);
+	}
+	else
+	{
+		_denseValueIndices = std::vector<std::size_t>();
+		_sparseValueIndices.clear();
+		_sparseValueIndices.reserve(_enumValues.capacity());
+	}
+
+	for (std::size_t i = 0u; i < _enumValues.size(); i++)
+	{
+		_nextSameValueIndices[i] = invalidIndex;
+		linkEnumValue(i);
+	}
 }
 
 inline EnumValue& Enum::EnumImpl::addEnumValue(char const* name, std::size_t id, int64 value, Enum const*	backRef) noexcept
 {
-	return _enumValues.emplace_back(name, id, value, backRef);
+	std::size_t	index		= _enumValues.size();
+	EnumValue&	result		= _enumValues.emplace_back(name, id, value, backRef);
+	bool		wasDense	= _isDense;
+
+	_nextSameValueIndices.push_back(invalidIndex);
+	_indicesByNameHash.emplace(hashName(name), index);
+
+	//Index single bit values for flag decomposition
+	uint64 bits = getValueBits(value);
+
+	if (bits != 0u && (bits & (bits - 1u)) == 0u)
+	{
+		std::size_t bit = 0u;
+
+		while ((bits >> bit) != 1u)
+		{
+			bit++;
+		}
+
+		if (_flagEnumValueIndices[bit] == invalidIndex)
+		{
+			_flagEnumValueIndices[bit] = index;
+		}
+
+		_singleBitsMask |= bits;
+	}
+	else
+	{
+		_multipleBitsMask |= bits;
+	}
+
+	if (index == 0u)
+	{
+		_minValue = _maxValue = value;
+	}
+	else
+	{
+		_minValue = (value < _minValue) ? value : _minValue;
+		_maxValue = (value > _maxValue) ? value : _maxValue;
+	}
+
+	_isDense = isCompactRange(_minValue, _maxValue, _enumValues.size());
+
+	//The value index is only rebuilt when switching between the dense and sparse representations
+	if (index == 0u || _isDense != wasDense)
+	{
+		rebuildValueIndex();
+	}
+	else
+	{
+		if (_isDense)
+		{
+			growDenseValueIndex(value);
+		}
+
+		linkEnumValue(index);
+	}
+
+	return result;
 }
 
 inline void Enum::EnumImpl::setEnumValuesCapacity(std::size_t capacity) noexcept
 {
 	_enumValues.reserve(capacity);
+	_nextSameValueIndices.reserve(capacity);
+	_indicesByNameHash.reserve(capacity);
+}
+
+inline std::size_t Enum::EnumImpl::getEnumValueIndexByName(std::string_view name) const noexcept
+{
+	std::size_t result = invalidIndex;
+	auto		range	= _indicesByNameHash.equal_range(hashName(name));
+
+	//Hash collisions are resolved by comparing names, the first registered enum value wins
+	for (auto it = range.first; it != range.second; it++)
+	{
+		if (it->second < result && name == _enumValues[it->second].getName())
+		{
+			result = it->second;
+		}
+	}
+
+	return result;
+}
+
+inline std::size_t Enum::EnumImpl::getEnumValueIndex(int64 value) const noexcept
+{
+	if (_enumValues.empty() || value < _minValue || value > _maxValue)
+	{
+		return invalidIndex;
+	}
+
+	if (_isDense)
+	{
+		return _denseValueIndices[getDenseSlot(value)];
+	}
+	else
+	{
+		auto it = _sparseValueIndices.find(value);
+
+		return (it != _sparseValueIndices.end()) ? it->second : invalidIndex;
+	}
+}
+
+inline std::size_t Enum::EnumImpl::getNextSameValueIndex(std::size_t index) const noexcept
+{
+	return _nextSameValueIndices[index];
+}
+
+inline std::size_t Enum::EnumImpl::getFlagEnumValueIndex(std::size_t bit) const noexcept
+{
+	return (bit < _flagEnumValueIndices.size()) ? _flagEnumValueIndices[bit] : invalidIndex;
+}
+
+inline uint64 Enum::EnumImpl::getValueBits(int64 value) const noexcept
+{
+	std::size_t bitsCount = _underlyingArchetype.getMemorySize() * 8u;
+
+	return (bitsCount < 64u) ? static_cast<uint64>(value) & ((uint64(1u) << bitsCount) - 1u) : static_cast<uint64>(value);
+}
+
+inline bool Enum::EnumImpl::isFlagEnum() const noexcept
+{
+	return _isFlagEnumSet ? _isFlagEnum : (_singleBitsMask != 0u && (_multipleBitsMask & ~_singleBitsMask) == 0u);
+}
+
+inline void Enum::EnumImpl::setFlagEnum(bool isFlagEnum) noexcept
+{
+	_isFlagEnumSet	= true;
+	_isFlagEnum		= isFlagEnum;
 }
 
 inline std::vector<EnumValue> const& Enum::EnumImpl::getEnumValues() const noexcept
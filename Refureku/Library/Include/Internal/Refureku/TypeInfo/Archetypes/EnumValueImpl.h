@@ -30,6 +30,16 @@ namespace rfk
 			*	@return _value.
 			*/
 			inline int64 getValue() const noexcept;
+
+			/**
+			*	@brief Get the size of this implementation, so that rfk::MetadataArena can reserve memory for rfk::EnumValue entities.
+			* 
+			*	@return The size in bytes of this implementation.
+			*/
+			friend constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<EnumValue>)	noexcept
+			{
+				return sizeof(EnumValueImpl);
+			}
 	};
 
 	#include "Refureku/TypeInfo/Archetypes/EnumValueImpl.inl"
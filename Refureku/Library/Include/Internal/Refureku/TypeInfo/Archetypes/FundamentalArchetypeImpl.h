@@ -13,9 +13,21 @@ namespace rfk
 	class FundamentalArchetype::FundamentalArchetypeImpl final : public Archetype::ArchetypeImpl
 	{
 		public:
-			inline FundamentalArchetypeImpl(char const*	name,
-											std::size_t	id,
-											std::size_t	memorySize)	noexcept;
+			inline FundamentalArchetypeImpl(char const*			name,
+											std::size_t			id,
+											std::size_t			memorySize,
+											std::size_t			memoryAlignment,
+											EArchetypeTraits	traits)		noexcept;
+
+			/**
+			*	@brief Get the size of this implementation, so that rfk::MetadataArena can reserve memory for rfk::FundamentalArchetype entities.
+			* 
+			*	@return The size in bytes of this implementation.
+			*/
+			friend constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<FundamentalArchetype>)	noexcept
+			{
+				return sizeof(FundamentalArchetypeImpl);
+			}
 	};
 
 	#include "Refureku/TypeInfo/Archetypes/FundamentalArchetypeImpl.inl"
@@ -5,7 +5,10 @@
 *	See the LICENSE.md file for full license details.
 */
 
-inline FundamentalArchetype::FundamentalArchetypeImpl::FundamentalArchetypeImpl(char const* name, std::size_t id, std::size_t memorySize) noexcept:
+inline FundamentalArchetype::FundamentalArchetypeImpl::FundamentalArchetypeImpl(char const* name, std::size_t id, std::size_t memorySize,
+																		   std::size_t memoryAlignment, EArchetypeTraits traits) noexcept:
 	ArchetypeImpl(name, id, EEntityKind::FundamentalArchetype, memorySize)
 {
+	setMemoryAlignment(memoryAlignment);
+	setTraits(traits);
 }
\ No newline at end of file
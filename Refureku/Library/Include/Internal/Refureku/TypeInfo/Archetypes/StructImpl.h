@@ -9,6 +9,9 @@
 
 #include <unordered_set>
 #include <unordered_map>
+#include <memory>	//std::unique_ptr
+#include <mutex>	//std::once_flag
+#include <atomic>
 #include <cstddef> //std::ptrdiff_t
 #include <cassert>
 
@@ -21,6 +24,7 @@
 #include "Refureku/TypeInfo/Variables/StaticField.h"
 #include "Refureku/TypeInfo/Functions/Method.h"
 #include "Refureku/TypeInfo/Functions/NonMemberFunction.h"
+#include "Refureku/Serialization/BinarySchema.h"
 #include "Refureku/Misc/Algorithm.h"
 
 namespace rfk
@@ -68,7 +72,25 @@ namespace rfk
 			/** Kind of a rfk::Struct or rfk::Class instance. */
 			EClassKind			_classKind;
 
+			/** Flag used to build the binary schema only once. */
+			mutable std::once_flag						_binarySchemaOnceFlag;
+
+			/** Binary schema of the struct, built on first use. */
+			mutable std::unique_ptr<BinarySchema>		_binarySchema;
+
+			/** Built binary schema, published once built so that later calls skip std::call_once which is costly on hot serialization paths. */
+			mutable std::atomic<BinarySchema const*>	_builtBinarySchema{nullptr};
+
+			/** Dirty tracker attached to the struct. Atomic since fields read it on each write while it may be attached from another thread. */
+			std::atomic<DirtyTracker*>					_dirtyTracker{nullptr};
+
+			/** Dense index given to the struct when it or a child struct is first attached to an entity as a property. */
+			mutable std::atomic<std::size_t>			_propertyIndex{invalidPropertyIndex};
+
 		public:
+			/** Property index of a struct which was never attached to an entity as a property. */
+			static constexpr std::size_t	invalidPropertyIndex = static_cast<std::size_t>(-1);
+
 			inline StructImpl(char const*	name,
 							  std::size_t	id,
 							  std::size_t	memorySize,
@@ -223,7 +245,8 @@ namespace rfk
 			*	@param name				Name of the method.
 			*	@param id				Unique entity id of the method.
 			*	@param returnType		Return type of the method call.
-			*	@param internalMethod	Pointer to the actual method.
+			*	@param internalMethod	The actual method. The pointer overload takes ownership of the callable,
+			*							the reference overload expects it to outlive the struct (static storage).
 			*	@param flags			Method flags.
 			*	@param outerEntity		Struct containing the method declaration.
 			*
@@ -235,6 +258,12 @@ namespace rfk
 																  ICallable*	internalMethod,
 																  EMethodFlags	flags,
 																  Struct const*	outerEntity)							noexcept;
+			RFK_NODISCARD inline Method*				addMethod(char const*	name,
+																  std::size_t	id,
+																  Type const&	returnType,
+																  ICallable&	internalMethod,
+																  EMethodFlags	flags,
+																  Struct const*	outerEntity)							noexcept;
 
 			/**
 			*	@brief Add a static method to the struct.
@@ -242,7 +271,8 @@ namespace rfk
 			*	@param methodName		Name of the static method.
 			*	@param id				Unique entity id of the static method.
 			*	@param returnType		Return type of the static method call.
-			*	@param internalMethod	Dynamically allocated NonMemberFunction storing the underlying static method.
+			*	@param internalMethod	NonMemberFunction storing the underlying static method. The pointer overload takes ownership of the callable,
+			*							the reference overload expects it to outlive the struct (static storage).
 			*	@param flags			Method flags.
 			*	@param outerEntity		Struct containing the static method declaration.
 			*
@@ -254,6 +284,12 @@ namespace rfk
 																		ICallable*		internalMethod,
 																		EMethodFlags	flags,
 																		Struct const*	outerEntity)					noexcept;
+			RFK_NODISCARD inline StaticMethod*			addStaticMethod(char const*		name,
+																		std::size_t		id,
+																		Type const&		returnType,
+																		ICallable&		internalMethod,
+																		EMethodFlags	flags,
+																		Struct const*	outerEntity)					noexcept;
 
 			/**
 			*	@brief	Add a new way to instantiate this struct through the makeSharedInstance method.
@@ -363,6 +399,70 @@ namespace rfk
 			*	@return _classKind.
 			*/
 			RFK_NODISCARD inline EClassKind					getClassKind()										const	noexcept;
+
+			/**
+			*	@brief Getter for the field _binarySchema. Build the schema on the first call.
+			* 
+			*	@param backRef The struct owning this implementation.
+			* 
+			*	@return _binarySchema.
+			*/
+			RFK_NODISCARD inline BinarySchema const&		getBinarySchema(Struct const& backRef)				const;
+
+			/**
+			*	@brief Getter for the field _dirtyTracker.
+			* 
+			*	@return _dirtyTracker.
+			*/
+			RFK_NODISCARD inline DirtyTracker*				getDirtyTracker()									const	noexcept;
+
+			/**
+			*	@brief Setter for the field _dirtyTracker.
+			* 
+			*	@param dirtyTracker The dirty tracker to attach, or nullptr to detach the current one.
+			*/
+			inline void										setDirtyTracker(DirtyTracker* dirtyTracker)					noexcept;
+
+			/**
+			*	@brief Detach the provided dirty tracker if it is still the one attached to the struct.
+			* 
+			*	@param dirtyTracker The dirty tracker to detach.
+			*/
+			inline void										detachDirtyTracker(DirtyTracker* dirtyTracker)				noexcept;
+
+			/**
+			*	@brief Getter for the field _dirtyTracker slot.
+			* 
+			*	@return _dirtyTracker.
+			*/
+			RFK_NODISCARD inline std::atomic<DirtyTracker*> const&	getDirtyTrackerSlot()						const	noexcept;
+
+			/**
+			*	@brief Getter for the field _propertyIndex.
+			* 
+			*	@return _propertyIndex.
+			*/
+			RFK_NODISCARD inline std::size_t				getPropertyIndex()									const	noexcept;
+
+			/**
+			*	@brief	Set the field _propertyIndex if the struct has no property index yet.
+			*			Safe to call concurrently: only the first call gives its index to the struct.
+			* 
+			*	@param propertyIndex The property index of the struct.
+			* 
+			*	@return The property index of the struct, which is either propertyIndex or the index set by a previous call.
+			*/
+			inline std::size_t								trySetPropertyIndex(std::size_t propertyIndex)		const	noexcept;
+
+			/**
+			*	@brief Get the size of this implementation, so that rfk::MetadataArena can reserve memory for rfk::Struct entities.
+			* 
+			*	@return The size in bytes of this implementation.
+			*/
+			friend constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<Struct>)	noexcept
+			{
+				return sizeof(StructImpl);
+			}
 	};
 
 	#include "Refureku/TypeInfo/Archetypes/StructImpl.inl"
@@ -56,7 +56,7 @@ inline Field* Struct::StructImpl::addField(char const* name, std::size_t id, Typ
 	assert((flags & EFieldFlags::Static) != EFieldFlags::Static);
 
 	//The hash is based on the field name which is immutable, so it's safe to const_cast to update other members.
-	return const_cast<Field*>(&*_fields.emplace(name, id, type, flags, owner, memoryOffset, outerEntity));
+	return const_cast<Field*>(&*_fields.emplace(name, id, type, flags, owner, memoryOffset, _fields.size(), outerEntity));
 }
 
 inline StaticField* Struct::StructImpl::addStaticField(char const* name, std::size_t id, Type const& type, EFieldFlags flags, 
@@ -99,6 +99,26 @@ inline StaticMethod* Struct::StructImpl::addStaticMethod(char const* name, std::
 	return const_cast<StaticMethod*>(&*_staticMethods.emplace(name, id, returnType, internalMethod, flags, outerEntity));
 }
 
+inline Method* Struct::StructImpl::addMethod(char const* name, std::size_t id, Type const& returnType,
+											 ICallable& internalMethod, EMethodFlags flags, Struct const*	outerEntity) noexcept
+{
+	assert(name != nullptr);
+	assert((flags & EMethodFlags::Static) != EMethodFlags::Static);
+
+	//The hash is based on the method name which is immutable, so it's safe to const_cast to update other members.
+	return const_cast<Method*>(&*_methods.emplace(name, id, returnType, internalMethod, flags, outerEntity));
+}
+
+inline StaticMethod* Struct::StructImpl::addStaticMethod(char const* name, std::size_t id, Type const& returnType,
+														 ICallable& internalMethod, EMethodFlags flags, Struct const* outerEntity) noexcept
+{
+	assert(name != nullptr);
+	assert((flags & EMethodFlags::Static) == EMethodFlags::Static);
+
+	//The hash is based on the static method name which is immutable, so it's safe to const_cast to update other members.
+	return const_cast<StaticMethod*>(&*_staticMethods.emplace(name, id, returnType, internalMethod, flags, outerEntity));
+}
+
 inline void Struct::StructImpl::addSharedInstantiator(StaticMethod const& instantiator) noexcept
 {
 	std::size_t parametersCount = instantiator.getParametersCount();
@@ -269,4 +289,55 @@ inline Struct::StructImpl::Instantiators const& Struct::StructImpl::getUniqueIns
 inline EClassKind Struct::StructImpl::getClassKind() const noexcept
 {
 	return _classKind;
+}
+
+inline BinarySchema const& Struct::StructImpl::getBinarySchema(Struct const& backRef) const
+{
+	BinarySchema const* binarySchema = _builtBinarySchema.load(std::memory_order_acquire);
+
+	if (binarySchema == nullptr)
+	{
+		std::call_once(_binarySchemaOnceFlag, [this, &backRef]()
+					   {
+						   _binarySchema.reset(new BinarySchema(backRef));
+						   _builtBinarySchema.store(_binarySchema.get(), std::memory_order_release);
+					   });
+
+		binarySchema = _binarySchema.get();
+	}
+
+	return *binarySchema;
+}
+
+inline DirtyTracker* Struct::StructImpl::getDirtyTracker() const noexcept
+{
+	return _dirtyTracker.load(std::memory_order_acquire);
+}
+
+inline void Struct::StructImpl::setDirtyTracker(DirtyTracker* dirtyTracker) noexcept
+{
+	_dirtyTracker.store(dirtyTracker, std::memory_order_release);
+}
+
+inline void Struct::StructImpl::detachDirtyTracker(DirtyTracker* dirtyTracker) noexcept
+{
+	_dirtyTracker.compare_exchange_strong(dirtyTracker, nullptr, std::memory_order_acq_rel);
+}
+
+inline std::atomic<DirtyTracker*> const& Struct::StructImpl::getDirtyTrackerSlot() const noexcept
+{
+	return _dirtyTracker;
+}
+
+inline std::size_t Struct::StructImpl::getPropertyIndex() const noexcept
+{
+	return _propertyIndex.load(std::memory_order_relaxed);
+}
+
+inline std::size_t Struct::StructImpl::trySetPropertyIndex(std::size_t propertyIndex) const noexcept
+{
+	std::size_t expected = invalidPropertyIndex;
+
+	//On failure, expected receives the index set by the other call
+	return _propertyIndex.compare_exchange_strong(expected, propertyIndex, std::memory_order_relaxed) ? propertyIndex : expected;
 }
\ No newline at end of file
@@ -9,16 +9,28 @@
 
 #include <vector>
 #include <unordered_set>
+#include <unordered_map>
+#include <cstring>	//std::memcpy
 
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplate.h"
 #include "Refureku/TypeInfo/Archetypes/StructImpl.h"
 #include "Refureku/TypeInfo/Archetypes/Template/TemplateParameter.h"
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateInstantiation.h"
+#include "Refureku/TypeInfo/Archetypes/Template/TemplateArgument.h"
+#include "Refureku/TypeInfo/Archetypes/Template/TypeTemplateArgument.h"
+#include "Refureku/TypeInfo/Archetypes/Template/NonTypeTemplateArgument.h"
+#include "Refureku/TypeInfo/Archetypes/Template/TemplateTemplateArgument.h"
+#include "Refureku/TypeInfo/Archetypes/Template/ETemplateParameterKind.h"
+#include "Refureku/TypeInfo/Type.h"
+#include "Refureku/TypeInfo/TypePart.h"
 
 namespace rfk
 {
 	class ClassTemplate::ClassTemplateImpl final : public Struct::StructImpl
 	{
+		public:
+			using InstantiationsByHash = std::unordered_multimap<std::size_t, ClassTemplateInstantiation const*>;
+
 		private:
 			/** List of all template parameters of this class template. */
 			std::vector<TemplateParameter const*>					_templateParameters;
@@ -26,6 +38,26 @@ namespace rfk
 			/** All different instantiations of this class template in the program (with different template parameters). */
 			std::unordered_set<ClassTemplateInstantiation const*>	_templateInstantiations;
 
+			/** Template instantiations hashed by the combined hash of all their template arguments. */
+			InstantiationsByHash									_instantiationsByArguments;
+
+			/** For each template argument index, template instantiations hashed by their template argument at this index. */
+			std::vector<InstantiationsByHash>						_instantiationsByArgumentAt;
+
+			/** Greatest number of template arguments of a template instantiation registered so far. */
+			std::size_t												_maxTemplateArgumentsCount = 0u;
+
+			/**
+			*	@brief Combine 2 hashes together.
+			* 
+			*	@param seed Hash to combine value with.
+			*	@param value Hash to combine.
+			* 
+			*	@return The combined hash.
+			*/
+			RFK_NODISCARD static inline std::size_t	combineHash(std::size_t seed,
+																std::size_t value)	noexcept;
+
 		public:
 			inline ClassTemplateImpl(char const*	name,
 									 std::size_t	id,
@@ -65,6 +97,48 @@ namespace rfk
 			*	@return _templateInstantiations.
 			*/
 			RFK_NODISCARD inline std::unordered_set<ClassTemplateInstantiation const*> const&	getTemplateInstantiations()												const	noexcept;
+
+			/**
+			*	@brief Getter for the field _instantiationsByArguments.
+			* 
+			*	@return _instantiationsByArguments.
+			*/
+			RFK_NODISCARD inline InstantiationsByHash const&									getInstantiationsByArguments()											const	noexcept;
+
+			/**
+			*	@brief Getter for the field _instantiationsByArgumentAt.
+			* 
+			*	@return _instantiationsByArgumentAt.
+			*/
+			RFK_NODISCARD inline std::vector<InstantiationsByHash> const&						getInstantiationsByArgumentAt()											const	noexcept;
+
+			/**
+			*	@brief Getter for the field _maxTemplateArgumentsCount.
+			* 
+			*	@return _maxTemplateArgumentsCount.
+			*/
+			RFK_NODISCARD inline std::size_t													getMaxTemplateArgumentsCount()											const	noexcept;
+
+			/**
+			*	@brief	Compute the hash of a template argument.
+			*			2 equal template arguments (see TemplateArgument::operator==) have the same hash.
+			* 
+			*	@param argument The hashed template argument.
+			* 
+			*	@return The hash of the template argument.
+			*/
+			RFK_NODISCARD static inline std::size_t												computeTemplateArgumentHash(TemplateArgument const& argument)					noexcept;
+
+			/**
+			*	@brief Compute the combined hash of a list of template arguments.
+			* 
+			*	@param args			Pointer to the first template argument pointer. None of the pointed arguments can be nullptr.
+			*	@param argsCount	Number of template arguments.
+			* 
+			*	@return The combined hash of the template arguments.
+			*/
+			RFK_NODISCARD static inline std::size_t												computeTemplateArgumentsHash(TemplateArgument const* const*	args,
+																																 std::size_t					argsCount)	noexcept;
 	};
 
 	#include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateImpl.inl"
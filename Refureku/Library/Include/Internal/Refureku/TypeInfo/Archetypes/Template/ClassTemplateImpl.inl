@@ -12,12 +12,69 @@ inline ClassTemplate::ClassTemplateImpl::ClassTemplateImpl(char const* name, std
 
 inline void ClassTemplate::ClassTemplateImpl::addTemplateInstantiation(ClassTemplateInstantiation const& instantiation) noexcept
 {
-	_templateInstantiations.insert(&instantiation);
+	if (!_templateInstantiations.insert(&instantiation).second)
+	{
+		return;
+	}
+
+	std::size_t	argsCount	= instantiation.getTemplateArgumentsCount();
+	std::size_t	argsHash	= argsCount;
+
+	if (argsCount > _instantiationsByArgumentAt.size())
+	{
+		_instantiationsByArgumentAt.resize(argsCount);
+	}
+
+	for (std::size_t i = 0u; i < argsCount; i++)
+	{
+		std::size_t argHash = computeTemplateArgumentHash(instantiation.getTemplateArgumentAt(i));
+
+		_instantiationsByArgumentAt[i].emplace(argHash, &instantiation);
+		argsHash = combineHash(argsHash, argHash);
+	}
+
+	_instantiationsByArguments.emplace(argsHash, &instantiation);
+
+	if (argsCount > _maxTemplateArgumentsCount)
+	{
+		_maxTemplateArgumentsCount = argsCount;
+	}
 }
 
 inline void ClassTemplate::ClassTemplateImpl::removeTemplateInstantiation(ClassTemplateInstantiation const& instantiation) noexcept
 {
-	_templateInstantiations.erase(&instantiation);
+	if (_templateInstantiations.erase(&instantiation) == 0u)
+	{
+		return;
+	}
+
+	//The template arguments of the instantiation didn't change since it was added, so the hashes are the same
+	auto eraseFromIndex = [&instantiation](InstantiationsByHash& index, std::size_t hash)
+	{
+		auto range = index.equal_range(hash);
+
+		for (auto it = range.first; it != range.second; it++)
+		{
+			if (it->second == &instantiation)
+			{
+				index.erase(it);
+				break;
+			}
+		}
+	};
+
+	std::size_t	argsCount	= instantiation.getTemplateArgumentsCount();
+	std::size_t	argsHash	= argsCount;
+
+	for (std::size_t i = 0u; i < argsCount; i++)
+	{
+		std::size_t argHash = computeTemplateArgumentHash(instantiation.getTemplateArgumentAt(i));
+
+		eraseFromIndex(_instantiationsByArgumentAt[i], argHash);
+		argsHash = combineHash(argsHash, argHash);
+	}
+
+	eraseFromIndex(_instantiationsByArguments, argsHash);
 }
 
 inline void ClassTemplate::ClassTemplateImpl::addTemplateParameter(TemplateParameter const& param) noexcept
@@ -33,4 +90,86 @@ inline std::vector<TemplateParameter const*> const& ClassTemplate::ClassTemplate
 inline std::unordered_set<ClassTemplateInstantiation const*> const& ClassTemplate::ClassTemplateImpl::getTemplateInstantiations() const noexcept
 {
 	return _templateInstantiations;
+}
+
+inline ClassTemplate::ClassTemplateImpl::InstantiationsByHash const& ClassTemplate::ClassTemplateImpl::getInstantiationsByArguments() const noexcept
+{
+	return _instantiationsByArguments;
+}
+
+inline std::vector<ClassTemplate::ClassTemplateImpl::InstantiationsByHash> const& ClassTemplate::ClassTemplateImpl::getInstantiationsByArgumentAt() const noexcept
+{
+	return _instantiationsByArgumentAt;
+}
+
+inline std::size_t ClassTemplate::ClassTemplateImpl::getMaxTemplateArgumentsCount() const noexcept
+{
+	return _maxTemplateArgumentsCount;
+}
+
+inline std::size_t ClassTemplate::ClassTemplateImpl::combineHash(std::size_t seed, std::size_t value) noexcept
+{
+	return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+inline std::size_t ClassTemplate::ClassTemplateImpl::computeTemplateArgumentHash(TemplateArgument const& argument) noexcept
+{
+	std::size_t result = static_cast<std::size_t>(argument.getKind());
+
+	switch (argument.getKind())
+	{
+		case ETemplateParameterKind::TypeTemplateParameter:
+		{
+			Type const& type = static_cast<TypeTemplateArgument const&>(argument).getType();
+
+			result = combineHash(result, std::hash<Archetype const*>()(type.getArchetype()));
+
+			//Type parts are compared with std::memcmp, so hash their bytes as well
+			for (std::size_t i = 0u; i < type.getTypePartsCount(); i++)
+			{
+				uint64 typePartBytes;
+				std::memcpy(&typePartBytes, &type.getTypePartAt(i), sizeof(TypePart));
+
+				result = combineHash(result, std::hash<uint64>()(typePartBytes));
+			}
+			break;
+		}
+
+		case ETemplateParameterKind::NonTypeTemplateParameter:
+		{
+			NonTypeTemplateArgument const&	nonTypeArgument	= static_cast<NonTypeTemplateArgument const&>(argument);
+			Archetype const*				valueArchetype	= nonTypeArgument.getArchetype();
+
+			result = combineHash(result, std::hash<Archetype const*>()(valueArchetype));
+
+			if (valueArchetype != nullptr)
+			{
+				unsigned char const* value = reinterpret_cast<unsigned char const*>(nonTypeArgument.getValuePtr());
+
+				for (std::size_t i = 0u; i < valueArchetype->getMemorySize(); i++)
+				{
+					result = combineHash(result, value[i]);
+				}
+			}
+			break;
+		}
+
+		case ETemplateParameterKind::TemplateTemplateParameter:
+			result = combineHash(result, std::hash<ClassTemplate const*>()(static_cast<TemplateTemplateArgument const&>(argument).getClassTemplate()));
+			break;
+	}
+
+	return result;
+}
+
+inline std::size_t ClassTemplate::ClassTemplateImpl::computeTemplateArgumentsHash(TemplateArgument const* const* args, std::size_t argsCount) noexcept
+{
+	std::size_t result = argsCount;
+
+	for (std::size_t i = 0u; i < argsCount; i++)
+	{
+		result = combineHash(result, computeTemplateArgumentHash(*args[i]));
+	}
+
+	return result;
 }
\ No newline at end of file
@@ -12,9 +12,13 @@
 #include <vector>
 #include <cassert>
 #include <iostream>
+#include <mutex>
+#include <new>	//std::bad_alloc
 
 #include "Refureku/Misc/SharedPtr.h"
+#include "Refureku/Misc/UniquePtr.h"
 #include "Refureku/TypeInfo/Database.h"
+#include "Refureku/TypeInfo/DispatchTable.h"
 #include "Refureku/TypeInfo/Entity/EntityHash.h"
 #include "Refureku/TypeInfo/Namespace/Namespace.h"
 #include "Refureku/TypeInfo/Namespace/NamespaceFragment.h"
@@ -43,6 +47,8 @@ namespace rfk
 			using FunctionsByName				= std::unordered_multiset<Function const*, EntityPtrNameHash, EntityPtrNameEqual>;
 			using FundamentalArchetypesByName	= std::unordered_set<FundamentalArchetype const*, EntityPtrNameHash, EntityPtrNameEqual>;
 			using GenNamespaces					= std::unordered_map<std::size_t, SharedPtr<Namespace>>;
+			using DispatchTables				= std::unordered_map<Struct const*, UniquePtr<DispatchTable>>;
+			using EntitiesByProperty			= std::unordered_map<Struct const*, std::unordered_set<Entity const*>>;
 			
 		private:
 			/** Collection of all registered entities hashed by Id.  */
@@ -72,6 +78,15 @@ namespace rfk
 			/** Collection of namespace objects generated by the database. */
 			GenNamespaces				_generatedNamespaces;
 
+			/** Dispatch tables hashed by indexed property archetype. Tables are built on demand from the const database. */
+			mutable DispatchTables		_dispatchTables;
+
+			/** Mutex protecting _dispatchTables, since tables can be built by concurrent readers of the database. */
+			mutable std::mutex			_dispatchTablesMutex;
+
+			/** Registered entities hashed by the exact archetype of the properties they carry. Empty sets are removed. */
+			EntitiesByProperty			_entitiesByProperty;
+
 			/**
 			*	@brief Register an entity to the database.
 			*	
@@ -128,6 +143,45 @@ namespace rfk
 			*/
 			inline void		unregisterEnumSubEntities(Enum const& e)								noexcept;
 
+			/**
+			*	@brief	Add an entity to all the dispatch tables indexing one of its properties.
+			*			Registration is noexcept, so a table which fails to grow is flagged instead of propagating std::bad_alloc,
+			*			and is rebuilt by the next getOrCreateDispatchTable call.
+			*	
+			*	@param entity The registered entity. Entities which are not functions or methods are ignored.
+			*/
+			inline void		addToDispatchTables(Entity const& entity)								noexcept;
+
+			/**
+			*	@brief Remove an entity from all the dispatch tables indexing it.
+			*	
+			*	@param entity The unregistered entity. Entities which are not functions or methods are ignored.
+			*/
+			inline void		removeFromDispatchTables(Entity const& entity)							noexcept;
+
+			/**
+			*	@brief Clear a dispatch table and index all the registered functions and methods carrying its property.
+			*	
+			*	@param dispatchTable The table to fill.
+			*
+			*	@exception std::bad_alloc if the table entries could not be allocated.
+			*/
+			inline void		fillDispatchTable(DispatchTable& dispatchTable)							const;
+
+			/**
+			*	@brief Add an entity to the property index under the archetype of each of its properties.
+			*	
+			*	@param entity The registered entity.
+			*/
+			inline void		addToPropertyIndex(Entity const& entity)								noexcept;
+
+			/**
+			*	@brief Remove an entity from the property index.
+			*	
+			*	@param entity The unregistered entity.
+			*/
+			inline void		removeFromPropertyIndex(Entity const& entity)							noexcept;
+
 		public:
 			DatabaseImpl()	= default;
 			~DatabaseImpl()	= default;
@@ -181,6 +235,16 @@ namespace rfk
 				SharedPtr<Namespace>			getOrCreateNamespace(char const*	name,
 																	 std::size_t	id)									noexcept;
 
+			/**
+			*	@brief Get the dispatch table indexing the provided property archetype. If it doesn't exist yet, build it right away.
+			* 
+			*	@param propertyArchetype Archetype of the indexed property.
+			* 
+			*	@return The dispatch table indexing the provided property archetype.
+			*/
+			RFK_NODISCARD inline
+				DispatchTable const&			getOrCreateDispatchTable(Struct const& propertyArchetype)		const;
+
 			/**
 			*	@brief Getters for each field.
 			*/
@@ -193,6 +257,7 @@ namespace rfk
 			RFK_NODISCARD inline FunctionsByName const&				getFileLevelFunctionsByName()		const	noexcept;
 			RFK_NODISCARD inline FundamentalArchetypesByName const&	getFundamentalArchetypesByName()	const	noexcept;
 			RFK_NODISCARD inline GenNamespaces const&				getGeneratedNamespaces()			const	noexcept;
+			RFK_NODISCARD inline EntitiesByProperty const&			getEntitiesByProperty()				const	noexcept;
 	};
 
 	#include "Refureku/TypeInfo/DatabaseImpl.inl"
@@ -114,7 +114,11 @@ inline void Database::DatabaseImpl::unregisterEntityRecursive(Entity const& enti
 inline void Database::DatabaseImpl::unregisterEntity(Entity const& entity) noexcept
 {
 	//Remove this entity from the list of registered entity ids
-	_entitiesById.erase(&entity);
+	if (_entitiesById.erase(&entity) != 0u)
+	{
+		removeFromDispatchTables(entity);
+		removeFromPropertyIndex(entity);
+	}
 
 	//Remove the entity from the suitable file level entities collection if applicable
 	if (entity.getOuterEntity() == nullptr)
@@ -174,8 +178,13 @@ inline void Database::DatabaseImpl::registerEntityId(Entity const& entity) noexc
 
 	//std::cout << "Register: (" << entity.getId() << ", " << entity.getName() << ")" << std::endl;
 
+	if (result.second)
+	{
+		addToDispatchTables(entity);
+		addToPropertyIndex(entity);
+	}
 	//Emit a warning if 2 entities with the same ID are registered.
-	if (!result.second)
+	else
 	{
 		Entity const* foundEntity = *_entitiesById.find(&entity);
 
@@ -190,6 +199,9 @@ inline void Database::DatabaseImpl::registerSubEntitesId(Entity const& entity) n
 	{
 		case EEntityKind::NamespaceFragment:
 			registerNamespaceFragmentSubEntities(static_cast<NamespaceFragment const&>(entity));
+
+			//The merged namespace is registered before the fragment properties are added to it
+			addToPropertyIndex(static_cast<NamespaceFragment const&>(entity).getMergedNamespace());
 			break;
 
 		case EEntityKind::Struct:
@@ -365,6 +377,82 @@ inline void Database::DatabaseImpl::unregisterEnumSubEntities(Enum const& e) noe
 					   }, this);
 }
 
+inline void Database::DatabaseImpl::addToDispatchTables(Entity const& entity) noexcept
+{
+	if (entity.getKind() == EEntityKind::Function || entity.getKind() == EEntityKind::Method)
+	{
+		std::lock_guard lock(_dispatchTablesMutex);
+
+		for (auto& [propertyArchetype, dispatchTable] : _dispatchTables)
+		{
+			try
+			{
+				dispatchTable->addIfMatching(static_cast<FunctionBase const&>(entity));
+			}
+			catch (std::bad_alloc const&)
+			{
+				//The table is missing this entity until it is rebuilt by the next getOrCreateDispatchTable call
+				dispatchTable->_needsRebuild = true;
+			}
+		}
+	}
+}
+
+inline void Database::DatabaseImpl::removeFromDispatchTables(Entity const& entity) noexcept
+{
+	if (entity.getKind() == EEntityKind::Function || entity.getKind() == EEntityKind::Method)
+	{
+		std::lock_guard lock(_dispatchTablesMutex);
+
+		for (auto& [propertyArchetype, dispatchTable] : _dispatchTables)
+		{
+			dispatchTable->remove(static_cast<FunctionBase const&>(entity));
+		}
+	}
+}
+
+inline void Database::DatabaseImpl::fillDispatchTable(DispatchTable& dispatchTable) const
+{
+	dispatchTable._entries.clear();
+
+	for (Entity const* entity : _entitiesById)
+	{
+		if (entity->getKind() == EEntityKind::Function || entity->getKind() == EEntityKind::Method)
+		{
+			dispatchTable.addIfMatching(static_cast<FunctionBase const&>(*entity));
+		}
+	}
+
+	dispatchTable._needsRebuild = false;
+}
+
+inline void Database::DatabaseImpl::addToPropertyIndex(Entity const& entity) noexcept
+{
+	//The same entity might be added multiple times under the same archetype but the set only keeps it once
+	for (std::size_t i = 0u; i < entity.getPropertiesCount(); i++)
+	{
+		_entitiesByProperty[&entity.getPropertyAt(i)->getArchetype()].emplace(&entity);
+	}
+}
+
+inline void Database::DatabaseImpl::removeFromPropertyIndex(Entity const& entity) noexcept
+{
+	for (std::size_t i = 0u; i < entity.getPropertiesCount(); i++)
+	{
+		auto it = _entitiesByProperty.find(&entity.getPropertyAt(i)->getArchetype());
+
+		if (it != _entitiesByProperty.end())
+		{
+			it->second.erase(&entity);
+
+			if (it->second.empty())
+			{
+				_entitiesByProperty.erase(it);
+			}
+		}
+	}
+}
+
 inline void Database::DatabaseImpl::releaseNamespaceIfUnreferenced(SharedPtr<Namespace> const& npPtr) noexcept
 {
 	assert(npPtr.use_count() >= 2);
@@ -403,6 +491,32 @@ inline SharedPtr<Namespace> Database::DatabaseImpl::getOrCreateNamespace(char co
 	}
 }
 
+inline DispatchTable const& Database::DatabaseImpl::getOrCreateDispatchTable(Struct const& propertyArchetype) const
+{
+	std::lock_guard lock(_dispatchTablesMutex);
+
+	auto it = _dispatchTables.find(&propertyArchetype);
+
+	if (it != _dispatchTables.cend())
+	{
+		//Rebuild in place so that references to the table held by the user stay valid
+		if (it->second->_needsRebuild)
+		{
+			fillDispatchTable(*it->second);
+		}
+
+		return *it->second;
+	}
+
+	//Build the table before inserting it so that no partially built table is kept if an allocation throws
+	UniquePtr<DispatchTable> dispatchTable(new DispatchTable(propertyArchetype));
+
+	//Index all functions and methods registered so far, the table is then updated on registration / unregistration
+	fillDispatchTable(*dispatchTable);
+
+	return *_dispatchTables.emplace(&propertyArchetype, std::move(dispatchTable)).first->second;
+}
+
 inline Database::DatabaseImpl::EntitiesById const& Database::DatabaseImpl::getEntitiesById() const noexcept
 {
 	return _entitiesById;
@@ -446,4 +560,9 @@ inline Database::DatabaseImpl::FunctionsByName const& Database::DatabaseImpl::ge
 inline Database::DatabaseImpl::GenNamespaces const& Database::DatabaseImpl::getGeneratedNamespaces() const noexcept
 {
 	return _generatedNamespaces;
+}
+
+inline Database::DatabaseImpl::EntitiesByProperty const& Database::DatabaseImpl::getEntitiesByProperty() const noexcept
+{
+	return _entitiesByProperty;
 }
\ No newline at end of file
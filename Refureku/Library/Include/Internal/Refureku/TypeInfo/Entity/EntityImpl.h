@@ -13,10 +13,22 @@
 
 #include "Refureku/TypeInfo/Entity/Entity.h"
 #include "Refureku/TypeInfo/Entity/EEntityKind.h"
+#include "Refureku/TypeInfo/MetadataArena.h"
 #include "Refureku/Properties/Property.h"
+#include "Refureku/TypeInfo/Archetypes/Struct.h"
 
 namespace rfk
 {
+	namespace internal
+	{
+		/**
+		*	Tag selecting the getEntityImplSize overload of an entity class.
+		*	Each overload is defined by the implementation class itself since the implementation classes are not accessible from outside.
+		*/
+		template <typename EntityType>
+		struct EntityImplSizeTag final {};
+	}
+
 	class Entity::EntityImpl
 	{
 		private:
@@ -38,6 +50,15 @@ namespace rfk
 			/** Kind of this entity. */
 			EEntityKind						_kind;
 
+			/**
+			*	Union of the property signature bits of the archetypes of the properties of this entity and of their parents.
+			*	A set bit doesn't guarantee a property since bits are shared beyond 64 property archetypes (see Struct::getPropertySignatureBit).
+			*/
+			uint64							_propertiesSignature		= 0u;
+
+			/** Union of the name signature bits of the archetypes of the properties of this entity. */
+			uint64							_propertyNamesSignature	= 0u;
+
 		public:
 			inline EntityImpl(char const*		name,
 							  std::size_t		id,
@@ -45,6 +66,13 @@ namespace rfk
 							  Entity const*	outerEntity = nullptr)				noexcept;
 			virtual ~EntityImpl()												= default;
 
+			/**
+			*	@brief	Entities implementations are allocated from the metadata arena in use in the current thread if any.
+			*			See rfk::MetadataArena.
+			*/
+			inline static void*	operator new(std::size_t size);
+			inline static void	operator delete(void* ptr)	noexcept;
+
 			/**
 			*	@brief Add a property to this entity.
 			*	
@@ -104,6 +132,29 @@ namespace rfk
 			*/
 			inline std::vector<Property const*> const&	getProperties()									const	noexcept;
 
+			/**
+			*	@brief Getter for the field _propertiesSignature.
+			* 
+			*	@return _propertiesSignature.
+			*/
+			inline uint64								getPropertiesSignature()						const	noexcept;
+
+			/**
+			*	@brief Getter for the field _propertyNamesSignature.
+			* 
+			*	@return _propertyNamesSignature.
+			*/
+			inline uint64								getPropertyNamesSignature()						const	noexcept;
+
+			/**
+			*	@brief Compute the bit of a property archetype name in _propertyNamesSignature.
+			* 
+			*	@param name Name of the property archetype.
+			* 
+			*	@return The signature bit of the name.
+			*/
+			static inline uint64						getNameSignatureBit(char const* name)					noexcept;
+
 			/**
 			*	@brief Setter for the field _outerEntity.
 			* 
@@ -14,6 +14,16 @@ inline Entity::EntityImpl::EntityImpl(char const* name, std::size_t id, EEntityK
 {
 }
 
+inline void* Entity::EntityImpl::operator new(std::size_t size)
+{
+	return MetadataArena::allocate(size);
+}
+
+inline void Entity::EntityImpl::operator delete(void* ptr) noexcept
+{
+	MetadataArena::deallocate(ptr);
+}
+
 inline bool Entity::EntityImpl::addProperty(Property const& toAddProperty) noexcept
 {
 	if (!toAddProperty.getAllowMultiple())
@@ -31,11 +41,16 @@ inline bool Entity::EntityImpl::addProperty(Property const& toAddProperty) noexc
 
 	_properties.push_back(&toAddProperty);
 
+	_propertiesSignature	|= toAddProperty.getArchetype().indexPropertyHierarchy();
+	_propertyNamesSignature	|= getNameSignatureBit(toAddProperty.getArchetype().getName());
+
 	return true;
 }
 
 inline void Entity::EntityImpl::inheritProperties(EntityImpl const& from) noexcept
 {
+	_properties.reserve(_properties.size() + from._properties.size());
+
 	for (Property const* property : from._properties)
 	{
 		if (property->getShouldInherit())
@@ -47,6 +62,8 @@ inline void Entity::EntityImpl::inheritProperties(EntityImpl const& from) noexce
 
 inline void Entity::EntityImpl::inheritAllProperties(EntityImpl const& from) noexcept
 {
+	_properties.reserve(_properties.size() + from._properties.size());
+
 	for (Property const* property : from._properties)
 	{
 		addProperty(*property);
@@ -78,6 +95,30 @@ inline std::vector<Property const*> const& Entity::EntityImpl::getProperties() c
 	return _properties;
 }
 
+inline uint64 Entity::EntityImpl::getPropertiesSignature() const noexcept
+{
+	return _propertiesSignature;
+}
+
+inline uint64 Entity::EntityImpl::getPropertyNamesSignature() const noexcept
+{
+	return _propertyNamesSignature;
+}
+
+inline uint64 Entity::EntityImpl::getNameSignatureBit(char const* name) noexcept
+{
+	//FNV-1a
+	uint64 hash = 14695981039346656037ull;
+
+	for (; *name != '\0'; name++)
+	{
+		hash ^= static_cast<unsigned char>(*name);
+		hash *= 1099511628211ull;
+	}
+
+	return uint64(1u) << (hash % 64u);
+}
+
 inline void Entity::EntityImpl::setOuterEntity(Entity const* outerEntity) noexcept
 {
 	_outerEntity = outerEntity;
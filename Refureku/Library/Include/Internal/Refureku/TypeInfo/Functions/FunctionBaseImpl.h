@@ -9,7 +9,6 @@
 
 #include "Refureku/TypeInfo/Functions/FunctionBase.h"
 #include "Refureku/TypeInfo/Entity/EntityImpl.h"
-#include "Refureku/Misc/UniquePtr.h"
 
 namespace rfk
 {
@@ -20,7 +19,16 @@ namespace rfk
 			Type const&						_returnType;
 
 			/** Handle pointing to the actual function in memory. */
-			UniquePtr<ICallable>			_internalFunction;
+			ICallable*						_internalFunction;
+
+			/** Should _internalFunction be deleted with this function or not. Generated code stores callables in static storage. */
+			bool							_ownsInternalFunction;
+
+			/** Type-erased entry point of the function, nullptr if none was provided. */
+			ErasedCallThunk					_erasedCallThunk	= nullptr;
+
+			/** Native entry point of the function, nullptr if none was provided. */
+			NativeEntryPoint const*			_nativeEntryPoint	= nullptr;
 
 			/** Parameters of this function. */
 			std::vector<FunctionParameter>	_parameters;
@@ -31,7 +39,10 @@ namespace rfk
 									EEntityKind		kind,
 									Type const&		returnType,
 									ICallable*		internalFunction,
+									bool			ownsInternalFunction,
 									Entity const*	outerEntity)		noexcept;
+			FunctionBaseImpl(FunctionBaseImpl const&)					= delete;
+			inline ~FunctionBaseImpl()									noexcept;
 
 			/**
 			*	@brief Add a parameter to this function.
@@ -62,6 +73,34 @@ namespace rfk
 			*/
 			RFK_NODISCARD inline ICallable*								getInternalFunction()							const	noexcept;
 
+			/**
+			*	@brief Getter for the field _erasedCallThunk.
+			* 
+			*	@return _erasedCallThunk.
+			*/
+			RFK_NODISCARD inline ErasedCallThunk						getErasedCallThunk()							const	noexcept;
+
+			/**
+			*	@brief Setter for the field _erasedCallThunk.
+			* 
+			*	@param thunk The thunk to set.
+			*/
+			inline void													setErasedCallThunk(ErasedCallThunk thunk)				noexcept;
+
+			/**
+			*	@brief Getter for the field _nativeEntryPoint.
+			* 
+			*	@return _nativeEntryPoint.
+			*/
+			RFK_NODISCARD inline NativeEntryPoint const*				getNativeEntryPoint()							const	noexcept;
+
+			/**
+			*	@brief Setter for the field _nativeEntryPoint.
+			* 
+			*	@param entryPoint The entry point to set.
+			*/
+			inline void													setNativeEntryPoint(NativeEntryPoint const* entryPoint)	noexcept;
+
 			/**
 			*	@brief Getter for the field _parameters.
 			* 
@@ -6,13 +6,22 @@
 */
 
 inline FunctionBase::FunctionBaseImpl::FunctionBaseImpl(char const* name, std::size_t id, EEntityKind kind,
-														   Type const& returnType, ICallable* internalFunction, Entity const* outerEntity) noexcept:
+														   Type const& returnType, ICallable* internalFunction, bool ownsInternalFunction, Entity const* outerEntity) noexcept:
 	EntityImpl(name, id, kind, outerEntity),
 	_returnType{returnType},
-	_internalFunction{internalFunction}
+	_internalFunction{internalFunction},
+	_ownsInternalFunction{ownsInternalFunction}
 {
 }
 
+inline FunctionBase::FunctionBaseImpl::~FunctionBaseImpl() noexcept
+{
+	if (_ownsInternalFunction)
+	{
+		delete _internalFunction;
+	}
+}
+
 inline FunctionParameter& FunctionBase::FunctionBaseImpl::addParameter(char const* name, std::size_t id, Type const& type, FunctionBase const* outerEntity) noexcept
 {
 	return _parameters.emplace_back(name, id, type, outerEntity);
@@ -25,7 +34,27 @@ inline Type const& FunctionBase::FunctionBaseImpl::getReturnType() const noexcep
 
 inline ICallable* FunctionBase::FunctionBaseImpl::getInternalFunction() const noexcept
 {
-	return _internalFunction.get();
+	return _internalFunction;
+}
+
+inline ErasedCallThunk FunctionBase::FunctionBaseImpl::getErasedCallThunk() const noexcept
+{
+	return _erasedCallThunk;
+}
+
+inline void FunctionBase::FunctionBaseImpl::setErasedCallThunk(ErasedCallThunk thunk) noexcept
+{
+	_erasedCallThunk = thunk;
+}
+
+inline NativeEntryPoint const* FunctionBase::FunctionBaseImpl::getNativeEntryPoint() const noexcept
+{
+	return _nativeEntryPoint;
+}
+
+inline void FunctionBase::FunctionBaseImpl::setNativeEntryPoint(NativeEntryPoint const* entryPoint) noexcept
+{
+	_nativeEntryPoint = entryPoint;
 }
 
 inline std::vector<FunctionParameter> const& FunctionBase::FunctionBaseImpl::getParameters() const noexcept
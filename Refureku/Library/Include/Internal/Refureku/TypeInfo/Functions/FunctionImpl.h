@@ -23,6 +23,7 @@ namespace rfk
 								std::size_t		id,
 								Type const&	returnType,
 								ICallable*		internalFunction,
+								bool			ownsInternalFunction,
 								EFunctionFlags	flags)			noexcept;
 
 			/**
@@ -31,6 +32,16 @@ namespace rfk
 			*	@return _flags.
 			*/
 			RFK_NODISCARD inline EFunctionFlags getFlags() const noexcept;
+
+			/**
+			*	@brief Get the size of this implementation, so that rfk::MetadataArena can reserve memory for rfk::Function entities.
+			* 
+			*	@return The size in bytes of this implementation.
+			*/
+			friend constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<Function>)	noexcept
+			{
+				return sizeof(FunctionImpl);
+			}
 	};
 
 	#include "Refureku/TypeInfo/Functions/FunctionImpl.inl"
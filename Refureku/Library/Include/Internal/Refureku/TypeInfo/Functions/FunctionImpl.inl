@@ -6,8 +6,8 @@
 */
 
 inline Function::FunctionImpl::FunctionImpl(char const* name, std::size_t id,
-											   Type const& returnType, ICallable* internalFunction, EFunctionFlags flags) noexcept:
-	FunctionBaseImpl(name, id, EEntityKind::Function, returnType, internalFunction, nullptr),
+											   Type const& returnType, ICallable* internalFunction, bool ownsInternalFunction, EFunctionFlags flags) noexcept:
+	FunctionBaseImpl(name, id, EEntityKind::Function, returnType, internalFunction, ownsInternalFunction, nullptr),
 	_flags{flags}
 {
 }
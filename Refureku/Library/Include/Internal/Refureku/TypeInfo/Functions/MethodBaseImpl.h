@@ -23,6 +23,7 @@ namespace rfk
 								  std::size_t	id,
 								  Type const&	returnType,
 								  ICallable*	internalMethod,
+								  bool			ownsInternalMethod,
 								  EMethodFlags	flags,
 								  Entity const*	outerEntity)		noexcept;
 
@@ -6,8 +6,8 @@
 */
 
 inline MethodBase::MethodBaseImpl::MethodBaseImpl(char const* name, std::size_t id, Type const& returnType,
-													 ICallable* internalMethod, EMethodFlags flags, Entity const* outerEntity) noexcept:
-	FunctionBaseImpl(name, id, EEntityKind::Method, returnType, internalMethod, outerEntity),
+													 ICallable* internalMethod, bool ownsInternalMethod, EMethodFlags flags, Entity const* outerEntity) noexcept:
+	FunctionBaseImpl(name, id, EEntityKind::Method, returnType, internalMethod, ownsInternalMethod, outerEntity),
 	_flags{flags}
 {
 }
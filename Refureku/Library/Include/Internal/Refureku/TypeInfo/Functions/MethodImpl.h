@@ -19,8 +19,19 @@ namespace rfk
 							  std::size_t		id,
 							  Type const&	returnType,
 							  ICallable*		internalMethod,
+							  bool				ownsInternalMethod,
 							  EMethodFlags		flags,
 							  Entity const*	outerEntity)	noexcept;
+
+			/**
+			*	@brief Get the size of this implementation, so that rfk::MetadataArena can reserve memory for rfk::Method entities.
+			* 
+			*	@return The size in bytes of this implementation.
+			*/
+			friend constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<Method>)	noexcept
+			{
+				return sizeof(MethodImpl);
+			}
 	};
 
 	#include "Refureku/TypeInfo/Functions/MethodImpl.inl"
@@ -19,8 +19,19 @@ namespace rfk
 									std::size_t		id,
 									Type const&		returnType,
 									ICallable*			internalMethod,
+									bool				ownsInternalMethod,
 									EMethodFlags		flags,
 									Entity const*	outerEntity)	noexcept;
+
+			/**
+			*	@brief Get the size of this implementation, so that rfk::MetadataArena can reserve memory for rfk::StaticMethod entities.
+			* 
+			*	@return The size in bytes of this implementation.
+			*/
+			friend constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<StaticMethod>)	noexcept
+			{
+				return sizeof(StaticMethodImpl);
+			}
 	};
 
 	#include "Refureku/TypeInfo/Functions/StaticMethodImpl.inl"
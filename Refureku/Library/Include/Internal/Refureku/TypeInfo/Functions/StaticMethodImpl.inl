@@ -6,7 +6,7 @@
 */
 
 inline StaticMethod::StaticMethodImpl::StaticMethodImpl(char const* name, std::size_t id, Type const& returnType,
-													ICallable* internalMethod, EMethodFlags flags, Entity const* outerEntity) noexcept:
-	MethodBaseImpl(name, id, returnType, internalMethod, flags, outerEntity)
+													ICallable* internalMethod, bool ownsInternalMethod, EMethodFlags flags, Entity const* outerEntity) noexcept:
+	MethodBaseImpl(name, id, returnType, internalMethod, ownsInternalMethod, flags, outerEntity)
 {
 }
\ No newline at end of file
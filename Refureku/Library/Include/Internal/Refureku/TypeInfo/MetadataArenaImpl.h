@@ -0,0 +1,185 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t, std::max_align_t, std::byte
+#include <cassert>
+#include <vector>
+#include <algorithm>	//std::max
+#include <new>		//::operator new, ::operator delete
+
+#include "Refureku/TypeInfo/MetadataArena.h"
+#include "Refureku/TypeInfo/Namespace/NamespaceImpl.h"
+#include "Refureku/TypeInfo/Namespace/NamespaceFragmentImpl.h"
+#include "Refureku/TypeInfo/Archetypes/StructImpl.h"
+#include "Refureku/TypeInfo/Archetypes/EnumImpl.h"
+#include "Refureku/TypeInfo/Archetypes/EnumValueImpl.h"
+#include "Refureku/TypeInfo/Archetypes/FundamentalArchetypeImpl.h"
+#include "Refureku/TypeInfo/Variables/VariableImpl.h"
+#include "Refureku/TypeInfo/Variables/FieldImpl.h"
+#include "Refureku/TypeInfo/Variables/StaticFieldImpl.h"
+#include "Refureku/TypeInfo/Functions/FunctionImpl.h"
+#include "Refureku/TypeInfo/Functions/MethodImpl.h"
+#include "Refureku/TypeInfo/Functions/StaticMethodImpl.h"
+
+namespace rfk
+{
+	//Sizes of the entities implementations, defined by the implementation classes (see internal::EntityImplSizeTag)
+	constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<Namespace>)				noexcept;
+	constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<NamespaceFragment>)		noexcept;
+	constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<Struct>)					noexcept;
+	constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<Enum>)						noexcept;
+	constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<EnumValue>)				noexcept;
+	constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<FundamentalArchetype>)		noexcept;
+	constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<Variable>)					noexcept;
+	constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<Field>)					noexcept;
+	constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<StaticField>)				noexcept;
+	constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<Function>)					noexcept;
+	constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<Method>)					noexcept;
+	constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<StaticMethod>)				noexcept;
+
+	class MetadataArena::MetadataArenaImpl
+	{
+		public:
+			/** Header placed before each metadata object, storing the arena the object was allocated from (nullptr if allocated from the heap). */
+			struct alignas(std::max_align_t) AllocationHeader
+			{
+				MetadataArenaImpl*	arena;
+			};
+
+		private:
+			/** Minimal size in bytes of a chunk allocated when the reserved memory is exhausted. */
+			static constexpr std::size_t	minChunkSize	= 4096u;
+
+			/** Memory chunks held by this arena. */
+			std::vector<std::byte*>			_chunks;
+
+			/** First free byte of the last chunk. */
+			std::byte*						_cursor			= nullptr;
+
+			/** End of the last chunk. */
+			std::byte*						_end			= nullptr;
+
+			/** Size in bytes of the chunk to allocate on the next allocation. */
+			std::size_t						_reservedSize	= 0u;
+
+			/** Is the MetadataArena object owning this state still alive? */
+			bool							_isArenaAlive	= true;
+
+			/** Allocation statistics of this arena. */
+			MetadataAllocationStatistics	_statistics;
+
+			/** Allocation statistics of all arenas. heapAllocationsCount is not tracked here. */
+			inline static MetadataAllocationStatistics	_globalStatistics;
+
+			/** Arena in use in the current thread. */
+			inline static thread_local MetadataArenaImpl*	_currentArena	= nullptr;
+
+			/**
+			*	@brief Allocate a new chunk and make it the current chunk.
+			*
+			*	@param size Size in bytes of the chunk.
+			*
+			*	@exception std::bad_alloc if the chunk could not be allocated.
+			*/
+			inline void	allocateChunk(std::size_t size);
+
+		public:
+			MetadataArenaImpl()								= default;
+			MetadataArenaImpl(MetadataArenaImpl const&)		= delete;
+			MetadataArenaImpl(MetadataArenaImpl&&)			= delete;
+			inline ~MetadataArenaImpl()						noexcept;
+
+			/**
+			*	@brief Compute the memory used by a metadata object allocated from an arena, including its header.
+			*
+			*	@param size Size in bytes of the metadata object.
+			*
+			*	@return The memory used by the metadata object.
+			*/
+			RFK_NODISCARD static constexpr std::size_t	computeFootprint(std::size_t size)			noexcept;
+
+			/**
+			*	@brief Get the size of the implementation of the entities of the provided kind.
+			*
+			*	@param entityKind Kind of the entities.
+			*
+			*	@return The size of the implementation of the entities of the provided kind, 0 if the kind is not a single kind.
+			*/
+			RFK_NODISCARD static inline std::size_t		getEntityImplSize(EEntityKind entityKind)	noexcept;
+
+			/**
+			*	@brief	Reserve memory for the next allocations.
+			*			The memory is allocated in a single chunk when the current chunk can't hold the next allocation.
+			*
+			*	@param size Size in bytes to reserve.
+			*/
+			inline void									reserve(std::size_t size)					noexcept;
+
+			/**
+			*	@brief Allocate memory for a metadata object, including its header.
+			*
+			*	@param size Size in bytes of the metadata object.
+			*
+			*	@return The header of the allocated memory.
+			*
+			*	@exception std::bad_alloc if a new chunk could not be allocated.
+			*/
+			RFK_NODISCARD inline AllocationHeader*		allocate(std::size_t size);
+
+			/**
+			*	@brief Notify the arena that an object allocated from it was destroyed.
+			*
+			*	@return true if the arena state is not referenced anymore and must be deleted, else false.
+			*/
+			RFK_NODISCARD inline bool					release()									noexcept;
+
+			/**
+			*	@brief Notify the arena state that the MetadataArena object owning it was destroyed.
+			*
+			*	@return true if the arena state is not referenced anymore and must be deleted, else false.
+			*/
+			RFK_NODISCARD inline bool					releaseArena()								noexcept;
+
+			/**
+			*	@brief Getter for the field _statistics.
+			*
+			*	@return _statistics.
+			*/
+			RFK_NODISCARD inline
+				MetadataAllocationStatistics const&		getStatistics()						const	noexcept;
+
+			/**
+			*	@brief Getter for the field _globalStatistics.
+			*
+			*	@return _globalStatistics.
+			*/
+			RFK_NODISCARD static inline
+				MetadataAllocationStatistics const&		getGlobalStatistics()						noexcept;
+
+			/**
+			*	@brief Getter for the field _currentArena.
+			*
+			*	@return _currentArena.
+			*/
+			RFK_NODISCARD static inline
+				MetadataArenaImpl*						getCurrentArena()							noexcept;
+
+			/**
+			*	@brief Setter for the field _currentArena.
+			*
+			*	@param arena The arena to use in the current thread, nullptr to allocate from the heap.
+			*/
+			static inline void							setCurrentArena(MetadataArenaImpl* arena)	noexcept;
+
+			MetadataArenaImpl& operator=(MetadataArenaImpl const&)	= delete;
+			MetadataArenaImpl& operator=(MetadataArenaImpl&&)		= delete;
+	};
+
+	#include "Refureku/TypeInfo/MetadataArenaImpl.inl"
+}
\ No newline at end of file
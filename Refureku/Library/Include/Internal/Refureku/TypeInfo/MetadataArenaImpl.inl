@@ -0,0 +1,149 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline MetadataArena::MetadataArenaImpl::~MetadataArenaImpl() noexcept
+{
+	for (std::byte* chunk : _chunks)
+	{
+		::operator delete(chunk);
+	}
+
+	_globalStatistics.chunksCount	-= _statistics.chunksCount;
+	_globalStatistics.reservedBytes	-= _statistics.reservedBytes;
+	_globalStatistics.usedBytes		-= _statistics.usedBytes;
+}
+
+constexpr std::size_t MetadataArena::MetadataArenaImpl::computeFootprint(std::size_t size) noexcept
+{
+	//Keep every header aligned
+	return sizeof(AllocationHeader) + (size + alignof(AllocationHeader) - 1u) / alignof(AllocationHeader) * alignof(AllocationHeader);
+}
+
+inline std::size_t MetadataArena::MetadataArenaImpl::getEntityImplSize(EEntityKind entityKind) noexcept
+{
+	switch (entityKind)
+	{
+		case EEntityKind::Namespace:
+			return rfk::getEntityImplSize(internal::EntityImplSizeTag<Namespace>());
+
+		case EEntityKind::NamespaceFragment:
+			return rfk::getEntityImplSize(internal::EntityImplSizeTag<NamespaceFragment>());
+
+		case EEntityKind::Class:
+			[[fallthrough]];
+		case EEntityKind::Struct:
+			return rfk::getEntityImplSize(internal::EntityImplSizeTag<Struct>());
+
+		case EEntityKind::Enum:
+			return rfk::getEntityImplSize(internal::EntityImplSizeTag<Enum>());
+
+		case EEntityKind::EnumValue:
+			return rfk::getEntityImplSize(internal::EntityImplSizeTag<EnumValue>());
+
+		case EEntityKind::FundamentalArchetype:
+			return rfk::getEntityImplSize(internal::EntityImplSizeTag<FundamentalArchetype>());
+
+		case EEntityKind::Variable:
+			return rfk::getEntityImplSize(internal::EntityImplSizeTag<Variable>());
+
+		case EEntityKind::Field:
+			return std::max(rfk::getEntityImplSize(internal::EntityImplSizeTag<Field>()), rfk::getEntityImplSize(internal::EntityImplSizeTag<StaticField>()));
+
+		case EEntityKind::Function:
+			return rfk::getEntityImplSize(internal::EntityImplSizeTag<Function>());
+
+		case EEntityKind::Method:
+			return std::max(rfk::getEntityImplSize(internal::EntityImplSizeTag<Method>()), rfk::getEntityImplSize(internal::EntityImplSizeTag<StaticMethod>()));
+
+		case EEntityKind::Undefined:
+			[[fallthrough]];
+		default:
+			assert(false);	//Must reserve a single kind
+			return 0u;
+	}
+}
+
+inline void MetadataArena::MetadataArenaImpl::allocateChunk(std::size_t size)
+{
+	std::byte* chunk = static_cast<std::byte*>(::operator new(size));
+
+	_chunks.push_back(chunk);
+	_cursor	= chunk;
+	_end	= chunk + size;
+
+	_statistics.chunksCount++;
+	_statistics.reservedBytes += size;
+	_globalStatistics.chunksCount++;
+	_globalStatistics.reservedBytes += size;
+}
+
+inline void MetadataArena::MetadataArenaImpl::reserve(std::size_t size) noexcept
+{
+	_reservedSize += size;
+}
+
+inline MetadataArena::MetadataArenaImpl::AllocationHeader* MetadataArena::MetadataArenaImpl::allocate(std::size_t size)
+{
+	std::size_t footprint = computeFootprint(size);
+
+	if (static_cast<std::size_t>(_end - _cursor) < footprint)
+	{
+		//The remaining memory of the current chunk is lost, which is fine as long as reservations are accurate
+		allocateChunk((_reservedSize > footprint) ? _reservedSize : ((footprint > minChunkSize) ? footprint : minChunkSize));
+
+		_reservedSize = 0u;
+	}
+
+	AllocationHeader* header = new (_cursor) AllocationHeader{this};
+	_cursor += footprint;
+
+	_statistics.arenaAllocationsCount++;
+	_statistics.liveAllocationsCount++;
+	_statistics.usedBytes += footprint;
+	_globalStatistics.arenaAllocationsCount++;
+	_globalStatistics.liveAllocationsCount++;
+	_globalStatistics.usedBytes += footprint;
+
+	return header;
+}
+
+inline bool MetadataArena::MetadataArenaImpl::release() noexcept
+{
+	assert(_statistics.liveAllocationsCount > 0u);
+
+	_statistics.liveAllocationsCount--;
+	_globalStatistics.liveAllocationsCount--;
+
+	return !_isArenaAlive && _statistics.liveAllocationsCount == 0u;
+}
+
+inline bool MetadataArena::MetadataArenaImpl::releaseArena() noexcept
+{
+	_isArenaAlive = false;
+
+	return _statistics.liveAllocationsCount == 0u;
+}
+
+inline MetadataAllocationStatistics const& MetadataArena::MetadataArenaImpl::getStatistics() const noexcept
+{
+	return _statistics;
+}
+
+inline MetadataAllocationStatistics const& MetadataArena::MetadataArenaImpl::getGlobalStatistics() noexcept
+{
+	return _globalStatistics;
+}
+
+inline MetadataArena::MetadataArenaImpl* MetadataArena::MetadataArenaImpl::getCurrentArena() noexcept
+{
+	return _currentArena;
+}
+
+inline void MetadataArena::MetadataArenaImpl::setCurrentArena(MetadataArenaImpl* arena) noexcept
+{
+	_currentArena = arena;
+}
\ No newline at end of file
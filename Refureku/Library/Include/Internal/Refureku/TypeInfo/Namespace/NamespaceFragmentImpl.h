@@ -31,7 +31,8 @@ namespace rfk
 										 SharedPtr<Namespace>&&	mergedNamespace)	noexcept;
 
 			/**
-			*	@brief Add a nested entity to the fragment as well as the merged namespace.
+			*	@brief	Add a nested entity to the fragment.
+			*			The entity is added to the merged namespace when the fragment is merged.
 			*	
 			*	@param nestedEntity The nested entity to add to the namespace fragment.
 			*/
@@ -73,10 +74,25 @@ namespace rfk
 			RFK_NODISCARD inline
 				rfk::SharedPtr<Namespace> const&	getMergedNamespace()						const	noexcept;
 
+			/**
+			*	@brief Add this fragment entities to the merged namespace.
+			*/
+			inline void								mergeFragment()								const	noexcept;
+
 			/**
 			*	@brief Remove this fragment entities from the merged namespace.
 			*/
 			inline void								unmergeFragment()							const	noexcept;
+
+			/**
+			*	@brief Get the size of this implementation, so that rfk::MetadataArena can reserve memory for rfk::NamespaceFragment entities.
+			* 
+			*	@return The size in bytes of this implementation.
+			*/
+			friend constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<NamespaceFragment>)	noexcept
+			{
+				return sizeof(NamespaceFragmentImpl);
+			}
 	};
 
 	#include "Refureku/TypeInfo/Namespace/NamespaceFragmentImpl.inl"
@@ -14,47 +14,89 @@ inline NamespaceFragment::NamespaceFragmentImpl::NamespaceFragmentImpl(char cons
 
 inline void NamespaceFragment::NamespaceFragmentImpl::addNestedEntity(Entity const& nestedEntity) noexcept
 {
+	//The nested entity is added to the merged namespace when the fragment is merged
 	_nestedEntities.push_back(&nestedEntity);
+}
+
+inline void NamespaceFragment::NamespaceFragmentImpl::mergeFragment() const noexcept
+{
+	//Reserve the namespace members of all nested entities at once
+	std::size_t namespacesCount	= 0u;
+	std::size_t archetypesCount	= 0u;
+	std::size_t variablesCount	= 0u;
+	std::size_t functionsCount	= 0u;
+
+	for (Entity const* nestedEntity : _nestedEntities)
+	{
+		switch (nestedEntity->getKind())
+		{
+			case EEntityKind::NamespaceFragment:
+				namespacesCount++;
+				break;
+
+			case EEntityKind::Variable:
+				variablesCount++;
+				break;
+
+			case EEntityKind::Function:
+				functionsCount++;
+				break;
+
+			default:
+				archetypesCount++;
+				break;
+		}
+	}
+
+	_mergedNamespace->reserveMembers(namespacesCount, archetypesCount, variablesCount, functionsCount);
 
-	switch (nestedEntity.getKind())
+	for (Entity const* entity : _nestedEntities)
 	{
-		case EEntityKind::NamespaceFragment:
-			//The same namespace might be added multiple times by different namespace fragments
-			//refering to the same namespace but it is not a problem since the underlying container only keeps the first one
-			_mergedNamespace->addNamespace(static_cast<NamespaceFragment const&>(nestedEntity).getMergedNamespace());
-			break;
-
-		case EEntityKind::Struct:
-			[[fallthrough]];
-		case EEntityKind::Class:
-			[[fallthrough]];
-		case EEntityKind::Enum:
-			_mergedNamespace->addArchetype(static_cast<Archetype const&>(nestedEntity));
-			break;
-
-		case EEntityKind::Variable:
-			_mergedNamespace->addVariable(static_cast<Variable const&>(nestedEntity));
-			break;
-
-		case EEntityKind::Function:
-			_mergedNamespace->addFunction(static_cast<Function const&>(nestedEntity));
-			break;
-
-		case EEntityKind::Namespace:
-			//Nested namespaces should always be added though their NamespaceFragment
-			[[fallthrough]];
-		case EEntityKind::EnumValue:
-			//None of these kind of entities should ever be a namespace nested entity
-			[[fallthrough]];
-		case EEntityKind::Field:
-			[[fallthrough]];
-		case EEntityKind::Method:
-			[[fallthrough]];
-		case EEntityKind::Undefined:
-			[[fallthrough]];
-		default:
-			assert(false);	
-			break;
+		Entity const& nestedEntity = *entity;
+
+		switch (nestedEntity.getKind())
+		{
+			case EEntityKind::NamespaceFragment:
+				//Merge the nested namespace fragment
+				static_cast<NamespaceFragment const&>(nestedEntity).getPimpl()->mergeFragment();
+
+				//The same namespace might be added multiple times by different namespace fragments
+				//refering to the same namespace but it is not a problem since the underlying container only keeps the first one
+				_mergedNamespace->addNamespace(static_cast<NamespaceFragment const&>(nestedEntity).getMergedNamespace());
+				break;
+
+			case EEntityKind::Struct:
+				[[fallthrough]];
+			case EEntityKind::Class:
+				[[fallthrough]];
+			case EEntityKind::Enum:
+				_mergedNamespace->addArchetype(static_cast<Archetype const&>(nestedEntity));
+				break;
+
+			case EEntityKind::Variable:
+				_mergedNamespace->addVariable(static_cast<Variable const&>(nestedEntity));
+				break;
+
+			case EEntityKind::Function:
+				_mergedNamespace->addFunction(static_cast<Function const&>(nestedEntity));
+				break;
+
+			case EEntityKind::Namespace:
+				//Nested namespaces should always be added though their NamespaceFragment
+				[[fallthrough]];
+			case EEntityKind::EnumValue:
+				//None of these kind of entities should ever be a namespace nested entity
+				[[fallthrough]];
+			case EEntityKind::Field:
+				[[fallthrough]];
+			case EEntityKind::Method:
+				[[fallthrough]];
+			case EEntityKind::Undefined:
+				[[fallthrough]];
+			default:
+				assert(false);
+				break;
+		}
 	}
 }
 
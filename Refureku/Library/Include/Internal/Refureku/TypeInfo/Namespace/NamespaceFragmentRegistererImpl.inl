@@ -11,6 +11,9 @@ inline internal::NamespaceFragmentRegistererImpl::NamespaceFragmentRegistererImp
 	//Only register file level namespaces
 	assert(namespaceFragment.getOuterEntity() == nullptr);
 
+	//All nested entities are constructed at this point, so merge them to the namespace in a single pass
+	_registeredFragment.mergeFragment();
+
 	Database::getInstance()._pimpl->registerFileLevelEntityRecursive(_registeredFragment);
 }
 
@@ -7,37 +7,35 @@
 
 #pragma once
 
-#include <unordered_set>
-
 #include "Refureku/TypeInfo/Namespace/Namespace.h"
 #include "Refureku/TypeInfo/Entity/EntityImpl.h"
 #include "Refureku/TypeInfo/Archetypes/Archetype.h"
 #include "Refureku/TypeInfo/Variables/Variable.h"
 #include "Refureku/TypeInfo/Functions/Function.h"
-#include "Refureku/TypeInfo/Entity/EntityHash.h"
+#include "Refureku/TypeInfo/Namespace/NamespaceMemberTable.h"
 
 namespace rfk
 {
 	class Namespace::NamespaceImpl final : public Entity::EntityImpl
 	{
 		public:
-			using NamespaceHashSet	= std::unordered_set<Namespace const*, EntityPtrNameHash, EntityPtrNameEqual>;
-			using ArchetypeHashSet	= std::unordered_set<Archetype const*, EntityPtrNameHash, EntityPtrNameEqual>;
-			using VariableHashSet	= std::unordered_set<Variable const*, EntityPtrNameHash, EntityPtrNameEqual>;
-			using FunctionHashSet	= std::unordered_multiset<Function const*, EntityPtrNameHash, EntityPtrNameEqual>;
+			using NamespaceTable	= NamespaceMemberTable<Namespace, false>;
+			using ArchetypeTable	= NamespaceMemberTable<Archetype, false>;
+			using VariableTable		= NamespaceMemberTable<Variable, false>;
+			using FunctionTable		= NamespaceMemberTable<Function, true>;
 
 		private:
 			/** Collection of all namespaces contained in this namespace. */
-			NamespaceHashSet	_namespaces;
+			NamespaceTable	_namespaces;
 
 			/** Collection of all archetypes contained in this namespace. */
-			ArchetypeHashSet	_archetypes;
+			ArchetypeTable	_archetypes;
 
 			/** Collection of all (non-member) variables contained in this namespace. */
-			VariableHashSet		_variables;
+			VariableTable	_variables;
 
 			/** Collection of all (non-member) functions contained in this namespace. */
-			FunctionHashSet		_functions;
+			FunctionTable	_functions;
 			
 		public:
 			inline NamespaceImpl(char const* name,
@@ -71,6 +69,19 @@ namespace rfk
 			*/
 			inline void										addFunction(Function const& function)					noexcept;
 
+			/**
+			*	@brief Reserve memory for the provided number of nested entities of each kind.
+			* 
+			*	@param namespacesCount	Number of nested namespaces.
+			*	@param archetypesCount	Number of nested archetypes.
+			*	@param variablesCount	Number of nested variables.
+			*	@param functionsCount	Number of nested functions.
+			*/
+			inline void										reserveMembers(std::size_t	namespacesCount,
+																		   std::size_t	archetypesCount,
+																		   std::size_t	variablesCount,
+																		   std::size_t	functionsCount)			noexcept;
+
 			/**
 			*	@brief Remove a nested namespace from this namespace.
 			* 
@@ -113,28 +124,38 @@ namespace rfk
 			* 
 			*	@return _namespaces.
 			*/
-			RFK_NODISCARD inline NamespaceHashSet const&	getNamespaces()										const	noexcept;
+			RFK_NODISCARD inline NamespaceTable const&		getNamespaces()										const	noexcept;
 
 			/**
 			*	@brief Getter for the field _archetypes.
 			* 
 			*	@return _archetypes.
 			*/
-			RFK_NODISCARD inline ArchetypeHashSet const&	getArchetypes()										const	noexcept;
+			RFK_NODISCARD inline ArchetypeTable const&		getArchetypes()										const	noexcept;
 
 			/**
 			*	@brief Getter for the field _variables.
 			* 
 			*	@return _variables.
 			*/
-			RFK_NODISCARD inline VariableHashSet const&		getVariables()										const	noexcept;
+			RFK_NODISCARD inline VariableTable const&		getVariables()										const	noexcept;
 
 			/**
 			*	@brief Getter for the field _functions.
 			* 
 			*	@return _functions.
 			*/
-			RFK_NODISCARD inline FunctionHashSet const&		getFunctions()										const	noexcept;
+			RFK_NODISCARD inline FunctionTable const&		getFunctions()										const	noexcept;
+
+			/**
+			*	@brief Get the size of this implementation, so that rfk::MetadataArena can reserve memory for rfk::Namespace entities.
+			* 
+			*	@return The size in bytes of this implementation.
+			*/
+			friend constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<Namespace>)	noexcept
+			{
+				return sizeof(NamespaceImpl);
+			}
 	};
 
 	#include "Refureku/TypeInfo/Namespace/NamespaceImpl.inl"
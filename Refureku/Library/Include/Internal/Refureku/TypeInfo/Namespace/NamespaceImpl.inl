@@ -12,42 +12,50 @@ inline Namespace::NamespaceImpl::NamespaceImpl(char const* name, std::size_t id)
 
 inline void Namespace::NamespaceImpl::addNamespace(Namespace const& nestedNamespace) noexcept
 {
-	_namespaces.emplace(&nestedNamespace);
+	_namespaces.insert(nestedNamespace);
 }
 
 inline void Namespace::NamespaceImpl::addArchetype(Archetype const& archetype) noexcept
 {
-	_archetypes.emplace(&archetype);
+	_archetypes.insert(archetype);
 }
 
 inline void Namespace::NamespaceImpl::addVariable(Variable const& variable) noexcept
 {
-	_variables.emplace(&variable);
+	_variables.insert(variable);
 }
 
 inline void Namespace::NamespaceImpl::addFunction(Function const& function) noexcept
 {
-	_functions.emplace(&function);
+	_functions.insert(function);
+}
+
+inline void Namespace::NamespaceImpl::reserveMembers(std::size_t namespacesCount, std::size_t archetypesCount, std::size_t variablesCount, std::size_t functionsCount) noexcept
+{
+	_namespaces.reserve(_namespaces.size() + namespacesCount);
+	_archetypes.reserve(_archetypes.size() + archetypesCount);
+	_variables.reserve(_variables.size() + variablesCount);
+	_functions.reserve(_functions.size() + functionsCount);
 }
 
 inline void Namespace::NamespaceImpl::removeNamespace(Namespace const& nestedNamespace) noexcept
 {
-	_namespaces.erase(&nestedNamespace);
+	_namespaces.erase(nestedNamespace);
 }
 
 inline void Namespace::NamespaceImpl::removeArchetype(Archetype const& archetype) noexcept
 {
-	_archetypes.erase(&archetype);
+	_archetypes.erase(archetype);
 }
 
 inline void Namespace::NamespaceImpl::removeVariable(Variable const& variable) noexcept
 {
-	_variables.erase(&variable);
+	_variables.erase(variable);
 }
 
 inline void Namespace::NamespaceImpl::removeFunction(Function const& function) noexcept
 {
-	_functions.erase(&function);
+	_functions.erase(function);
 }
 
 inline void Namespace::NamespaceImpl::setOuterEntity(Entity& entity, Namespace const& ref) const noexcept
@@ -55,22 +63,22 @@ inline void Namespace::NamespaceImpl::setOuterEntity(Entity& entity, Namespace c
 	entity.setOuterEntity(&ref);
 }
 
-inline Namespace::NamespaceImpl::NamespaceHashSet const& Namespace::NamespaceImpl::getNamespaces() const noexcept
+inline Namespace::NamespaceImpl::NamespaceTable const& Namespace::NamespaceImpl::getNamespaces() const noexcept
 {
 	return _namespaces;
 }
 
-inline Namespace::NamespaceImpl::ArchetypeHashSet const& Namespace::NamespaceImpl::getArchetypes() const noexcept
+inline Namespace::NamespaceImpl::ArchetypeTable const& Namespace::NamespaceImpl::getArchetypes() const noexcept
 {
 	return _archetypes;
 }
 
-inline Namespace::NamespaceImpl::VariableHashSet const& Namespace::NamespaceImpl::getVariables() const noexcept
+inline Namespace::NamespaceImpl::VariableTable const& Namespace::NamespaceImpl::getVariables() const noexcept
 {
 	return _variables;
 }
 
-inline Namespace::NamespaceImpl::FunctionHashSet const& Namespace::NamespaceImpl::getFunctions() const noexcept
+inline Namespace::NamespaceImpl::FunctionTable const& Namespace::NamespaceImpl::getFunctions() const noexcept
 {
 	return _functions;
 }
\ No newline at end of file
@@ -0,0 +1,165 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <string_view>
+#include <functional>	//std::hash
+#include <cstddef>		//std::size_t
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/FundamentalTypes.h"
+#include "Refureku/TypeInfo/Entity/Entity.h"
+
+namespace rfk
+{
+	/**
+	*	@brief	Flat collection of the entities of a given kind contained in a namespace.
+	*			Entities are stored contiguously in a vector, and hashed by name in an open addressing table of indices
+	*			(linear probing, load factor <= 0.5), so neither adding an entity nor iterating over them allocates per entity.
+	*			Removing an entity moves the last entity to its place, so the iteration order is unspecified.
+	*
+	*	@tparam EntityType				Type of the stored entities.
+	*	@tparam AllowSameNameEntities	If false, adding an entity named like a contained entity has no effect.
+	*/
+	template <typename EntityType, bool AllowSameNameEntities>
+	class NamespaceMemberTable
+	{
+		public:
+			using value_type		= EntityType const*;
+			using const_iterator	= typename std::vector<EntityType const*>::const_iterator;
+
+		private:
+			/** Slot value of an empty slot. Non-empty slots contain the index of an entity + 1. */
+			static constexpr uint32		emptySlot		= 0u;
+
+			/** Minimal number of slots allocated when the first entity is added. */
+			static constexpr std::size_t	minSlotsCount	= 16u;
+
+			/** Contained entities. */
+			std::vector<EntityType const*>	_entities;
+
+			/** Hash of the name of each entity, indexed like _entities. */
+			std::vector<std::size_t>		_nameHashes;
+
+			/** Open addressing table of entity indices. Its size is 0 or a power of 2. */
+			std::vector<uint32>				_slots;
+
+			/**
+			*	@brief Compute the hash of an entity name.
+			*
+			*	@param name Name of the entity.
+			*
+			*	@return The hash of the name.
+			*/
+			RFK_NODISCARD static inline std::size_t	hashName(std::string_view name)										noexcept;
+
+			/**
+			*	@brief Find the index of an entity by name.
+			*
+			*	@param name		Name of the searched entity.
+			*	@param nameHash	Hash of name.
+			*
+			*	@return The index of a contained entity with the provided name if any, else the number of contained entities.
+			*/
+			RFK_NODISCARD inline std::size_t		findEntityIndex(std::string_view	name,
+																	std::size_t			nameHash)			const	noexcept;
+
+			/**
+			*	@brief Get the index of the slot containing the provided entity index.
+			*
+			*	@param entityIndex Index of the entity in _entities.
+			*
+			*	@return The index of the slot containing entityIndex.
+			*/
+			RFK_NODISCARD inline std::size_t		getSlotIndex(std::size_t entityIndex)						const	noexcept;
+
+			/**
+			*	@brief Rebuild the slots table with the provided number of slots.
+			*
+			*	@param slotsCount New number of slots. Must be a power of 2 greater than twice the number of entities.
+			*/
+			inline void								rehash(std::size_t slotsCount)										noexcept;
+
+			/**
+			*	@brief Empty a slot, shifting back the following slots of its probe sequence so that no lookup is broken.
+			*
+			*	@param slotIndex Index of the emptied slot.
+			*/
+			inline void								eraseSlot(std::size_t slotIndex)									noexcept;
+
+		public:
+			/**
+			*	@brief Reserve memory for the provided total number of entities.
+			*
+			*	@param capacity Number of entities the table can contain without reallocation.
+			*/
+			inline void								reserve(std::size_t capacity)										noexcept;
+
+			/**
+			*	@brief Add an entity to the table.
+			*
+			*	@param entity The entity to add.
+			*
+			*	@return true if the entity was added, false if an entity with the same name is already contained and AllowSameNameEntities is false.
+			*/
+			inline bool								insert(EntityType const& entity)									noexcept;
+
+			/**
+			*	@brief Remove an entity from the table.
+			*
+			*	@param entity The entity to remove.
+			*
+			*	@return true if the entity was removed, false if it wasn't contained.
+			*/
+			inline bool								erase(EntityType const& entity)										noexcept;
+
+			/**
+			*	@brief	Find an entity named like the provided entity.
+			*			This overload makes the table usable with the Algorithm::getEntityByName functions.
+			*
+			*	@param searchedEntity Entity holding the searched name.
+			*
+			*	@return An iterator to a contained entity with the same name if any, else cend().
+			*/
+			RFK_NODISCARD inline const_iterator		find(Entity const* searchedEntity)							const	noexcept;
+
+			/**
+			*	@brief Find an entity by name.
+			*
+			*	@param name Name of the searched entity.
+			*
+			*	@return An iterator to a contained entity with the provided name if any, else cend().
+			*/
+			RFK_NODISCARD inline const_iterator		find(std::string_view name)									const	noexcept;
+
+			/**
+			*	@brief Execute the given visitor on all contained entities with the provided name.
+			*
+			*	@param name		Name of the visited entities.
+			*	@param visitor	Visitor called with each entity. Return false to abort the loop.
+			*
+			*	@return false if the visitor aborted the loop, else true.
+			*/
+			template <typename Visitor>
+			bool									foreachEntityNamed(std::string_view	name,
+																	   Visitor			visitor)				const;
+
+			/**
+			*	@brief Getters for the contained entities.
+			*/
+			RFK_NODISCARD inline const_iterator		begin()														const	noexcept;
+			RFK_NODISCARD inline const_iterator		end()														const	noexcept;
+			RFK_NODISCARD inline const_iterator		cbegin()													const	noexcept;
+			RFK_NODISCARD inline const_iterator		cend()														const	noexcept;
+			RFK_NODISCARD inline std::size_t		size()														const	noexcept;
+			RFK_NODISCARD inline bool				empty()														const	noexcept;
+	};
+
+	#include "Refureku/TypeInfo/Namespace/NamespaceMemberTable.inl"
+}
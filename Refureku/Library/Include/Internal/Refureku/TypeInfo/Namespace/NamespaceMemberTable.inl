@@ -0,0 +1,262 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline std::size_t NamespaceMemberTable<EntityType, AllowSameNameEntities>::hashName(std::string_view name) noexcept
+{
+	return std::hash<std::string_view>()(name);
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline std::size_t NamespaceMemberTable<EntityType, AllowSameNameEntities>::findEntityIndex(std::string_view name, std::size_t nameHash) const noexcept
+{
+	if (_slots.empty())
+	{
+		return _entities.size();
+	}
+
+	std::size_t const mask = _slots.size() - 1u;
+
+	for (std::size_t slotIndex = nameHash & mask; _slots[slotIndex] != emptySlot; slotIndex = (slotIndex + 1u) & mask)
+	{
+		std::size_t entityIndex = _slots[slotIndex] - 1u;
+
+		if (_nameHashes[entityIndex] == nameHash && name == _entities[entityIndex]->getName())
+		{
+			return entityIndex;
+		}
+	}
+
+	return _entities.size();
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline std::size_t NamespaceMemberTable<EntityType, AllowSameNameEntities>::getSlotIndex(std::size_t entityIndex) const noexcept
+{
+	std::size_t const mask		= _slots.size() - 1u;
+	std::size_t slotIndex		= _nameHashes[entityIndex] & mask;
+
+	while (_slots[slotIndex] != entityIndex + 1u)
+	{
+		slotIndex = (slotIndex + 1u) & mask;
+	}
+
+	return slotIndex;
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline void NamespaceMemberTable<EntityType, AllowSameNameEntities>::rehash(std::size_t slotsCount) noexcept
+{
+	_slots.assign(slotsCount, emptySlot);
+
+	std::size_t const mask = slotsCount - 1u;
+
+	for (std::size_t entityIndex = 0u; entityIndex < _entities.size(); entityIndex++)
+	{
+		std::size_t slotIndex = _nameHashes[entityIndex] & mask;
+
+		while (_slots[slotIndex] != emptySlot)
+		{
+			slotIndex = (slotIndex + 1u) & mask;
+		}
+
+		_slots[slotIndex] = static_cast<uint32>(entityIndex + 1u);
+	}
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline void NamespaceMemberTable<EntityType, AllowSameNameEntities>::eraseSlot(std::size_t slotIndex) noexcept
+{
+	std::size_t const	mask	= _slots.size() - 1u;
+	std::size_t			hole	= slotIndex;
+
+	for (std::size_t current = (slotIndex + 1u) & mask; _slots[current] != emptySlot; current = (current + 1u) & mask)
+	{
+		std::size_t homeSlotIndex = _nameHashes[_slots[current] - 1u] & mask;
+
+		//Move the entry to the hole if the hole is between its home slot and its current slot
+		if (((current - homeSlotIndex) & mask) >= ((current - hole) & mask))
+		{
+			_slots[hole]	= _slots[current];
+			hole			= current;
+		}
+	}
+
+	_slots[hole] = emptySlot;
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline void NamespaceMemberTable<EntityType, AllowSameNameEntities>::reserve(std::size_t capacity) noexcept
+{
+	//Don't allocate anything when the table already contains enough entities, including when reserving 0 in an empty table
+	if (capacity <= size())
+	{
+		return;
+	}
+
+	_entities.reserve(capacity);
+	_nameHashes.reserve(capacity);
+
+	std::size_t slotsCount = minSlotsCount;
+
+	while (slotsCount < capacity * 2u)
+	{
+		slotsCount *= 2u;
+	}
+
+	if (slotsCount > _slots.size())
+	{
+		rehash(slotsCount);
+	}
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline bool NamespaceMemberTable<EntityType, AllowSameNameEntities>::insert(EntityType const& entity) noexcept
+{
+	std::string_view	name		= entity.getName();
+	std::size_t			nameHash	= hashName(name);
+
+	if constexpr (!AllowSameNameEntities)
+	{
+		if (findEntityIndex(name, nameHash) != _entities.size())
+		{
+			return false;
+		}
+	}
+
+	if ((_entities.size() + 1u) * 2u > _slots.size())
+	{
+		rehash((_slots.empty()) ? minSlotsCount : _slots.size() * 2u);
+	}
+
+	std::size_t const	mask		= _slots.size() - 1u;
+	std::size_t			slotIndex	= nameHash & mask;
+
+	while (_slots[slotIndex] != emptySlot)
+	{
+		slotIndex = (slotIndex + 1u) & mask;
+	}
+
+	_entities.push_back(&entity);
+	_nameHashes.push_back(nameHash);
+	_slots[slotIndex] = static_cast<uint32>(_entities.size());
+
+	return true;
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline bool NamespaceMemberTable<EntityType, AllowSameNameEntities>::erase(EntityType const& entity) noexcept
+{
+	if (_slots.empty())
+	{
+		return false;
+	}
+
+	std::size_t const	mask		= _slots.size() - 1u;
+	std::size_t			slotIndex	= hashName(entity.getName()) & mask;
+
+	while (_slots[slotIndex] != emptySlot && _entities[_slots[slotIndex] - 1u] != &entity)
+	{
+		slotIndex = (slotIndex + 1u) & mask;
+	}
+
+	if (_slots[slotIndex] == emptySlot)
+	{
+		return false;
+	}
+
+	std::size_t entityIndex			= _slots[slotIndex] - 1u;
+	std::size_t lastEntityIndex		= _entities.size() - 1u;
+
+	eraseSlot(slotIndex);
+
+	//Move the last entity to the removed entity index to keep the storage contiguous
+	if (entityIndex != lastEntityIndex)
+	{
+		_slots[getSlotIndex(lastEntityIndex)]	= static_cast<uint32>(entityIndex + 1u);
+		_entities[entityIndex]					= _entities[lastEntityIndex];
+		_nameHashes[entityIndex]				= _nameHashes[lastEntityIndex];
+	}
+
+	_entities.pop_back();
+	_nameHashes.pop_back();
+
+	return true;
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline typename NamespaceMemberTable<EntityType, AllowSameNameEntities>::const_iterator NamespaceMemberTable<EntityType, AllowSameNameEntities>::find(Entity const* searchedEntity) const noexcept
+{
+	return find(std::string_view(searchedEntity->getName()));
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline typename NamespaceMemberTable<EntityType, AllowSameNameEntities>::const_iterator NamespaceMemberTable<EntityType, AllowSameNameEntities>::find(std::string_view name) const noexcept
+{
+	return _entities.cbegin() + findEntityIndex(name, hashName(name));
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+template <typename Visitor>
+bool NamespaceMemberTable<EntityType, AllowSameNameEntities>::foreachEntityNamed(std::string_view name, Visitor visitor) const
+{
+	if (_slots.empty())
+	{
+		return true;
+	}
+
+	std::size_t const	mask		= _slots.size() - 1u;
+	std::size_t const	nameHash	= hashName(name);
+
+	for (std::size_t slotIndex = nameHash & mask; _slots[slotIndex] != emptySlot; slotIndex = (slotIndex + 1u) & mask)
+	{
+		std::size_t entityIndex = _slots[slotIndex] - 1u;
+
+		if (_nameHashes[entityIndex] == nameHash && name == _entities[entityIndex]->getName() && !visitor(*_entities[entityIndex]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline typename NamespaceMemberTable<EntityType, AllowSameNameEntities>::const_iterator NamespaceMemberTable<EntityType, AllowSameNameEntities>::begin() const noexcept
+{
+	return _entities.cbegin();
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline typename NamespaceMemberTable<EntityType, AllowSameNameEntities>::const_iterator NamespaceMemberTable<EntityType, AllowSameNameEntities>::end() const noexcept
+{
+	return _entities.cend();
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline typename NamespaceMemberTable<EntityType, AllowSameNameEntities>::const_iterator NamespaceMemberTable<EntityType, AllowSameNameEntities>::cbegin() const noexcept
+{
+	return _entities.cbegin();
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline typename NamespaceMemberTable<EntityType, AllowSameNameEntities>::const_iterator NamespaceMemberTable<EntityType, AllowSameNameEntities>::cend() const noexcept
+{
+	return _entities.cend();
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline std::size_t NamespaceMemberTable<EntityType, AllowSameNameEntities>::size() const noexcept
+{
+	return _entities.size();
+}
+
+template <typename EntityType, bool AllowSameNameEntities>
+inline bool NamespaceMemberTable<EntityType, AllowSameNameEntities>::empty() const noexcept
+{
+	return _entities.empty();
+}
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "Refureku/TypeInfo/Type.h"
+#include "Refureku/TypeInfo/MetadataArena.h"
 #include "Refureku/TypeInfo/Archetypes/Archetype.h"
 
 namespace rfk
@@ -24,6 +25,13 @@ namespace rfk
 			Archetype const*		_archetype = nullptr;
 
 		public:
+			/**
+			*	@brief	Types implementations are allocated from the metadata arena in use in the current thread if any.
+			*			See rfk::MetadataArena.
+			*/
+			inline static void*	operator new(std::size_t size);
+			inline static void	operator delete(void* ptr)	noexcept;
+
 			/**
 			*	@brief Add a default-constructed type part to this type.
 			* 
@@ -5,6 +5,16 @@
 *	See the LICENSE.md file for full license details.
 */
 
+inline void* Type::TypeImpl::operator new(std::size_t size)
+{
+	return MetadataArena::allocate(size);
+}
+
+inline void Type::TypeImpl::operator delete(void* ptr) noexcept
+{
+	MetadataArena::deallocate(ptr);
+}
+
 inline TypePart& Type::TypeImpl::addTypePart() noexcept
 {
 	return _parts.emplace_back();
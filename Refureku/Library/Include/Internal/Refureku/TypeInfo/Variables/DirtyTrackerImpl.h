@@ -0,0 +1,109 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <unordered_map>
+#include <algorithm>	//std::copy
+#include <atomic>
+#include <cassert>
+
+#include "Refureku/TypeInfo/Variables/DirtyTracker.h"
+#include "Refureku/TypeInfo/Variables/Field.h"
+#include "Refureku/TypeInfo/Archetypes/Struct.h"
+#include "Refureku/Misc/FundamentalTypes.h"
+
+namespace rfk
+{
+	class DirtyTracker::DirtyTrackerImpl final
+	{
+		private:
+			/** Number of dirty bits stored in a word. */
+			static constexpr std::size_t	bitsPerWord = sizeof(uint64) * 8u;
+
+			/** Tracked struct. */
+			Struct const*								_archetype;
+
+			/** Fields of the tracked struct, indexed by Field::getIndex. */
+			std::vector<Field const*>					_fieldsByIndex;
+
+			/** Number of words storing the dirty bits of an instance. */
+			std::size_t									_wordsPerInstance;
+
+			/** Index of each dirty instance in _dirtyInstances. */
+			std::unordered_map<void const*, std::size_t>	_dirtyInstanceIndices;
+
+			/** Instances having at least one dirty field. */
+			std::vector<void const*>					_dirtyInstances;
+
+			/** Dirty bits of each dirty instance, _wordsPerInstance words per instance in _dirtyInstances order. */
+			std::vector<uint64>							_dirtyBits;
+
+#if RFK_DEBUG
+			/** Set while the tracker is modified, to detect concurrent writes to the tracked struct fields. */
+			std::atomic<bool>							_isBeingModified{false};
+
+			/**
+			*	Assert that the tracker is not modified by another thread during the lifetime of the guard.
+			*/
+			class ModificationGuard final
+			{
+				private:
+					std::atomic<bool>&	_isBeingModified;
+
+				public:
+					inline ModificationGuard(std::atomic<bool>& isBeingModified)	noexcept;
+					inline ~ModificationGuard()										noexcept;
+			};
+#endif
+
+			/**
+			*	@brief Get the dirty bits of an instance.
+			*
+			*	@param instance The instance.
+			*
+			*	@return The first word of the instance dirty bits, nullptr if the instance has no dirty field.
+			*/
+			RFK_NODISCARD inline uint64 const*			findDirtyBits(void const* instance)		const	noexcept;
+
+		public:
+			inline DirtyTrackerImpl(Struct const& archetype)	noexcept;
+
+			inline void									markDirty(void const*	instance,
+																  std::size_t	fieldIndex);
+
+			RFK_NODISCARD inline bool					isDirty(void const*	instance,
+																std::size_t	fieldIndex)			const	noexcept;
+
+			RFK_NODISCARD inline bool					isDirty(void const* instance)			const	noexcept;
+
+			inline bool									foreachDirtyField(void const*		instance,
+																		  Visitor<Field>	visitor,
+																		  void*				userData)	const;
+
+			inline void									clearDirty(void const* instance)				noexcept;
+
+			inline void									clearAllDirty()									noexcept;
+
+			/**
+			*	@brief Getter for the field _dirtyInstances.
+			* 
+			*	@return _dirtyInstances.
+			*/
+			RFK_NODISCARD inline std::vector<void const*> const&	getDirtyInstances()			const	noexcept;
+
+			/**
+			*	@brief Getter for the field _archetype.
+			* 
+			*	@return _archetype.
+			*/
+			RFK_NODISCARD inline Struct const&			getArchetype()							const	noexcept;
+	};
+
+	#include "Refureku/TypeInfo/Variables/DirtyTrackerImpl.inl"
+}
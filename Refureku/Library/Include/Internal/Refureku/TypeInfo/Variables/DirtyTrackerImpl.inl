@@ -0,0 +1,161 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline DirtyTracker::DirtyTrackerImpl::DirtyTrackerImpl(Struct const& archetype) noexcept:
+	_archetype{&archetype},
+	_fieldsByIndex(archetype.getFieldsCount(), nullptr),
+	_wordsPerInstance{(archetype.getFieldsCount() + bitsPerWord - 1u) / bitsPerWord}
+{
+	archetype.foreachField([](Field const& field, void* userData)
+						   {
+							   (*reinterpret_cast<std::vector<Field const*>*>(userData))[field.getIndex()] = &field;
+
+							   return true;
+						   }, &_fieldsByIndex, true);
+}
+
+#if RFK_DEBUG
+inline DirtyTracker::DirtyTrackerImpl::ModificationGuard::ModificationGuard(std::atomic<bool>& isBeingModified) noexcept:
+	_isBeingModified{isBeingModified}
+{
+	[[maybe_unused]] bool wasBeingModified = _isBeingModified.exchange(true, std::memory_order_acquire);
+
+	assert(!wasBeingModified && "The fields of a tracked struct were written concurrently, see rfk::DirtyTracker.");
+}
+
+inline DirtyTracker::DirtyTrackerImpl::ModificationGuard::~ModificationGuard() noexcept
+{
+	_isBeingModified.store(false, std::memory_order_release);
+}
+#endif
+
+inline uint64 const* DirtyTracker::DirtyTrackerImpl::findDirtyBits(void const* instance) const noexcept
+{
+	auto it = _dirtyInstanceIndices.find(instance);
+
+	return (it != _dirtyInstanceIndices.cend()) ? _dirtyBits.data() + it->second * _wordsPerInstance : nullptr;
+}
+
+inline void DirtyTracker::DirtyTrackerImpl::markDirty(void const* instance, std::size_t fieldIndex)
+{
+#if RFK_DEBUG
+	ModificationGuard guard(_isBeingModified);
+#endif
+
+	//Fields added to the struct after the tracker was created are not tracked
+	if (fieldIndex >= _fieldsByIndex.size())
+	{
+		return;
+	}
+
+	auto [it, inserted] = _dirtyInstanceIndices.emplace(instance, _dirtyInstances.size());
+
+	if (inserted)
+	{
+		_dirtyInstances.push_back(instance);
+		_dirtyBits.resize(_dirtyBits.size() + _wordsPerInstance, 0u);
+	}
+
+	_dirtyBits[it->second * _wordsPerInstance + fieldIndex / bitsPerWord] |= uint64(1u) << (fieldIndex % bitsPerWord);
+}
+
+inline bool DirtyTracker::DirtyTrackerImpl::isDirty(void const* instance, std::size_t fieldIndex) const noexcept
+{
+	uint64 const* dirtyBits = findDirtyBits(instance);
+
+	return dirtyBits != nullptr && fieldIndex < _fieldsByIndex.size() &&
+			(dirtyBits[fieldIndex / bitsPerWord] & (uint64(1u) << (fieldIndex % bitsPerWord))) != 0u;
+}
+
+inline bool DirtyTracker::DirtyTrackerImpl::isDirty(void const* instance) const noexcept
+{
+	//Only instances having at least one dirty field are stored
+	return _dirtyInstanceIndices.find(instance) != _dirtyInstanceIndices.cend();
+}
+
+inline bool DirtyTracker::DirtyTrackerImpl::foreachDirtyField(void const* instance, Visitor<Field> visitor, void* userData) const
+{
+	uint64 const* dirtyBits = findDirtyBits(instance);
+
+	if (visitor == nullptr || dirtyBits == nullptr)
+	{
+		return false;
+	}
+
+	bool result = true;
+
+	for (std::size_t wordIndex = 0u; wordIndex < _wordsPerInstance; wordIndex++)
+	{
+		//Skip clean words, then stop as soon as the remaining bits of the word are clean
+		for (uint64 word = dirtyBits[wordIndex], bitIndex = 0u; word != 0u; word >>= 1u, bitIndex++)
+		{
+			if ((word & 1u) != 0u)
+			{
+				result = visitor(*_fieldsByIndex[wordIndex * bitsPerWord + bitIndex], userData);
+
+				if (!result)
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+inline void DirtyTracker::DirtyTrackerImpl::clearDirty(void const* instance) noexcept
+{
+#if RFK_DEBUG
+	ModificationGuard guard(_isBeingModified);
+#endif
+
+	auto it = _dirtyInstanceIndices.find(instance);
+
+	if (it == _dirtyInstanceIndices.end())
+	{
+		return;
+	}
+
+	//Move the last dirty instance to the cleared slot
+	std::size_t index		= it->second;
+	std::size_t lastIndex	= _dirtyInstances.size() - 1u;
+
+	if (index != lastIndex)
+	{
+		_dirtyInstances[index] = _dirtyInstances[lastIndex];
+		_dirtyInstanceIndices[_dirtyInstances[index]] = index;
+
+		std::copy(_dirtyBits.begin() + lastIndex * _wordsPerInstance, _dirtyBits.begin() + (lastIndex + 1u) * _wordsPerInstance,
+				  _dirtyBits.begin() + index * _wordsPerInstance);
+	}
+
+	_dirtyInstanceIndices.erase(it);
+	_dirtyInstances.pop_back();
+	_dirtyBits.resize(lastIndex * _wordsPerInstance);
+}
+
+inline void DirtyTracker::DirtyTrackerImpl::clearAllDirty() noexcept
+{
+#if RFK_DEBUG
+	ModificationGuard guard(_isBeingModified);
+#endif
+
+	_dirtyInstanceIndices.clear();
+	_dirtyInstances.clear();
+	_dirtyBits.clear();
+}
+
+inline std::vector<void const*> const& DirtyTracker::DirtyTrackerImpl::getDirtyInstances() const noexcept
+{
+	return _dirtyInstances;
+}
+
+inline Struct const& DirtyTracker::DirtyTrackerImpl::getArchetype() const noexcept
+{
+	return *_archetype;
+}
@@ -18,6 +18,9 @@ namespace rfk
 			/** Memory offset in bytes of this field in its owner class. */
 			std::size_t	_memoryOffset	= 0u;
 
+			/** Index of this field in its owner struct. */
+			std::size_t	_index			= 0u;
+
 		public:
 			inline FieldImpl(char const*		name,
 							 std::size_t		id,
@@ -25,6 +28,7 @@ namespace rfk
 							 EFieldFlags		flags,
 							 Struct const*	owner,
 							 std::size_t		memoryOffset,
+							 std::size_t		index,
 							 Entity const*	outerEntity = nullptr)	noexcept;
 
 			/**
@@ -33,6 +37,23 @@ namespace rfk
 			*	@return _memoryOffset.
 			*/
 			inline std::size_t	getMemoryOffset()						const	noexcept;
+
+			/**
+			*	@brief Getter for the field _index.
+			* 
+			*	@return _index.
+			*/
+			inline std::size_t	getIndex()								const	noexcept;
+
+			/**
+			*	@brief Get the size of this implementation, so that rfk::MetadataArena can reserve memory for rfk::Field entities.
+			* 
+			*	@return The size in bytes of this implementation.
+			*/
+			friend constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<Field>)	noexcept
+			{
+				return sizeof(FieldImpl);
+			}
 	};
 
 	#include "Refureku/TypeInfo/Variables/FieldImpl.inl"
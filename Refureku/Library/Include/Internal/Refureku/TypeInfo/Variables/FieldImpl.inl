@@ -6,13 +6,19 @@
 */
 
 inline Field::FieldImpl::FieldImpl(char const* name, std::size_t id, Type const& type, EFieldFlags flags,
-									  Struct const* owner, std::size_t memoryOffset, Entity const* outerEntity) noexcept:
+									  Struct const* owner, std::size_t memoryOffset, std::size_t index, Entity const* outerEntity) noexcept:
 	FieldBaseImpl(name, id, type, flags, owner, outerEntity),
-	_memoryOffset{memoryOffset}
+	_memoryOffset{memoryOffset},
+	_index{index}
 {
 }
 
 inline std::size_t Field::FieldImpl::getMemoryOffset() const noexcept
 {
 	return _memoryOffset;
+}
+
+inline std::size_t Field::FieldImpl::getIndex() const noexcept
+{
+	return _index;
 }
\ No newline at end of file
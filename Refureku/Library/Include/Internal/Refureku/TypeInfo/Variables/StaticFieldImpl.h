@@ -51,6 +51,16 @@ namespace rfk
 			*	@return _constPtr.
 			*/
 			RFK_NODISCARD inline void const*	getConstPtr()	const	noexcept;
+
+			/**
+			*	@brief Get the size of this implementation, so that rfk::MetadataArena can reserve memory for rfk::StaticField entities.
+			* 
+			*	@return The size in bytes of this implementation.
+			*/
+			friend constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<StaticField>)	noexcept
+			{
+				return sizeof(StaticFieldImpl);
+			}
 	};
 
 	#include "Refureku/TypeInfo/Variables/StaticFieldImpl.inl"
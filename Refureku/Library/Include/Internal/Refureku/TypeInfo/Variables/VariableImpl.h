@@ -57,6 +57,16 @@ namespace rfk
 			*	@return _constPtr.
 			*/
 			RFK_NODISCARD inline void const*	getConstPtr()	const	noexcept;
+
+			/**
+			*	@brief Get the size of this implementation, so that rfk::MetadataArena can reserve memory for rfk::Variable entities.
+			* 
+			*	@return The size in bytes of this implementation.
+			*/
+			friend constexpr std::size_t	getEntityImplSize(internal::EntityImplSizeTag<Variable>)	noexcept
+			{
+				return sizeof(VariableImpl);
+			}
 	};
 
 	#include "Refureku/TypeInfo/Variables/VariableImpl.inl"
@@ -44,6 +44,13 @@
 #define RFK_NODISCARD	[[nodiscard]]
 #define RFK_NORETURN	[[noreturn]]
 
+//Branch prediction hint for conditions which are almost always false
+#if defined(__GNUC__) || defined(__clang__)
+	#define RFK_UNLIKELY(condition)	__builtin_expect(!!(condition), 0)
+#else
+	#define RFK_UNLIKELY(condition)	(condition)
+#endif
+
 //Dynamic library import/export
 #if defined(KODGEN_PARSING)
 
@@ -9,11 +9,14 @@
 
 #include <array>
 #include <cstddef>	//std::size_t, std::ptrdiff_t
+#include <type_traits>	//std::integral_constant
 
 #include "Refureku/Config.h"
+#include "Refureku/Misc/FundamentalTypes.h"
 #include "Refureku/Misc/TypeTraitsMacros.h"
 #include "Refureku/TypeInfo/Archetypes/GetArchetype.h"
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
+#include "Refureku/TypeInfo/Archetypes/EArchetypeTraits.h"
 #include "Refureku/Misc/SharedPtr.h"
 
 #ifndef _RFK_UNPACK_IF_NOT_PARSING
@@ -56,6 +59,16 @@ namespace rfk::internal
 			template <typename Derived, typename Base>
 			RFK_NODISCARD static constexpr std::ptrdiff_t	computeClassPointerOffset()					noexcept;
 
+			/**
+			*	@brief	Compute the layout and lifetime traits of the provided type.
+			* 
+			*	@tparam T Target type.
+			* 
+			*	@return The traits of T, combined as flags.
+			*/
+			template <typename T>
+			RFK_NODISCARD static constexpr EArchetypeTraits	computeArchetypeTraits()					noexcept;
+
 			/**
 			*	@brief	Retrieve the number of reflected fields of the provided class.
 			* 
@@ -76,6 +89,17 @@ namespace rfk::internal
 			template <typename ClassType>
 			RFK_NODISCARD static std::size_t				getReflectedStaticFieldsCount()				noexcept;
 
+			/**
+			*	@brief	Retrieve the default constructed instance of a property type shared by all entities
+			*			carrying this property without arguments.
+			* 
+			*	@tparam PropertyType Type of the property.
+			* 
+			*	@return The shared default constructed instance of the property.
+			*/
+			template <typename PropertyType>
+			RFK_NODISCARD static PropertyType const&		getDefaultProperty()						noexcept;
+
 			/**
 			*	@brief	Instantiate a class if it is default constructible.
 			*			This is the default method used to instantiate classes through Struct::makeSharedInstance.
@@ -224,5 +248,37 @@ __RFK_DISABLE_WARNING_POP
 		return name.data();
 	}
 
+	/**
+	*	@brief	Compute the id of an entity nested in the class ClassType at compile time.
+	*			The id is the 64-bit FNV-1a hash of the entity id followed by the typename of ClassType,
+	*			so it doesn't depend on the standard library implementation.
+	* 
+	*	@tparam ClassType Class containing the entity.
+	* 
+	*	@param entityId Id of the entity generated by the parser.
+	* 
+	*	@return The id of the entity in ClassType.
+	*/
+	template <typename ClassType, std::size_t EntityIdLength>
+	constexpr std::size_t computeClassNestedEntityId(char const (&entityId)[EntityIdLength]) noexcept
+	{
+		constexpr auto	typename_	= getTypenameAsArray<ClassType>();
+		uint64			result		= 14695981039346656037ull;
+
+		for (std::size_t i = 0u; i < EntityIdLength - 1u; i++)
+		{
+			result ^= static_cast<uint8>(entityId[i]);
+			result *= 1099511628211ull;
+		}
+
+		for (std::size_t i = 0u; i < typename_.size() - 1u; i++)
+		{
+			result ^= static_cast<uint8>(typename_[i]);
+			result *= 1099511628211ull;
+		}
+
+		return static_cast<std::size_t>(result);
+	}
+
 	#include "Refureku/Misc/CodeGenerationHelpers.inl"
 }
\ No newline at end of file
@@ -30,6 +30,44 @@ constexpr std::ptrdiff_t CodeGenerationHelpers::computeClassPointerOffset() noex
 	return reinterpret_cast<std::intptr_t>(basePtr) - reinterpret_cast<std::intptr_t>(derivedPtr);
 }
 
+template <typename T>
+constexpr EArchetypeTraits CodeGenerationHelpers::computeArchetypeTraits() noexcept
+{
+	EArchetypeTraits result = EArchetypeTraits::Default;
+
+	if constexpr (std::is_trivially_copyable_v<T>)
+	{
+		result = result | EArchetypeTraits::TriviallyCopyable;
+	}
+
+	if constexpr (std::is_trivially_destructible_v<T>)
+	{
+		result = result | EArchetypeTraits::TriviallyDestructible;
+	}
+
+	if constexpr (std::is_default_constructible_v<T>)
+	{
+		result = result | EArchetypeTraits::DefaultConstructible;
+	}
+
+	if constexpr (std::is_trivially_default_constructible_v<T>)
+	{
+		result = result | EArchetypeTraits::TriviallyConstructible;
+	}
+
+	if constexpr (std::is_standard_layout_v<T>)
+	{
+		result = result | EArchetypeTraits::StandardLayout;
+	}
+
+	if constexpr (std::is_polymorphic_v<T>)
+	{
+		result = result | EArchetypeTraits::Polymorphic;
+	}
+
+	return result;
+}
+
 template <typename ClassType>
 std::size_t CodeGenerationHelpers::getReflectedFieldsCount() noexcept
 {
@@ -50,6 +88,14 @@ std::size_t CodeGenerationHelpers::getReflectedStaticFieldsCount() noexcept
 	return (archetype != nullptr) ? archetype->getStaticFieldsCount() : 0u;
 }
 
+template <typename PropertyType>
+PropertyType const& CodeGenerationHelpers::getDefaultProperty() noexcept
+{
+	static PropertyType const property{};
+
+	return property;
+}
+
 template <typename T>
 rfk::SharedPtr<T> CodeGenerationHelpers::defaultSharedInstantiator()
 #if !defined(__GNUC__) || defined (__clang__) || __GNUC__ > 9
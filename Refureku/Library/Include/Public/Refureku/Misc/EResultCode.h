@@ -0,0 +1,44 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Refureku/Misc/FundamentalTypes.h"
+
+namespace rfk
+{
+	/**
+	*	Status of a non-throwing operation (see rfk::Result).
+	*	Each failure code maps to the exception the throwing version of the operation would have thrown.
+	*/
+	enum class EResultCode : uint8
+	{
+		/** The operation succeeded. */
+		Success = 0,
+
+		/** The number of provided arguments doesn't match the function parameters count (ArgCountMismatch). */
+		ArgCountMismatch,
+
+		/** The type of a provided argument doesn't match the function parameter type (ArgTypeMismatch). */
+		ArgTypeMismatch,
+
+		/** The provided return type doesn't match the function return type (ReturnTypeMismatch). */
+		ReturnTypeMismatch,
+
+		/** A const object was accessed in a non-const way (ConstViolation). */
+		ConstViolation,
+
+		/** The provided instance can't be used with the entity (InvalidArchetype). */
+		InvalidArchetype,
+
+		/** No instantiator matching the provided arguments was found. */
+		NoMatchingInstantiator,
+
+		/** The matching instantiator was called but returned nullptr. */
+		InstantiatorReturnedNull
+	};
+}
@@ -0,0 +1,157 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <type_traits>	//std::conditional_t, std::is_reference_v
+#include <utility>		//std::forward, std::move
+#include <new>			//placement new
+#include <cassert>
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/EResultCode.h"
+
+namespace rfk
+{
+	/**
+	*	Result of a non-throwing operation: either a value of type T, or a failure code.
+	*	T can be a value type or a reference (in which case only the referenced object address is stored).
+	*/
+	template <typename T>
+	class RFK_NODISCARD Result
+	{
+		private:
+			using StorageType = std::conditional_t<std::is_reference_v<T>, std::remove_reference_t<T>*, T>;
+
+			/** Tag used to select the success constructor. */
+			struct SuccessTag {};
+
+			union
+			{
+				/** Value stored in the result, only valid if _code is EResultCode::Success. */
+				StorageType	_value;
+			};
+
+			/** Status of the operation. */
+			EResultCode		_code;
+
+			template <typename... ArgTypes>
+			explicit Result(SuccessTag, ArgTypes&&... args);
+			explicit Result(EResultCode code)	noexcept;
+
+			/**
+			*	@brief Destroy the stored value if any.
+			*/
+			void	destroyValue()	noexcept;
+
+		public:
+			/**
+			*	@brief Make a successful result.
+			* 
+			*	@param args Arguments forwarded to the value constructor. If T is a reference, args must be a single object T refers to.
+			* 
+			*	@return The successful result.
+			*/
+			template <typename... ArgTypes>
+			static Result	makeSuccess(ArgTypes&&... args);
+
+			/**
+			*	@brief Make a failed result.
+			* 
+			*	@param code Failure code. Must be different from EResultCode::Success.
+			* 
+			*	@return The failed result.
+			*/
+			static Result	makeFailure(EResultCode code)	noexcept;
+
+			Result(Result const& other);
+			Result(Result&& other)							noexcept(std::is_nothrow_move_constructible_v<StorageType>);
+			~Result()										noexcept;
+
+			/**
+			*	@return true if the operation succeeded (and the result holds a value), else false.
+			*/
+			RFK_NODISCARD bool			isSuccess()		const	noexcept;
+
+			/**
+			*	@return The status of the operation.
+			*/
+			RFK_NODISCARD EResultCode	getCode()		const	noexcept;
+
+			/**
+			*	@brief	Get the value stored in this result.
+			*			Calling this method on a failed result is undefined behaviour.
+			* 
+			*	@return The value stored in this result.
+			*/
+			RFK_NODISCARD T&			getValue()		&		noexcept;
+			RFK_NODISCARD T const&		getValue()		const&	noexcept;
+			RFK_NODISCARD T&&			getValue()		&&		noexcept;
+
+			explicit operator bool()					const	noexcept;
+
+			Result& operator=(Result const& other);
+			Result& operator=(Result&& other)				noexcept(std::is_nothrow_move_constructible_v<StorageType>);
+	};
+
+	/**
+	*	Result of a non-throwing operation that doesn't produce any value.
+	*/
+	template <>
+	class RFK_NODISCARD Result<void>
+	{
+		private:
+			/** Status of the operation. */
+			EResultCode	_code;
+
+			explicit Result(EResultCode code)	noexcept;
+
+		public:
+			/**
+			*	@brief Make a successful result.
+			* 
+			*	@return The successful result.
+			*/
+			static Result	makeSuccess()					noexcept;
+
+			/**
+			*	@brief Make a failed result.
+			* 
+			*	@param code Failure code. Must be different from EResultCode::Success.
+			* 
+			*	@return The failed result.
+			*/
+			static Result	makeFailure(EResultCode code)	noexcept;
+
+			/**
+			*	@return true if the operation succeeded, else false.
+			*/
+			RFK_NODISCARD bool			isSuccess()		const	noexcept;
+
+			/**
+			*	@return The status of the operation.
+			*/
+			RFK_NODISCARD EResultCode	getCode()		const	noexcept;
+
+			explicit operator bool()					const	noexcept;
+	};
+
+	namespace internal
+	{
+		/**
+		*	@brief Wrap the result of the provided call in a successful Result<T>.
+		* 
+		*	@param call Callable returning a T.
+		* 
+		*	@return The successful result holding the call result.
+		*/
+		template <typename T, typename Callable>
+		Result<T>	makeSuccessfulResult(Callable&& call);
+	}
+
+	#include "Refureku/Misc/Result.inl"
+}
@@ -0,0 +1,234 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+////////////////// Result<T>
+
+template <typename T>
+template <typename... ArgTypes>
+Result<T>::Result(SuccessTag, ArgTypes&&... args):
+	_code{EResultCode::Success}
+{
+	if constexpr (std::is_reference_v<T>)
+	{
+		static_assert(sizeof...(ArgTypes) == 1u, "A reference result must be made from a single object.");
+
+		new (&_value) StorageType(&static_cast<std::remove_reference_t<T>&>(args)...);
+	}
+	else
+	{
+		new (&_value) StorageType(std::forward<ArgTypes>(args)...);
+	}
+}
+
+template <typename T>
+Result<T>::Result(EResultCode code) noexcept:
+	_code{code}
+{
+}
+
+template <typename T>
+Result<T>::Result(Result const& other):
+	_code{other._code}
+{
+	if (other.isSuccess())
+	{
+		new (&_value) StorageType(other._value);
+	}
+}
+
+template <typename T>
+Result<T>::Result(Result&& other) noexcept(std::is_nothrow_move_constructible_v<StorageType>):
+	_code{other._code}
+{
+	if (other.isSuccess())
+	{
+		new (&_value) StorageType(std::move(other._value));
+	}
+}
+
+template <typename T>
+Result<T>::~Result() noexcept
+{
+	destroyValue();
+}
+
+template <typename T>
+void Result<T>::destroyValue() noexcept
+{
+	if constexpr (!std::is_trivially_destructible_v<StorageType>)
+	{
+		if (isSuccess())
+		{
+			_value.~StorageType();
+		}
+	}
+}
+
+template <typename T>
+template <typename... ArgTypes>
+Result<T> Result<T>::makeSuccess(ArgTypes&&... args)
+{
+	return Result(SuccessTag{}, std::forward<ArgTypes>(args)...);
+}
+
+template <typename T>
+Result<T> Result<T>::makeFailure(EResultCode code) noexcept
+{
+	assert(code != EResultCode::Success);
+
+	return Result(code);
+}
+
+template <typename T>
+bool Result<T>::isSuccess() const noexcept
+{
+	return _code == EResultCode::Success;
+}
+
+template <typename T>
+EResultCode Result<T>::getCode() const noexcept
+{
+	return _code;
+}
+
+template <typename T>
+T& Result<T>::getValue() & noexcept
+{
+	assert(isSuccess());
+
+	if constexpr (std::is_reference_v<T>)
+	{
+		return *_value;
+	}
+	else
+	{
+		return _value;
+	}
+}
+
+template <typename T>
+T const& Result<T>::getValue() const& noexcept
+{
+	assert(isSuccess());
+
+	if constexpr (std::is_reference_v<T>)
+	{
+		return *_value;
+	}
+	else
+	{
+		return _value;
+	}
+}
+
+template <typename T>
+T&& Result<T>::getValue() && noexcept
+{
+	assert(isSuccess());
+
+	if constexpr (std::is_reference_v<T>)
+	{
+		return static_cast<T&&>(*_value);
+	}
+	else
+	{
+		return std::move(_value);
+	}
+}
+
+template <typename T>
+Result<T>::operator bool() const noexcept
+{
+	return isSuccess();
+}
+
+template <typename T>
+Result<T>& Result<T>::operator=(Result const& other)
+{
+	if (this != &other)
+	{
+		destroyValue();
+
+		_code = other._code;
+
+		if (other.isSuccess())
+		{
+			new (&_value) StorageType(other._value);
+		}
+	}
+
+	return *this;
+}
+
+template <typename T>
+Result<T>& Result<T>::operator=(Result&& other) noexcept(std::is_nothrow_move_constructible_v<StorageType>)
+{
+	if (this != &other)
+	{
+		destroyValue();
+
+		_code = other._code;
+
+		if (other.isSuccess())
+		{
+			new (&_value) StorageType(std::move(other._value));
+		}
+	}
+
+	return *this;
+}
+
+////////////////// Result<void>
+
+inline Result<void>::Result(EResultCode code) noexcept:
+	_code{code}
+{
+}
+
+inline Result<void> Result<void>::makeSuccess() noexcept
+{
+	return Result(EResultCode::Success);
+}
+
+inline Result<void> Result<void>::makeFailure(EResultCode code) noexcept
+{
+	assert(code != EResultCode::Success);
+
+	return Result(code);
+}
+
+inline bool Result<void>::isSuccess() const noexcept
+{
+	return _code == EResultCode::Success;
+}
+
+inline EResultCode Result<void>::getCode() const noexcept
+{
+	return _code;
+}
+
+inline Result<void>::operator bool() const noexcept
+{
+	return isSuccess();
+}
+
+////////////////// internal
+
+template <typename T, typename Callable>
+Result<T> internal::makeSuccessfulResult(Callable&& call)
+{
+	if constexpr (std::is_void_v<T>)
+	{
+		std::forward<Callable>(call)();
+
+		return Result<void>::makeSuccess();
+	}
+	else
+	{
+		return Result<T>::makeSuccess(std::forward<Callable>(call)());
+	}
+}
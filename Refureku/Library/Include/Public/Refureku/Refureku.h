@@ -11,19 +11,26 @@
 
 #include "Refureku/TypeInfo/Type.h"
 #include "Refureku/TypeInfo/Database.h"
+#include "Refureku/TypeInfo/MetadataArena.h"
 #include "Refureku/TypeInfo/Entity/Entity.h"
 #include "Refureku/TypeInfo/Entity/EntityCast.h"
 #include "Refureku/TypeInfo/Variables/Variable.h"
 #include "Refureku/TypeInfo/Variables/Field.h"
+#include "Refureku/TypeInfo/Variables/FieldAccessor.h"
+#include "Refureku/TypeInfo/Variables/DirtyTracker.h"
 #include "Refureku/TypeInfo/Variables/StaticField.h"
 #include "Refureku/TypeInfo/Functions/Function.h"
 #include "Refureku/TypeInfo/Functions/Method.h"
+#include "Refureku/TypeInfo/Functions/BoundMethod.h"
+#include "Refureku/TypeInfo/Functions/PreparedCall.h"
+#include "Refureku/TypeInfo/Functions/InvocationCommandBuffer.h"
 #include "Refureku/TypeInfo/Functions/StaticMethod.h"
 #include "Refureku/TypeInfo/Namespace/Namespace.h"
 #include "Refureku/TypeInfo/Archetypes/Archetype.h"
 #include "Refureku/TypeInfo/Archetypes/FundamentalArchetype.h"
 #include "Refureku/TypeInfo/Archetypes/Enum.h"
 #include "Refureku/TypeInfo/Archetypes/EnumValue.h"
+#include "Refureku/TypeInfo/Archetypes/EnumTable.h"
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
 #include "Refureku/TypeInfo/Archetypes/ParentStruct.h"
 #include "Refureku/TypeInfo/Archetypes/GetArchetype.h"
@@ -36,8 +43,13 @@
 #include "Refureku/TypeInfo/Archetypes/Template/NonTypeTemplateArgument.h"
 #include "Refureku/TypeInfo/Archetypes/Template/TemplateTemplateArgument.h"
 
+#include "Refureku/Serialization/BinarySerialization.h"
+#include "Refureku/Serialization/InstanceComparison.h"
+
 #include "Refureku/NativeProperties.h"
 
+#include "Refureku/Misc/Result.h"
+
 #include "Refureku/Exceptions/ReturnTypeMismatch.h"
 #include "Refureku/Exceptions/ArgCountMismatch.h"
 #include "Refureku/Exceptions/ArgTypeMismatch.h"
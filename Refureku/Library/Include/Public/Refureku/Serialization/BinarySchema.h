@@ -0,0 +1,162 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+#include "Refureku/Config.h"
+#include "Refureku/Containers/Vector.h"
+#include "Refureku/Misc/FundamentalTypes.h"
+
+namespace rfk
+{
+	//Forward declarations
+	class Struct;
+	class Field;
+	class Archetype;
+	class BinarySchema;
+
+	/** Field of a struct serialized by a BinarySchema. */
+	struct BinarySchemaField
+	{
+		/** Serialized field. */
+		Field const*		field;
+
+		/** Archetype of a single element of the field (the field itself if it is not a C array). */
+		Archetype const*	elementArchetype;
+
+		/** Schema of a single element if the field is a reflected struct, nullptr if its elements are copied bytewise. */
+		BinarySchema const*	nestedSchema;
+
+		/** Size in memory of a single element of the field. */
+		std::size_t			elementSize;
+
+		/** Number of elements of the field: 1 for a value, the total number of elements for a (multidimensional) C array. */
+		uint32				elementsCount;
+
+		/** Number of bytes written in a record for this field. */
+		uint32				payloadSize;
+	};
+
+	/** Operation replayed on an instance to write it to or read it from a record data section, or to hash or compare it. */
+	struct BinarySchemaOp
+	{
+		/** Offset of the operation in the instance. */
+		std::size_t			offset;
+
+		/** Number of bytes to copy if nestedSchema is nullptr, size in memory of an element of nestedSchema otherwise. */
+		std::size_t			size;
+
+		/** Number of nested records, 0 if the operation is a plain copy. */
+		std::size_t			elementsCount;
+
+		/** Schema of the nested records, nullptr if the operation is a plain copy. */
+		BinarySchema const*	nestedSchema;
+
+		/** Index in BinarySchema::getFields of the first field covered by the operation. */
+		std::size_t			firstFieldIndex;
+
+		/** Number of fields covered by the operation. */
+		std::size_t			fieldsCount;
+	};
+
+	/**
+	*	@brief	Binary layout of a struct, computed once per struct and retrieved through Struct::getBinarySchema.
+	*
+	*			A record of a struct is made of:
+	*				- a header: uint64 schema id, uint32 fields count, uint32 data section size;
+	*				- a field table: uint64 field id, uint64 element archetype id, uint32 elements count, uint32 payload size per field;
+	*				- a data section: the payload of each field, in field table order.
+	*			Fundamental and enum fields (and C arrays of them) are written as raw bytes, and adjacent ones are written with a single copy.
+	*			Reflected struct fields are written as nested records. Const, pointer, reference and non-reflected fields are not serialized.
+	*			All values are written in the native byte order.
+	*
+	*			The schema id is computed from the struct id and the id, type and size of each serialized field,
+	*			so 2 records with the same schema id share the same layout and are read without looking at their field table.
+	*/
+	class BinarySchema final
+	{
+		public:
+			/** Size in bytes of a record header. */
+			static constexpr std::size_t	headerSize			= sizeof(uint64) + sizeof(uint32) * 2u;
+
+			/** Size in bytes of an entry of a record field table. */
+			static constexpr std::size_t	fieldEntrySize		= sizeof(uint64) * 2u + sizeof(uint32) * 2u;
+
+		private:
+			/** Struct described by this schema. */
+			Struct const*				_archetype;
+
+			/** Id of the schema. */
+			uint64						_id;
+
+			/** Size in bytes of a record of the struct. */
+			std::size_t					_recordSize;
+
+			/** Header and field table, identical for all records of the struct. */
+			Vector<unsigned char>		_header;
+
+			/** Serialized fields, ordered by memory offset. */
+			Vector<BinarySchemaField>	_fields;
+
+			/** Operations writing or reading the data section, in data section order. */
+			Vector<BinarySchemaOp>		_ops;
+
+		public:
+			REFUREKU_INTERNAL BinarySchema(Struct const& archetype)	noexcept;
+			BinarySchema(BinarySchema const&)						= delete;
+			BinarySchema(BinarySchema&&)							= delete;
+
+			/**
+			*	@brief Get the struct described by this schema.
+			*
+			*	@return The struct described by this schema.
+			*/
+			RFK_NODISCARD inline Struct const&						getArchetype()		const	noexcept;
+
+			/**
+			*	@brief Get the id of this schema.
+			*
+			*	@return The id of this schema.
+			*/
+			RFK_NODISCARD inline uint64								getId()				const	noexcept;
+
+			/**
+			*	@brief Get the size in bytes of a record written with this schema.
+			*
+			*	@return The size in bytes of a record written with this schema.
+			*/
+			RFK_NODISCARD inline std::size_t						getRecordSize()		const	noexcept;
+
+			/**
+			*	@brief Get the header and field table written at the beginning of each record.
+			*
+			*	@return The header and field table written at the beginning of each record.
+			*/
+			RFK_NODISCARD inline Vector<unsigned char> const&		getHeader()			const	noexcept;
+
+			/**
+			*	@brief Get the serialized fields, ordered by memory offset.
+			*
+			*	@return The serialized fields.
+			*/
+			RFK_NODISCARD inline Vector<BinarySchemaField> const&	getFields()			const	noexcept;
+
+			/**
+			*	@brief Get the operations writing or reading the data section of a record.
+			*
+			*	@return The operations writing or reading the data section of a record.
+			*/
+			RFK_NODISCARD inline Vector<BinarySchemaOp> const&		getOps()			const	noexcept;
+
+			BinarySchema& operator=(BinarySchema const&)	= delete;
+			BinarySchema& operator=(BinarySchema&&)			= delete;
+	};
+
+	#include "Refureku/Serialization/BinarySchema.inl"
+}
@@ -0,0 +1,36 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline Struct const& BinarySchema::getArchetype() const noexcept
+{
+	return *_archetype;
+}
+
+inline uint64 BinarySchema::getId() const noexcept
+{
+	return _id;
+}
+
+inline std::size_t BinarySchema::getRecordSize() const noexcept
+{
+	return _recordSize;
+}
+
+inline Vector<unsigned char> const& BinarySchema::getHeader() const noexcept
+{
+	return _header;
+}
+
+inline Vector<BinarySchemaField> const& BinarySchema::getFields() const noexcept
+{
+	return _fields;
+}
+
+inline Vector<BinarySchemaOp> const& BinarySchema::getOps() const noexcept
+{
+	return _ops;
+}
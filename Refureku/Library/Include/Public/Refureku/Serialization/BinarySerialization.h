@@ -0,0 +1,87 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+#include <cstring>	//std::memcpy
+
+#include "Refureku/Config.h"
+#include "Refureku/Serialization/BinarySchema.h"
+#include "Refureku/TypeInfo/Archetypes/Struct.h"
+
+namespace rfk
+{
+	namespace internal
+	{
+		/**
+		*	@brief Write a record of an instance to a sink.
+		*
+		*	@param schema	Schema of the instance struct.
+		*	@param instance	Pointer to the instance to serialize.
+		*	@param sink		Sink receiving the record bytes.
+		*/
+		template <typename Sink>
+		void writeBinaryRecord(BinarySchema const&	schema,
+							   unsigned char const*	instance,
+							   Sink&				sink);
+	}
+
+	/**
+	*	@brief	Serialize an instance to a streaming sink. See rfk::BinarySchema for the format of the written record.
+	*			The sink is called as sink(void const* data, std::size_t size) a few times per record (once for the header and field table,
+	*			then once per contiguous region of bytewise copyable fields) and receives exactly archetype.getBinarySchema().getRecordSize() bytes.
+	*			No memory is allocated during the serialization.
+	*
+	*	@param archetype	Struct of the instance.
+	*	@param instance		Pointer to an object of the provided struct. The pointer is not adjusted.
+	*	@param sink			Sink receiving the record bytes.
+	*
+	*	@exception Any exception potentially thrown from the sink.
+	*/
+	template <typename Sink>
+	void				serializeBinary(Struct const&	archetype,
+										void const*		instance,
+										Sink&&			sink);
+
+	/**
+	*	@brief	Serialize an instance to a buffer. See rfk::BinarySchema for the format of the written record.
+	*			No memory is allocated during the serialization.
+	*
+	*	@param archetype	Struct of the instance.
+	*	@param instance		Pointer to an object of the provided struct. The pointer is not adjusted.
+	*	@param out_buffer	Buffer receiving the record.
+	*	@param bufferSize	Size in bytes of the buffer.
+	*
+	*	@return The number of bytes written to the buffer, 0 if the buffer is too small to hold the record (in which case nothing is written).
+	*/
+	inline std::size_t	serializeBinary(Struct const&	archetype,
+										void const*		instance,
+										void*			out_buffer,
+										std::size_t		bufferSize);
+
+	/**
+	*	@brief	Deserialize a record into an instance.
+	*			If the record schema id matches the archetype schema id, the data section is copied without reading the field table.
+	*			Otherwise, fields are matched by field id: fields of the record which are missing from the struct or whose type changed are skipped,
+	*			fields of the struct which are missing from the record are left untouched, and C arrays whose size changed are partially read.
+	*
+	*	@param archetype	Struct of the instance.
+	*	@param instance		Pointer to an object of the provided struct. The pointer is not adjusted.
+	*	@param buffer		Buffer containing the record.
+	*	@param bufferSize	Size in bytes of the buffer.
+	*
+	*	@return The number of bytes read from the buffer, 0 if the buffer doesn't start with a valid record.
+	*			If the record is invalid, the instance may have been partially written.
+	*/
+	REFUREKU_API std::size_t	deserializeBinary(Struct const&	archetype,
+												  void*			instance,
+												  void const*	buffer,
+												  std::size_t	bufferSize);
+
+	#include "Refureku/Serialization/BinarySerialization.inl"
+}
@@ -0,0 +1,55 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename Sink>
+void internal::writeBinaryRecord(BinarySchema const& schema, unsigned char const* instance, Sink& sink)
+{
+	sink(static_cast<void const*>(schema.getHeader().data()), schema.getHeader().size());
+
+	for (BinarySchemaOp const& op : schema.getOps())
+	{
+		if (op.nestedSchema == nullptr)
+		{
+			sink(static_cast<void const*>(instance + op.offset), op.size);
+		}
+		else
+		{
+			for (std::size_t i = 0u; i < op.elementsCount; i++)
+			{
+				writeBinaryRecord(*op.nestedSchema, instance + op.offset + i * op.size, sink);
+			}
+		}
+	}
+}
+
+template <typename Sink>
+void serializeBinary(Struct const& archetype, void const* instance, Sink&& sink)
+{
+	internal::writeBinaryRecord(archetype.getBinarySchema(), reinterpret_cast<unsigned char const*>(instance), sink);
+}
+
+inline std::size_t serializeBinary(Struct const& archetype, void const* instance, void* out_buffer, std::size_t bufferSize)
+{
+	BinarySchema const& schema = archetype.getBinarySchema();
+
+	if (bufferSize < schema.getRecordSize())
+	{
+		return 0u;
+	}
+
+	unsigned char* cursor = reinterpret_cast<unsigned char*>(out_buffer);
+
+	auto writeToBuffer = [&cursor](void const* data, std::size_t size) noexcept
+	{
+		std::memcpy(cursor, data, size);
+		cursor += size;
+	};
+
+	internal::writeBinaryRecord(schema, reinterpret_cast<unsigned char const*>(instance), writeToBuffer);
+
+	return schema.getRecordSize();
+}
@@ -0,0 +1,64 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+#include "Refureku/Config.h"
+#include "Refureku/Containers/Vector.h"
+
+namespace rfk
+{
+	//Forward declarations
+	class Struct;
+	class Field;
+
+	/**
+	*	@brief	Hash the fields of an instance covered by the struct binary schema (see rfk::BinarySchema).
+	*			Runs of adjacent fundamental and enum fields are hashed bytewise, and reflected struct fields are hashed recursively.
+	*			2 instances considered equal by rfk::equalInstances have the same hash.
+	*
+	*	@param archetype	Struct of the instance.
+	*	@param instance		Pointer to an object of the provided struct. The pointer is not adjusted.
+	*
+	*	@return The hash of the instance.
+	*/
+	REFUREKU_API std::size_t	hashInstance(Struct const&	archetype,
+											 void const*	instance);
+
+	/**
+	*	@brief	Check whether the fields covered by the struct binary schema (see rfk::BinarySchema) are equal in 2 instances.
+	*			Fields are compared bitwise, so for example 0.0f and -0.0f are different and a NaN equals itself.
+	*
+	*	@param archetype	Struct of the instances.
+	*	@param lhs			Pointer to an object of the provided struct. The pointer is not adjusted.
+	*	@param rhs			Pointer to an object of the provided struct. The pointer is not adjusted.
+	*
+	*	@return true if all compared fields are equal, else false.
+	*/
+	REFUREKU_API bool			equalInstances(Struct const&	archetype,
+											   void const*		lhs,
+											   void const*		rhs);
+
+	/**
+	*	@brief	Collect the fields which differ between 2 instances, with the same comparison as rfk::equalInstances.
+	*			Only fields of the provided struct are reported: a reflected struct field is reported as a whole if any of its nested fields changed.
+	*			Fields are reported by increasing memory offset.
+	*
+	*	@param archetype			Struct of the instances.
+	*	@param lhs					Pointer to an object of the provided struct. The pointer is not adjusted.
+	*	@param rhs					Pointer to an object of the provided struct. The pointer is not adjusted.
+	*	@param out_changedFields	Vector the changed fields are appended to. Reusing the same vector avoids allocations.
+	*
+	*	@return The number of changed fields appended to out_changedFields.
+	*/
+	REFUREKU_API std::size_t	diffInstances(Struct const&			archetype,
+											  void const*			lhs,
+											  void const*			rhs,
+											  Vector<Field const*>&	out_changedFields);
+}
@@ -9,6 +9,7 @@
 
 #include "Refureku/TypeInfo/Entity/Entity.h"
 #include "Refureku/TypeInfo/EAccessSpecifier.h"
+#include "Refureku/TypeInfo/Archetypes/EArchetypeTraits.h"
 
 namespace rfk
 {
@@ -34,6 +35,32 @@ namespace rfk
 			RFK_NODISCARD REFUREKU_API
 				std::size_t					getMemorySize()						const	noexcept;
 
+			/**
+			*	@brief Get the memory alignment of an instance of the archetype, as the operator alignof(type) would do.
+			* 
+			*	@return The memory alignment of an instance of the archetype, or 0 if it was not provided at registration.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				std::size_t					getMemoryAlignment()				const	noexcept;
+
+			/**
+			*	@brief Get the layout and lifetime traits (trivially copyable, trivially destructible...) of the archetype.
+			* 
+			*	@return The traits of the archetype.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				EArchetypeTraits			getTraits()							const	noexcept;
+
+			/**
+			*	@brief Check whether the archetype has all the provided traits.
+			* 
+			*	@param traits The traits to look for.
+			* 
+			*	@return true if all the provided traits are set on this archetype, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				bool						hasTraits(EArchetypeTraits traits)	const	noexcept;
+
 			/**
 			*	@brief Set the access specifier of the archetype in its outer struct/class.
 			* 
@@ -42,6 +69,22 @@ namespace rfk
 			REFUREKU_API
 				void						setAccessSpecifier(EAccessSpecifier access)	noexcept;
 
+			/**
+			*	@brief Set the memory alignment of an instance of the archetype.
+			* 
+			*	@param alignment The new memory alignment of this archetype.
+			*/
+			REFUREKU_API
+				void						setMemoryAlignment(std::size_t alignment)	noexcept;
+
+			/**
+			*	@brief Set the layout and lifetime traits of the archetype.
+			* 
+			*	@param traits The new traits of this archetype.
+			*/
+			REFUREKU_API
+				void						setTraits(EArchetypeTraits traits)			noexcept;
+
 		protected:
 			//Forward declaration
 			class ArchetypeImpl;
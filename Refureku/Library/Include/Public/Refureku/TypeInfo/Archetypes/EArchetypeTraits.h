@@ -0,0 +1,44 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Refureku/Misc/FundamentalTypes.h"
+#include "Refureku/Misc/EnumMacros.h"
+
+namespace rfk
+{
+	/**
+	*	@brief	Layout and lifetime traits of the type described by an archetype.
+	*			They allow runtime consumers to pick memcpy / skip-destructor / bulk-zero fast paths.
+	*/
+	enum class EArchetypeTraits : uint8
+	{
+		/** No trait. */
+		Default					= 0,
+
+		/** std::is_trivially_copyable_v<T> */
+		TriviallyCopyable		= 1 << 0,
+
+		/** std::is_trivially_destructible_v<T> */
+		TriviallyDestructible	= 1 << 1,
+
+		/** std::is_default_constructible_v<T> */
+		DefaultConstructible	= 1 << 2,
+
+		/** std::is_trivially_default_constructible_v<T> */
+		TriviallyConstructible	= 1 << 3,
+
+		/** std::is_standard_layout_v<T> */
+		StandardLayout			= 1 << 4,
+
+		/** std::is_polymorphic_v<T> */
+		Polymorphic				= 1 << 5
+	};
+
+	RFK_GENERATE_ENUM_OPERATORS(EArchetypeTraits)
+}
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <string_view>
+
 #include "Refureku/TypeInfo/Archetypes/Archetype.h"
 
 namespace rfk
@@ -123,6 +125,67 @@ namespace rfk
 				bool						foreachEnumValue(Visitor<EnumValue>	visitor,
 															 void*				userData)				const;
 
+			/**
+			*	@brief	Check whether this enum is a flag enum.
+			*			Unless set with setFlagEnum, an enum is detected as a flag enum when it has enum values holding a single bit
+			*			and all its other non-zero values are combinations of those bits.
+			* 
+			*	@return true if this enum is a flag enum, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				bool						isFlagEnum()												const	noexcept;
+
+			/**
+			*	@brief Get the enum value holding a single bit.
+			* 
+			*	@param bit Index of the bit, in [0, 64[.
+			* 
+			*	@return The first enum value holding exactly 1 << bit if any, else nullptr.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				EnumValue const*			getFlagEnumValue(std::size_t bit)							const	noexcept;
+
+			/**
+			*	@brief	Execute the given visitor on the enum value holding each bit set in the provided value, from the lowest to the highest bit.
+			*			If the value is 0, the visitor is executed on the enum value holding 0 if any.
+			*			This method doesn't allocate and doesn't require the enum to be a flag enum.
+			* 
+			*	@param value	Combination of flags to decompose.
+			*	@param visitor	Visitor function to call. Return false to abort the decomposition.
+			*	@param userData	Optional user data forwarded to the visitor.
+			* 
+			*	@return	true if an enum value was visited for each bit of the value and the visitor never aborted, else false.
+			*			If the visitor is nullptr, return false.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			REFUREKU_API
+				bool						decomposeFlags(int64				value,
+														   Visitor<EnumValue>	visitor,
+														   void*				userData)					const;
+
+			/**
+			*	@brief	Combine the values of enum value names separated by '|'. Spaces around names are ignored.
+			*			An empty string or a string made of spaces is parsed to 0.
+			*			This method doesn't allocate and doesn't require the enum to be a flag enum.
+			* 
+			*	@param flags		String to parse, for example "Value1 | Value3".
+			*	@param out_value	Combination of the parsed values. Left untouched if the parsing fails.
+			* 
+			*	@return true if all names were found in this enum, else false.
+			*/
+			REFUREKU_API
+				bool						parseFlags(std::string_view	flags,
+													   int64&			out_value)								const	noexcept;
+
+			/**
+			*	@brief Set whether this enum is a flag enum, overriding its detection.
+			* 
+			*	@param isFlagEnum Is this enum a flag enum?
+			*/
+			REFUREKU_API
+				void						setFlagEnum(bool isFlagEnum)										noexcept;
+
 			/**
 			*	@brief Add an enum value to this enum.
 			*	
@@ -0,0 +1,86 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>		//std::size_t
+#include <string_view>
+#include <optional>
+
+#include "Refureku/Misc/FundamentalTypes.h"
+
+namespace rfk
+{
+	/**
+	*	@brief	Compile-time tables of the values and names of a reflected enum.
+	*			The generator specializes this template in the generated header of each reflected enum, so the tables
+	*			can be used in constant expressions and before the database is populated.
+	*			A specialization provides:
+	*				- valuesCount, values, valueNames:	the distinct values of the enum sorted by increasing value,
+	*													and the name of the first enum value declared with each value;
+	*				- namesCount, names, nameValues:	the name and value of each enum value, in declaration order;
+	*				- nameBucketsMask, nameBucketSeeds,
+	*				  nameSlotsMask, nameSlots:			a perfect hash of the names (see internal::getEnumNameIndex),
+	*													nameSlots holding an index in names or namesCount for an unused slot.
+	*			Arrays of an enum without value hold a single unused element.
+	*/
+	template <typename EnumType>
+	struct EnumTable;
+
+	/**
+	*	@brief Get the name of an enum value, without querying the database.
+	*
+	*	@tparam EnumType Reflected enum type.
+	*
+	*	@param value Value to convert.
+	*
+	*	@return The name of the first enum value declared with the provided value if any, else an empty string view.
+	*/
+	template <typename EnumType>
+	constexpr std::string_view			enumToString(EnumType value)			noexcept;
+
+	/**
+	*	@brief Get the value of an enum value from its name, without querying the database.
+	*
+	*	@tparam EnumType Reflected enum type.
+	*
+	*	@param name Name of the enum value to convert (case sensitive).
+	*
+	*	@return The value of the enum value having the provided name if any, else std::nullopt.
+	*/
+	template <typename EnumType>
+	constexpr std::optional<EnumType>	stringToEnum(std::string_view name)		noexcept;
+
+	namespace internal
+	{
+		/**
+		*	@brief	Seeded FNV-1a hash of an enum value name used by the EnumTable perfect hashes.
+		*			The generator computes the EnumTable seeds with the same function.
+		*
+		*	@param name	Name to hash.
+		*	@param seed	Seed of the hash.
+		*
+		*	@return The hash of the name.
+		*/
+		constexpr uint64					hashEnumName(std::string_view	name,
+														 uint64				seed)	noexcept;
+
+		/**
+		*	@brief Look up the index of a name in EnumTable<EnumType>::names.
+		*
+		*	@tparam EnumType Reflected enum type.
+		*
+		*	@param name Name of the enum value to look for.
+		*
+		*	@return The index of the name in EnumTable<EnumType>::names if found, else EnumTable<EnumType>::namesCount.
+		*/
+		template <typename EnumType>
+		constexpr std::size_t				getEnumNameIndex(std::string_view name)	noexcept;
+	}
+
+	#include "Refureku/TypeInfo/Archetypes/EnumTable.inl"
+}
@@ -0,0 +1,73 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+constexpr uint64 internal::hashEnumName(std::string_view name, uint64 seed) noexcept
+{
+	uint64 hash = 14695981039346656037ull;
+
+	for (std::size_t i = 0u; i < sizeof(uint64); i++)
+	{
+		hash ^= (seed >> (i * 8u)) & 0xFFu;
+		hash *= 1099511628211ull;
+	}
+
+	for (char c : name)
+	{
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 1099511628211ull;
+	}
+
+	return hash;
+}
+
+template <typename EnumType>
+constexpr std::size_t internal::getEnumNameIndex(std::string_view name) noexcept
+{
+	using Table = EnumTable<EnumType>;
+
+	uint64		bucketSeed	= Table::nameBucketSeeds[hashEnumName(name, 0u) & Table::nameBucketsMask];
+	std::size_t	index		= Table::nameSlots[hashEnumName(name, bucketSeed) & Table::nameSlotsMask];
+
+	return (index < Table::namesCount && Table::names[index] == name) ? index : Table::namesCount;
+}
+
+template <typename EnumType>
+constexpr std::string_view enumToString(EnumType value) noexcept
+{
+	using Table = EnumTable<EnumType>;
+
+	int64		searchedValue	= static_cast<int64>(value);
+	std::size_t	first			= 0u;
+	std::size_t	last			= Table::valuesCount;
+
+	//Binary search in the sorted values
+	while (first < last)
+	{
+		std::size_t middle = first + (last - first) / 2u;
+
+		if (Table::values[middle] < searchedValue)
+		{
+			first = middle + 1u;
+		}
+		else
+		{
+			last = middle;
+		}
+	}
+
+	return (first < Table::valuesCount && Table::values[first] == searchedValue) ? Table::valueNames[first] : std::string_view();
+}
+
+template <typename EnumType>
+constexpr std::optional<EnumType> stringToEnum(std::string_view name) noexcept
+{
+	using Table = EnumTable<EnumType>;
+
+	std::size_t index = internal::getEnumNameIndex<EnumType>(name);
+
+	return (index < Table::namesCount) ? std::optional<EnumType>(static_cast<EnumType>(Table::nameValues[index])) : std::nullopt;
+}
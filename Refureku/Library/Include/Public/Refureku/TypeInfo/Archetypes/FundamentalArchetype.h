@@ -14,9 +14,11 @@ namespace rfk
 	class FundamentalArchetype final : public Archetype
 	{
 		public:
-			REFUREKU_INTERNAL FundamentalArchetype(char const*	name,
-												   std::size_t	id,
-												   std::size_t	memorySize)	noexcept;
+			REFUREKU_INTERNAL FundamentalArchetype(char const*		name,
+												   std::size_t		id,
+												   std::size_t		memorySize,
+												   std::size_t		memoryAlignment,
+												   EArchetypeTraits	traits)		noexcept;
 			REFUREKU_INTERNAL ~FundamentalArchetype()						noexcept;
 
 		private:
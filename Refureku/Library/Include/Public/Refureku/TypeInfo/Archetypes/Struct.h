@@ -9,6 +9,7 @@
 
 #include <cstddef> //std::ptrdiff_t
 #include <type_traits> //std::is_default_constructible_v, std::is_pointer_v, std::is_reference_v
+#include <atomic>
 
 #include "Refureku/TypeInfo/Cast.h"
 #include "Refureku/TypeInfo/Archetypes/Archetype.h"
@@ -20,6 +21,7 @@
 #include "Refureku/Containers/Vector.h"
 #include "Refureku/Misc/SharedPtr.h"
 #include "Refureku/Misc/UniquePtr.h"
+#include "Refureku/Misc/Result.h"
 
 namespace rfk
 {
@@ -32,6 +34,8 @@ namespace rfk
 	class Type;
 	class ICallable;
 	class Struct;
+	class BinarySchema;
+	class DirtyTracker;
 	
 	/* In C++, a struct and a class contain exactly the same data. Alias for convenience. */
 	using Class = Struct;
@@ -73,6 +77,28 @@ namespace rfk
 			RFK_NODISCARD 
 				rfk::UniquePtr<ReturnType>			makeUniqueInstance(ArgTypes&&... args)												const;
 
+			/**
+			*	@brief	Non-throwing version of Struct::makeSharedInstance.
+			*
+			*	@return The instance, EResultCode::NoMatchingInstantiator if no suitable instantiator was found,
+			*			or EResultCode::InstantiatorReturnedNull if the used instantiator returned nullptr.
+			* 
+			*	@exception Any exception potentially thrown by the used instantiator.
+			*/
+			template <typename ReturnType, typename... ArgTypes>
+			Result<rfk::SharedPtr<ReturnType>>		tryMakeSharedInstance(ArgTypes&&... args)											const;
+
+			/**
+			*	@brief	Non-throwing version of Struct::makeUniqueInstance.
+			*
+			*	@return The instance, EResultCode::NoMatchingInstantiator if no suitable instantiator was found,
+			*			or EResultCode::InstantiatorReturnedNull if the used instantiator returned nullptr.
+			* 
+			*	@exception Any exception potentially thrown by the used instantiator.
+			*/
+			template <typename ReturnType, typename... ArgTypes>
+			Result<rfk::UniquePtr<ReturnType>>		tryMakeUniqueInstance(ArgTypes&&... args)											const;
+
 			/**
 			*	@brief	Compute the list of all direct reflected subclasses of this struct.
 			*			Direct subclasses are computed by iterating over all subclasses (direct or not), so this method
@@ -644,6 +670,52 @@ namespace rfk
 			*/
 			RFK_NODISCARD REFUREKU_API EClassKind	getClassKind()																		const	noexcept;
 
+			/**
+			*	@brief	Get the binary layout used to serialize instances of this struct.
+			*			The schema is computed on the first call and cached, so fields added to this struct afterwards are not taken into account.
+			* 
+			*	@return The binary schema of this struct.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				BinarySchema const&					getBinarySchema()																	const;
+
+			/**
+			*	@brief Get the dirty tracker attached to this struct.
+			* 
+			*	@return The dirty tracker attached to this struct, nullptr if dirty tracking is not enabled for this struct.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				DirtyTracker*						getDirtyTracker()																	const	noexcept;
+
+			/**
+			*	@brief	Get the slot holding the dirty tracker attached to this struct.
+			*			Fields cache it to check for a tracker inline on each write.
+			* 
+			*	@return The slot holding the dirty tracker attached to this struct.
+			*/
+			RFK_NODISCARD REFUREKU_INTERNAL
+				std::atomic<DirtyTracker*> const&	getDirtyTrackerSlot()																const	noexcept;
+
+			/**
+			*	@brief	Get the bit of this struct in the property signature of entities (see Entity::getProperty).
+			*			The first 64 indexed property structs get distinct bits. Beyond that, several structs share
+			*			a bit, so the signature only prefilters the property lookups.
+			* 
+			*	@return	The property signature bit of this struct,
+			*			0 if neither this struct nor any of its children was ever attached to an entity as a property.
+			*/
+			RFK_NODISCARD REFUREKU_INTERNAL
+				uint64								getPropertySignatureBit()															const	noexcept;
+
+			/**
+			*	@brief	Give a dense property index to this struct and to all its parents if they don't have one yet.
+			*			Called when a property of this struct is attached to an entity.
+			* 
+			*	@return The union of the property signature bits of this struct and all its parents.
+			*/
+			REFUREKU_INTERNAL
+				uint64								indexPropertyHierarchy()															const	noexcept;
+
 			/**
 			*	@brief	Get the pointer offset to transform an instance of this Struct pointer to a pointer of the provided Struct.
 			*			Search in both directions (whether to is a parent class or a child class).
@@ -780,7 +852,8 @@ namespace rfk
 			*	@param name				Name of the method.
 			*	@param id				Unique entity id of the method.
 			*	@param returnType		Return type of the method call.
-			*	@param internalMethod	Dynamically allocated MemberFunction storing the underlying method.
+			*	@param internalMethod	MemberFunction storing the underlying method. The pointer overload takes ownership of the
+			*							dynamically allocated callable, the reference overload expects it to outlive the struct (static storage).
 			*	@param flags			Method flags.
 			*
 			*	@return A pointer to the added method. The pointer is made from the iterator, so is unvalidated as soon as the iterator is unvalidated.
@@ -791,6 +864,11 @@ namespace rfk
 															  Type const&	returnType,
 															  ICallable*	internalMethod,
 															  EMethodFlags	flags)																noexcept;
+			REFUREKU_API Method*					addMethod(char const*	name,
+															  std::size_t	id,
+															  Type const&	returnType,
+															  ICallable&	internalMethod,
+															  EMethodFlags	flags)																noexcept;
 
 			/**
 			*	@brief	Internally pre-allocate enough memory for the provided number of methods.
@@ -806,7 +884,8 @@ namespace rfk
 			*	@param methodName		Name of the static method.
 			*	@param id				Unique entity id of the static method.
 			*	@param returnType		Return type of the static method call.
-			*	@param internalMethod	Dynamically allocated NonMemberFunction storing the underlying static method.
+			*	@param internalMethod	NonMemberFunction storing the underlying static method. The pointer overload takes ownership of the
+			*							dynamically allocated callable, the reference overload expects it to outlive the struct (static storage).
 			*	@param flags			Method flags.
 			*
 			*	@return A pointer to the added static method. The pointer is made from the iterator, so is unvalidated as soon as the iterator is unvalidated.
@@ -817,6 +896,11 @@ namespace rfk
 																	Type const&		returnType,
 																	ICallable*		internalMethod,
 																	EMethodFlags	flags)														noexcept;
+			REFUREKU_API StaticMethod*				addStaticMethod(char const*		name,
+																	std::size_t		id,
+																	Type const&		returnType,
+																	ICallable&		internalMethod,
+																	EMethodFlags	flags)														noexcept;
 
 			/**
 			*	@brief	Internally pre-allocate enough memory for the provided number of static methods.
@@ -858,6 +942,50 @@ namespace rfk
 			RFK_GEN_GET_PIMPL(StructImpl, Entity::getPimpl())
 
 		private:
+			/**
+			*	@brief Find the shared instantiator taking the provided argument types.
+			* 
+			*	@return The matching shared instantiator if any, else nullptr.
+			*/
+			template <typename... ArgTypes>
+			RFK_NODISCARD StaticMethod const*		findSharedInstantiator()															const;
+
+			/**
+			*	@brief Find the unique instantiator taking the provided argument types.
+			* 
+			*	@return The matching unique instantiator if any, else nullptr.
+			*/
+			template <typename... ArgTypes>
+			RFK_NODISCARD StaticMethod const*		findUniqueInstantiator()															const;
+
+			/**
+			*	@brief Make an instance of this struct with the provided shared instantiator, adjusting the pointer to ReturnType.
+			* 
+			*	@param instantiator	Instantiator to use. Must return a rfk::SharedPtr of this struct.
+			*	@param args			Arguments forwarded to the instantiator.
+			* 
+			*	@return The instance returned by the instantiator.
+			* 
+			*	@exception Any exception potentially thrown by the used instantiator.
+			*/
+			template <typename ReturnType, typename... ArgTypes>
+			rfk::SharedPtr<ReturnType>				makeSharedInstanceWith(StaticMethod const&	instantiator,
+																		   ArgTypes&&...		args)							const;
+
+			/**
+			*	@brief Make an instance of this struct with the provided unique instantiator, adjusting the pointer to ReturnType.
+			* 
+			*	@param instantiator	Instantiator to use. Must return a rfk::UniquePtr of this struct.
+			*	@param args			Arguments forwarded to the instantiator.
+			* 
+			*	@return The instance returned by the instantiator.
+			* 
+			*	@exception Any exception potentially thrown by the used instantiator.
+			*/
+			template <typename ReturnType, typename... ArgTypes>
+			rfk::UniquePtr<ReturnType>				makeUniqueInstanceWith(StaticMethod const&	instantiator,
+																		   ArgTypes&&...		args)							const;
+
 			/**
 			*	@brief Execute the given visitor on all shared instantiators taking a given number of parameters in this struct.
 			* 
@@ -889,6 +1017,8 @@ namespace rfk
 			REFUREKU_API bool	foreachUniqueInstantiator(std::size_t			argCount,
 														  Visitor<StaticMethod>	visitor,
 														  void*					userData)	const;
+
+		friend DirtyTracker;
 	};
 
 	REFUREKU_TEMPLATE_API(rfk::Allocator<Struct const*>);
@@ -9,41 +9,10 @@ template <typename ReturnType, typename... ArgTypes>
 rfk::SharedPtr<ReturnType> Struct::makeSharedInstance(ArgTypes&&... args) const
 {
 	static_assert(!std::is_pointer_v<ReturnType> && !std::is_reference_v<ReturnType>, "The return type of makeSharedInstance should not be a pointer or a reference.");
-	
-	StaticMethod const* instantiator;
 
-	if (!foreachSharedInstantiator(sizeof...(args), [](StaticMethod const& instantiator, void* data)
-		{
-			//Find a shared instantiator with the same parameters
-			if (instantiator.hasSameParameters<ArgTypes...>())
-			{
-				*reinterpret_cast<StaticMethod const**>(data) = &instantiator;
-				return false;
-			}
-
-			return true;
-		}, &instantiator))
+	if (StaticMethod const* instantiator = findSharedInstantiator<ArgTypes...>())
 	{
-		assert(instantiator != nullptr);
-
-		SharedPtr<ReturnType> result = instantiator->invoke<SharedPtr<ReturnType>>(std::forward<ArgTypes>(args)...);
-
-		Struct const* returnTypeArchetype = static_cast<Struct const*>(getArchetype<ReturnType>());
-
-		if (returnTypeArchetype != nullptr)
-		{
-			//Check if pointer needs to be adjusted here
-			ReturnType* ptr = result.get();
-			ReturnType* adjustedPtr = rfk::dynamicUpCast<ReturnType>(ptr, *this, *returnTypeArchetype);
-
-			if (ptr != adjustedPtr)
-			{
-				//Alias construct another shared pointer with the adjusted memory
-				return SharedPtr<ReturnType>(result, adjustedPtr);
-			}
-		}
-
-		return result;
+		return makeSharedInstanceWith<ReturnType>(*instantiator, std::forward<ArgTypes>(args)...);
 	}
 	else
 	{
@@ -61,11 +30,65 @@ rfk::UniquePtr<ReturnType> Struct::makeUniqueInstance(ArgTypes&&... args) const
 {
 	static_assert(!std::is_pointer_v<ReturnType> && !std::is_reference_v<ReturnType>, "The return type of makeUniqueInstance should not be a pointer or a reference.");
 
-	StaticMethod const* instantiator;
+	StaticMethod const* instantiator = findUniqueInstantiator<ArgTypes...>();
+
+	return (instantiator != nullptr) ?
+			makeUniqueInstanceWith<ReturnType>(*instantiator, std::forward<ArgTypes>(args)...) :
+			nullptr;
+}
+
+template <typename ReturnType, typename... ArgTypes>
+Result<rfk::SharedPtr<ReturnType>> Struct::tryMakeSharedInstance(ArgTypes&&... args) const
+{
+	static_assert(!std::is_pointer_v<ReturnType> && !std::is_reference_v<ReturnType>, "The return type of tryMakeSharedInstance should not be a pointer or a reference.");
+
+	rfk::SharedPtr<ReturnType> instance;
+
+	if (StaticMethod const* instantiator = findSharedInstantiator<ArgTypes...>())
+	{
+		instance = makeSharedInstanceWith<ReturnType>(*instantiator, std::forward<ArgTypes>(args)...);
+	}
+	else if (StaticMethod const* uniqueInstantiator = findUniqueInstantiator<ArgTypes...>())
+	{
+		instance = makeUniqueInstanceWith<ReturnType>(*uniqueInstantiator, std::forward<ArgTypes>(args)...);
+	}
+	else
+	{
+		return Result<rfk::SharedPtr<ReturnType>>::makeFailure(EResultCode::NoMatchingInstantiator);
+	}
+
+	return (instance != nullptr) ?
+			Result<rfk::SharedPtr<ReturnType>>::makeSuccess(std::move(instance)) :
+			Result<rfk::SharedPtr<ReturnType>>::makeFailure(EResultCode::InstantiatorReturnedNull);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+Result<rfk::UniquePtr<ReturnType>> Struct::tryMakeUniqueInstance(ArgTypes&&... args) const
+{
+	static_assert(!std::is_pointer_v<ReturnType> && !std::is_reference_v<ReturnType>, "The return type of tryMakeUniqueInstance should not be a pointer or a reference.");
+
+	StaticMethod const* instantiator = findUniqueInstantiator<ArgTypes...>();
+
+	if (instantiator == nullptr)
+	{
+		return Result<rfk::UniquePtr<ReturnType>>::makeFailure(EResultCode::NoMatchingInstantiator);
+	}
 
-	if (!foreachUniqueInstantiator(sizeof...(args), [](StaticMethod const& instantiator, void* data)
+	rfk::UniquePtr<ReturnType> instance = makeUniqueInstanceWith<ReturnType>(*instantiator, std::forward<ArgTypes>(args)...);
+
+	return (instance != nullptr) ?
+			Result<rfk::UniquePtr<ReturnType>>::makeSuccess(std::move(instance)) :
+			Result<rfk::UniquePtr<ReturnType>>::makeFailure(EResultCode::InstantiatorReturnedNull);
+}
+
+template <typename... ArgTypes>
+StaticMethod const* Struct::findSharedInstantiator() const
+{
+	StaticMethod const* instantiator = nullptr;
+
+	foreachSharedInstantiator(sizeof...(ArgTypes), [](StaticMethod const& instantiator, void* data)
 		{
-			//Find an instantiator with the same parameters
+			//Find a shared instantiator with the same parameters
 			if (instantiator.hasSameParameters<ArgTypes...>())
 			{
 				*reinterpret_cast<StaticMethod const**>(data) = &instantiator;
@@ -73,34 +96,76 @@ rfk::UniquePtr<ReturnType> Struct::makeUniqueInstance(ArgTypes&&... args) const
 			}
 
 			return true;
-		}, &instantiator))
-	{
-		assert(instantiator != nullptr);
+		}, &instantiator);
 
-		UniquePtr<ReturnType> result = instantiator->invoke<UniquePtr<ReturnType>>(std::forward<ArgTypes>(args)...);
+	return instantiator;
+}
 
-		Struct const* returnTypeArchetype = static_cast<Struct const*>(getArchetype<ReturnType>());
+template <typename... ArgTypes>
+StaticMethod const* Struct::findUniqueInstantiator() const
+{
+	StaticMethod const* instantiator = nullptr;
 
-		if (returnTypeArchetype != nullptr)
+	foreachUniqueInstantiator(sizeof...(ArgTypes), [](StaticMethod const& instantiator, void* data)
 		{
-			//Check if pointer needs to be adjusted here
-			ReturnType* ptr = result.get();
-			ReturnType* adjustedPtr = rfk::dynamicUpCast<ReturnType>(ptr, *this, *returnTypeArchetype);
-
-			if (ptr != adjustedPtr)
+			//Find an instantiator with the same parameters
+			if (instantiator.hasSameParameters<ArgTypes...>())
 			{
-				//Release previous pointer and feed the new adjusted one
-				result.release();
-				result.reset(adjustedPtr);
+				*reinterpret_cast<StaticMethod const**>(data) = &instantiator;
+				return false;
 			}
-		}
 
-		return result;
+			return true;
+		}, &instantiator);
+
+	return instantiator;
+}
+
+template <typename ReturnType, typename... ArgTypes>
+rfk::SharedPtr<ReturnType> Struct::makeSharedInstanceWith(StaticMethod const& instantiator, ArgTypes&&... args) const
+{
+	SharedPtr<ReturnType> result = instantiator.invoke<SharedPtr<ReturnType>>(std::forward<ArgTypes>(args)...);
+
+	Struct const* returnTypeArchetype = static_cast<Struct const*>(getArchetype<ReturnType>());
+
+	if (returnTypeArchetype != nullptr)
+	{
+		//Check if pointer needs to be adjusted here
+		ReturnType* ptr = result.get();
+		ReturnType* adjustedPtr = rfk::dynamicUpCast<ReturnType>(ptr, *this, *returnTypeArchetype);
+
+		if (ptr != adjustedPtr)
+		{
+			//Alias construct another shared pointer with the adjusted memory
+			return SharedPtr<ReturnType>(result, adjustedPtr);
+		}
 	}
-	else
+
+	return result;
+}
+
+template <typename ReturnType, typename... ArgTypes>
+rfk::UniquePtr<ReturnType> Struct::makeUniqueInstanceWith(StaticMethod const& instantiator, ArgTypes&&... args) const
+{
+	UniquePtr<ReturnType> result = instantiator.invoke<UniquePtr<ReturnType>>(std::forward<ArgTypes>(args)...);
+
+	Struct const* returnTypeArchetype = static_cast<Struct const*>(getArchetype<ReturnType>());
+
+	if (returnTypeArchetype != nullptr)
 	{
-		return nullptr;
+		//Check if pointer needs to be adjusted here
+		ReturnType* ptr = result.get();
+		ReturnType* adjustedPtr = rfk::dynamicUpCast<ReturnType>(ptr, *this, *returnTypeArchetype);
+
+		if (ptr != adjustedPtr)
+		{
+			//Release previous pointer and feed the new adjusted one
+			result.release();
+			result.reset(adjustedPtr);
+		}
 	}
+
+	return result;
 }
 
 template <typename MethodSignature>
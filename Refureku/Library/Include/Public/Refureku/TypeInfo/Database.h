@@ -15,6 +15,8 @@
 #include "Refureku/TypeInfo/Variables/EVarFlags.h"
 #include "Refureku/TypeInfo/Functions/EFunctionFlags.h"
 #include "Refureku/TypeInfo/Functions/FunctionHelper.h"
+#include "Refureku/TypeInfo/DispatchTable.h"
+#include "Refureku/TypeInfo/Entity/EEntityKind.h"
 
 namespace rfk
 {
@@ -617,6 +619,93 @@ namespace rfk
 			RFK_NODISCARD REFUREKU_API 
 				EnumValue const*				getEnumValueById(std::size_t id)												const	noexcept;
 
+			/**
+			*	@brief	Get the dispatch table indexing all registered functions, static methods and methods
+			*			carrying a property of the provided archetype (or of a child archetype).
+			*			The table is built by the first call, then kept up to date each time an entity is registered or unregistered.
+			*			If a function could not be added to the table on registration (allocation failure), the table is rebuilt by this call.
+			*			Tables can be retrieved concurrently from several threads.
+			*
+			*	@param propertyArchetype Archetype of the indexed property.
+			*
+			*	@exception std::bad_alloc if the table could not be built or rebuilt.
+			*
+			*	@return The dispatch table indexing the provided property.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				DispatchTable const&			getDispatchTable(Struct const& propertyArchetype)								const;
+
+			/**
+			*	@brief	Get the dispatch table indexing all registered functions, static methods and methods
+			*			carrying a property of type PropertyType (or of a child type).
+			*			The table is built by the first call, then kept up to date each time an entity is registered or unregistered.
+			*			Tables can be retrieved concurrently from several threads.
+			*
+			*	@tparam PropertyType Type of the indexed property.
+			*
+			*	@return The dispatch table indexing the provided property.
+			*/
+			template <typename PropertyType>
+			RFK_NODISCARD DispatchTable const&	getDispatchTable()																const;
+
+			/**
+			*	@brief	Execute the given visitor on all registered entities carrying a property of the provided archetype.
+			*			Each entity is visited once, in an unspecified order.
+			*			The underlying index is kept up to date each time an entity is registered or unregistered.
+			* 
+			*	@param propertyArchetype	Archetype of the searched property.
+			*	@param visitor				Visitor function to call. Return false to abort the foreach loop.
+			*	@param userData				Optional user data forwarded to the visitor.
+			*	@param isChildClassValid	If true, entities carrying a property of a child archetype are visited too.
+			*	@param kindFilter			Kinds of the visited entities. EEntityKind::Undefined visits entities of any kind.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			*			If the visitor is nullptr, return false.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			REFUREKU_API bool					foreachEntityWithProperty(Struct const&		propertyArchetype,
+																		  Visitor<Entity>	visitor,
+																		  void*				userData,
+																		  bool				isChildClassValid	= true,
+																		  EEntityKind		kindFilter			= EEntityKind::Undefined)	const;
+
+			/**
+			*	@brief	Execute the given visitor on all registered entities carrying a property of type PropertyType.
+			*			Each entity is visited once, in an unspecified order.
+			* 
+			*	@tparam PropertyType Type of the searched property.
+			* 
+			*	@param visitor				Visitor function to call. Return false to abort the foreach loop.
+			*	@param userData				Optional user data forwarded to the visitor.
+			*	@param isChildClassValid	If true, entities carrying a property of a child type are visited too.
+			*	@param kindFilter			Kinds of the visited entities. EEntityKind::Undefined visits entities of any kind.
+			* 
+			*	@return	The last visitor result before exiting the loop.
+			*			If the visitor is nullptr, return false.
+			* 
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			template <typename PropertyType>
+			bool								foreachEntityWithProperty(Visitor<Entity>	visitor,
+																		  void*				userData,
+																		  bool				isChildClassValid	= true,
+																		  EEntityKind		kindFilter			= EEntityKind::Undefined)	const;
+
+			/**
+			*	@brief Get the number of registered entities carrying a property of the provided archetype.
+			* 
+			*	@param propertyArchetype	Archetype of the searched property.
+			*	@param isChildClassValid	If true, entities carrying a property of a child archetype are counted too.
+			*	@param kindFilter			Kinds of the counted entities. EEntityKind::Undefined counts entities of any kind.
+			* 
+			*	@return The number of registered entities carrying a property of the provided archetype.
+			*/
+			RFK_NODISCARD REFUREKU_API 
+				std::size_t						getEntitiesWithPropertyCount(Struct const&	propertyArchetype,
+																			 bool			isChildClassValid	= true,
+																			 EEntityKind	kindFilter			= EEntityKind::Undefined)	const	noexcept;
+
 		private:
 			//Forward declaration
 			class DatabaseImpl;
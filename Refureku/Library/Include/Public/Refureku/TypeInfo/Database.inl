@@ -22,4 +22,16 @@ Function const* Database::getFileLevelFunctionByName(char const* name, EFunction
 																func.hasSameName(userData.name) &&
 																internal::FunctionHelper<FunctionSignature>::hasSameSignature(func);
 													}, &data) : nullptr;
+}
+
+template <typename PropertyType>
+DispatchTable const& Database::getDispatchTable() const
+{
+	return getDispatchTable(PropertyType::staticGetArchetype());
+}
+
+template <typename PropertyType>
+bool Database::foreachEntityWithProperty(Visitor<Entity> visitor, void* userData, bool isChildClassValid, EEntityKind kindFilter) const
+{
+	return foreachEntityWithProperty(PropertyType::staticGetArchetype(), visitor, userData, isChildClassValid, kindFilter);
 }
\ No newline at end of file
@@ -0,0 +1,128 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cassert>
+
+#include "Refureku/Config.h"
+#include "Refureku/Containers/Vector.h"
+#include "Refureku/TypeInfo/Functions/ErasedCallThunk.h"
+
+namespace rfk
+{
+	//Forward declarations
+	class Database;
+	class FunctionBase;
+	class Property;
+	class Struct;
+
+	/** Function indexed by a DispatchTable. */
+	struct DispatchTableEntry
+	{
+		/** Indexed function, static method or method. */
+		FunctionBase const*	function;
+
+		/** Property of the function matching the table property archetype. */
+		Property const*		property;
+
+		/** Type-erased entry point of the function, nullptr if the function can't be invoked erased. */
+		ErasedCallThunk		thunk;
+
+		/** true if function is a non-static method, in which case a caller must be provided to invoke. */
+		bool				requiresCaller;
+
+		/**
+		*	@brief	Call the function with type-erased arguments.
+		*			The arguments count and types are not checked: providing bad arguments is undefined behaviour.
+		*
+		*	@param caller		Pointer to the instance the method is called on, ignored if requiresCaller is false.
+		*						The pointer is not adjusted, so it must point to an object of the method's outer struct.
+		*	@param args			Array of pointers to the arguments, one per parameter. See rfk::ErasedCallThunk.
+		*	@param returnValue	Pointer to uninitialized storage for the return value, or nullptr to discard it. See rfk::ErasedCallThunk.
+		*
+		*	@exception Any exception potentially thrown from the underlying function.
+		*/
+		inline void invoke(void*		caller,
+						   void* const*	args,
+						   void*		returnValue = nullptr)	const;
+	};
+
+	/**
+	*	@brief	Dense index of all registered functions, static methods and methods carrying a property of a given archetype
+	*			(or of a child archetype). Tables are retrieved through Database::getDispatchTable and are updated each time
+	*			an entity is registered to or unregistered from the database, so iterating over a table never queries metadata.
+	*			The order of the entries is unspecified and may change when a function is unregistered.
+	*/
+	class DispatchTable final
+	{
+		private:
+			/** Archetype of the property indexed by this table. */
+			Struct const*				_propertyArchetype;
+
+			/** Indexed functions. */
+			Vector<DispatchTableEntry>	_entries;
+
+			/** true if a registered function could not be added to the entries, in which case the table is rebuilt by the next Database::getDispatchTable call. */
+			bool						_needsRebuild = false;
+
+			/**
+			*	@brief Add a function to the table if it carries the indexed property.
+			*
+			*	@param function The function to add.
+			*
+			*	@exception std::bad_alloc if the entries could not be reallocated.
+			*/
+			REFUREKU_INTERNAL void	addIfMatching(FunctionBase const& function);
+
+			/**
+			*	@brief Remove a function from the table if it is indexed.
+			*
+			*	@param function The function to remove.
+			*/
+			REFUREKU_INTERNAL void	remove(FunctionBase const& function)		noexcept;
+
+		public:
+			REFUREKU_INTERNAL DispatchTable(Struct const& propertyArchetype)	noexcept;
+			DispatchTable(DispatchTable const&)									= delete;
+			DispatchTable(DispatchTable&&)										= delete;
+
+			/**
+			*	@brief Get the archetype of the property indexed by this table.
+			*
+			*	@return The archetype of the property indexed by this table.
+			*/
+			RFK_NODISCARD inline Struct const&						getPropertyArchetype()	const	noexcept;
+
+			/**
+			*	@brief Get all the entries of the table.
+			*
+			*	@return All the entries of the table.
+			*/
+			RFK_NODISCARD inline Vector<DispatchTableEntry> const&	getEntries()			const	noexcept;
+
+			/**
+			*	@brief Get the number of functions indexed by the table.
+			*
+			*	@return The number of functions indexed by the table.
+			*/
+			RFK_NODISCARD inline std::size_t						getEntriesCount()		const	noexcept;
+
+			/**
+			*	@brief Iterators over the entries so that the table can be used in a range-based for loop.
+			*/
+			RFK_NODISCARD inline DispatchTableEntry const*			begin()					const	noexcept;
+			RFK_NODISCARD inline DispatchTableEntry const*			end()					const	noexcept;
+
+			DispatchTable& operator=(DispatchTable const&)	= delete;
+			DispatchTable& operator=(DispatchTable&&)		= delete;
+
+		friend Database;
+	};
+
+	#include "Refureku/TypeInfo/DispatchTable.inl"
+}
@@ -0,0 +1,38 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline void DispatchTableEntry::invoke(void* caller, void* const* args, void* returnValue) const
+{
+	assert(thunk != nullptr);
+
+	thunk(caller, args, returnValue);
+}
+
+inline Struct const& DispatchTable::getPropertyArchetype() const noexcept
+{
+	return *_propertyArchetype;
+}
+
+inline Vector<DispatchTableEntry> const& DispatchTable::getEntries() const noexcept
+{
+	return _entries;
+}
+
+inline std::size_t DispatchTable::getEntriesCount() const noexcept
+{
+	return _entries.size();
+}
+
+inline DispatchTableEntry const* DispatchTable::begin() const noexcept
+{
+	return _entries.begin();
+}
+
+inline DispatchTableEntry const* DispatchTable::end() const noexcept
+{
+	return _entries.end();
+}
@@ -0,0 +1,153 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>		//std::size_t
+#include <functional>	//std::hash
+
+#include "Refureku/TypeInfo/Functions/Method.h"
+
+namespace rfk
+{
+	/**
+	*	@brief	Pair of an instance and one of its reflected methods, resolved once at bind time.
+	*			The caller pointer adjustment and the internal function lookups are performed when the
+	*			BoundMethod is created, so invoking it doesn't perform any metadata lookup.
+	*			BoundMethods are comparable and hashable so that they can be stored in delegate lists.
+	*			A BoundMethod doesn't extend the lifetime of the bound instance.
+	*/
+	class BoundMethod
+	{
+		private:
+			/** Caller pointer already adjusted to the method's outer struct. */
+			void*				_caller			= nullptr;
+
+			/** Bound method. */
+			Method const*		_method			= nullptr;
+
+			/** Cached internal function of the bound method. */
+			ICallable const*	_internalMethod	= nullptr;
+
+			/** Cached type-erased entry point of the bound method, can be nullptr. */
+			ErasedCallThunk		_erasedThunk	= nullptr;
+
+		public:
+			BoundMethod()							= default;
+			BoundMethod(BoundMethod const&)			= default;
+			BoundMethod(BoundMethod&&)				= default;
+
+			/**
+			*	@param caller Instance the method is bound to. The pointer is adjusted the same way Method::invoke does.
+			*	@param method Method to bind.
+			* 
+			*	@exception InvalidArchetype if the caller dynamic archetype couldn't be casted to the method outer struct's archetype.
+			*	@exception ConstViolation if the caller is const but the method is non-const.
+			*/
+			template <typename CallerType, typename = internal::IsAdjustableInstance<CallerType>>
+			BoundMethod(CallerType&		caller,
+						Method const&	method);
+
+			/**
+			*	@brief	Bind a method to an instance without performing any pointer adjustment.
+			*			Binding a caller which is not a valid pointer to an object of the method's owner archetype has an undefined behaviour.
+			*
+			*	@param caller Instance the method is bound to.
+			*	@param method Method to bind.
+			*/
+			BoundMethod(void*			caller,
+						Method const&	method)				noexcept;
+
+			/**
+			*	@brief	Bind a method to a const instance without performing any pointer adjustment.
+			*			Binding a caller which is not a valid pointer to an object of the method's owner archetype has an undefined behaviour.
+			*
+			*	@param caller Instance the method is bound to.
+			*	@param method Method to bind.
+			* 
+			*	@exception ConstViolation if the method is non-const.
+			*/
+			BoundMethod(void const*		caller,
+						Method const&	method);
+
+			/**
+			*	@brief	Call the bound method with the forwarded argument(s) if any, and return the result.
+			*			Providing bad return type / parameters is undefined behaviour.
+			*			Calling an unbound BoundMethod is undefined behaviour.
+			*
+			*	@tparam ReturnType	Return type of the method.
+			*	@tparam... ArgTypes	Type of all arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param args Arguments forwarded to the method call.
+			* 
+			*	@return The result of the method call.
+			* 
+			*	@exception Any exception potentially thrown from the underlying method.
+			*/
+			template <typename ReturnType = void, typename... ArgTypes>
+			ReturnType				invoke(ArgTypes&&... args)								const;
+
+			/**
+			*	@brief	Call the bound method with type-erased arguments.
+			*			The arguments count and types are not checked: providing bad arguments is undefined behaviour.
+			*			Calling this method if the bound method can't be invoked erased (see Method::canInvokeErased) is undefined behaviour.
+			*
+			*	@param args			Array of pointers to the arguments, one per parameter. See rfk::ErasedCallThunk.
+			*	@param returnValue	Pointer to uninitialized storage for the return value, or nullptr to discard it. See rfk::ErasedCallThunk.
+			* 
+			*	@exception Any exception potentially thrown from the underlying method.
+			*/
+			inline void				invokeErased(void* const*	args,
+												 void*			returnValue = nullptr)		const;
+
+			/**
+			*	@brief Get the adjusted caller pointer the method is bound to.
+			* 
+			*	@return The adjusted caller pointer, nullptr if the BoundMethod is unbound.
+			*/
+			RFK_NODISCARD inline void*			getCaller()								const	noexcept;
+
+			/**
+			*	@brief Get the bound method.
+			* 
+			*	@return The bound method, nullptr if the BoundMethod is unbound.
+			*/
+			RFK_NODISCARD inline Method const*	getMethod()								const	noexcept;
+
+			/**
+			*	@return true if a method is bound, else false.
+			*/
+			RFK_NODISCARD inline bool			isBound()								const	noexcept;
+
+			BoundMethod&			operator=(BoundMethod const&)									= default;
+			BoundMethod&			operator=(BoundMethod&&)										= default;
+
+			/**
+			*	@brief Two BoundMethods are equal if they bind the same method to the same instance.
+			*/
+			RFK_NODISCARD inline bool	operator==(BoundMethod const& other)					const	noexcept;
+			RFK_NODISCARD inline bool	operator!=(BoundMethod const& other)					const	noexcept;
+	};
+
+	#include "Refureku/TypeInfo/Functions/BoundMethod.inl"
+}
+
+namespace std
+{
+	template <>
+	struct hash<rfk::BoundMethod>
+	{
+		std::size_t operator()(rfk::BoundMethod const& boundMethod) const noexcept
+		{
+			std::size_t callerHash = std::hash<void*>()(boundMethod.getCaller());
+
+			//Combine both hashes
+			return callerHash ^ (std::hash<rfk::Method const*>()(boundMethod.getMethod()) + 0x9e3779b9 + (callerHash << 6) + (callerHash >> 2));
+		}
+	};
+}
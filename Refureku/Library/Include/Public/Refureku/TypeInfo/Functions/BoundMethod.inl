@@ -0,0 +1,67 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename CallerType, typename>
+BoundMethod::BoundMethod(CallerType& caller, Method const& method):
+	BoundMethod(method.adjustCallerPointerAddress(&caller), method)
+{
+}
+
+inline BoundMethod::BoundMethod(void* caller, Method const& method) noexcept:
+	_caller{caller},
+	_method{&method},
+	_internalMethod{method.getInternalFunction()},
+	_erasedThunk{method.getErasedCallThunk()}
+{
+}
+
+inline BoundMethod::BoundMethod(void const* caller, Method const& method):
+	BoundMethod(const_cast<void*>(caller), method)
+{
+	if (!method.isConst())
+	{
+		method.throwConstViolationException();
+	}
+}
+
+template <typename ReturnType, typename... ArgTypes>
+ReturnType BoundMethod::invoke(ArgTypes&&... args) const
+{
+	return Method::MemberFunctionSafeCallWrapper<ReturnType(ArgTypes...)>::invoke(*_internalMethod, _caller, std::forward<ArgTypes>(args)...);
+}
+
+inline void BoundMethod::invokeErased(void* const* args, void* returnValue) const
+{
+	assert(_erasedThunk != nullptr);
+
+	_erasedThunk(_caller, args, returnValue);
+}
+
+inline void* BoundMethod::getCaller() const noexcept
+{
+	return _caller;
+}
+
+inline Method const* BoundMethod::getMethod() const noexcept
+{
+	return _method;
+}
+
+inline bool BoundMethod::isBound() const noexcept
+{
+	return _method != nullptr;
+}
+
+inline bool BoundMethod::operator==(BoundMethod const& other) const noexcept
+{
+	return _caller == other._caller && _method == other._method;
+}
+
+inline bool BoundMethod::operator!=(BoundMethod const& other) const noexcept
+{
+	return !(*this == other);
+}
@@ -0,0 +1,35 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Refureku/Misc/FundamentalTypes.h"
+
+namespace rfk
+{
+	/** Calling convention of a native entry point, as needed by FFI/JIT code emitting native calls. */
+	enum class ENativeCallingConvention : uint8
+	{
+		/** The calling convention of the target platform is not known. */
+		Unknown = 0,
+
+		/** x86 (32-bit) cdecl convention. */
+		Cdecl,
+
+		/** System V AMD64 convention (x86-64 Linux, macOS, BSD...). */
+		SystemV,
+
+		/** Microsoft x64 convention (x86-64 Windows). */
+		Win64,
+
+		/** ARM (32-bit) procedure call standard. */
+		Aapcs,
+
+		/** ARM64 procedure call standard. */
+		Aapcs64
+	};
+}
@@ -0,0 +1,38 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Refureku/Misc/FundamentalTypes.h"
+
+namespace rfk
+{
+	/** ABI-level classification of a parameter or return value, as needed by FFI/JIT code emitting native calls. */
+	enum class ENativeValueClass : uint8
+	{
+		/** No value (void return type). */
+		Void = 0,
+
+		/** Integer value, including bool, characters and enums. */
+		Integral,
+
+		/** Floating point value. */
+		FloatingPoint,
+
+		/** Pointer or reference, passed as an address. */
+		Pointer,
+
+		/** Trivially copyable and trivially destructible struct/class/union passed by value. */
+		Aggregate,
+
+		/**
+		*	Struct/class/union passed by value which is not trivially copyable or not trivially destructible.
+		*	Most ABIs pass such values through a hidden reference to a caller-owned copy.
+		*/
+		NonTrivialAggregate
+	};
+}
@@ -0,0 +1,108 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <new>			//placement new
+#include <cstddef>		//std::size_t
+#include <utility>		//std::forward, std::index_sequence
+#include <type_traits>	//std::remove_reference_t, std::is_void_v
+
+namespace rfk
+{
+	/**
+	*	@brief	Uniform signature used to call any reflected function without knowing its prototype at compile time.
+	*
+	*	@param caller		Pointer to the instance the method is called on. Ignored for non-member functions.
+	*	@param args			Array of pointers to the arguments, one per parameter. Each pointer must point to an object of the decayed parameter type.
+	*						Arguments received by value or by rvalue reference are moved from.
+	*	@param returnValue	Pointer to uninitialized storage for the return value, or nullptr to discard it.
+	*						When the function returns a reference, the address of the referenced object is stored in a pointer at returnValue.
+	*						Ignored for functions returning void.
+	*/
+	using ErasedCallThunk = void (*)(void* caller, void* const* args, void* returnValue);
+
+	namespace internal
+	{
+		/** Base declaration of the helper. FunctionPtr is the address of the function the thunk forwards the call to. */
+		template <auto FunctionPtr, typename FunctionPtrType = decltype(FunctionPtr)>
+		class ErasedCallThunkHelper;
+
+		class ErasedCallThunkHelperBase
+		{
+			protected:
+				/**
+				*	@brief Cast the provided type-erased argument to the parameter type and forward it.
+				*
+				*	@tparam ArgType Type of the targeted parameter.
+				*
+				*	@param arg Pointer to the argument.
+				*
+				*	@return The forwarded argument.
+				*/
+				template <typename ArgType>
+				static ArgType&&	forwardArg(void* arg)							noexcept;
+
+				/**
+				*	@brief Call the provided callable and write its result to the provided storage.
+				*
+				*	@param callable		Callable receiving all unpacked arguments.
+				*	@param args			Array of pointers to the arguments.
+				*	@param returnValue	Storage for the return value, can be nullptr.
+				*/
+				template <typename ReturnType, typename... ArgTypes, typename Callable, std::size_t... Indices>
+				static void			call(Callable const&				callable,
+										 void* const*					args,
+										 void*							returnValue,
+										 std::index_sequence<Indices...>);
+		};
+
+		/** Overload for non-member functions. */
+		template <auto FunctionPtr, typename ReturnType, typename... ArgTypes>
+		class ErasedCallThunkHelper<FunctionPtr, ReturnType(*)(ArgTypes...)> : public ErasedCallThunkHelperBase
+		{
+			public:
+				static void invoke(void* caller, void* const* args, void* returnValue);
+		};
+
+		/** Overload for noexcept non-member functions. */
+		template <auto FunctionPtr, typename ReturnType, typename... ArgTypes>
+		class ErasedCallThunkHelper<FunctionPtr, ReturnType(*)(ArgTypes...) noexcept> : public ErasedCallThunkHelper<FunctionPtr, ReturnType(*)(ArgTypes...)>
+		{
+		};
+
+		/** Overload for methods. */
+		template <auto FunctionPtr, typename CallerType, typename ReturnType, typename... ArgTypes>
+		class ErasedCallThunkHelper<FunctionPtr, ReturnType(CallerType::*)(ArgTypes...)> : public ErasedCallThunkHelperBase
+		{
+			public:
+				static void invoke(void* caller, void* const* args, void* returnValue);
+		};
+
+		/** Overload for noexcept methods. */
+		template <auto FunctionPtr, typename CallerType, typename ReturnType, typename... ArgTypes>
+		class ErasedCallThunkHelper<FunctionPtr, ReturnType(CallerType::*)(ArgTypes...) noexcept> : public ErasedCallThunkHelper<FunctionPtr, ReturnType(CallerType::*)(ArgTypes...)>
+		{
+		};
+
+		/** Overload for const methods. */
+		template <auto FunctionPtr, typename CallerType, typename ReturnType, typename... ArgTypes>
+		class ErasedCallThunkHelper<FunctionPtr, ReturnType(CallerType::*)(ArgTypes...) const> : public ErasedCallThunkHelperBase
+		{
+			public:
+				static void invoke(void* caller, void* const* args, void* returnValue);
+		};
+
+		/** Overload for const noexcept methods. */
+		template <auto FunctionPtr, typename CallerType, typename ReturnType, typename... ArgTypes>
+		class ErasedCallThunkHelper<FunctionPtr, ReturnType(CallerType::*)(ArgTypes...) const noexcept> : public ErasedCallThunkHelper<FunctionPtr, ReturnType(CallerType::*)(ArgTypes...) const>
+		{
+		};
+
+		#include "Refureku/TypeInfo/Functions/ErasedCallThunk.inl"
+	}
+}
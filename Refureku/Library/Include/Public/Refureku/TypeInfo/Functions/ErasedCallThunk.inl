@@ -0,0 +1,78 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+////////////////// ErasedCallThunkHelperBase
+
+template <typename ArgType>
+ArgType&& ErasedCallThunkHelperBase::forwardArg(void* arg) noexcept
+{
+	return std::forward<ArgType>(*static_cast<std::remove_reference_t<ArgType>*>(arg));
+}
+
+template <typename ReturnType, typename... ArgTypes, typename Callable, std::size_t... Indices>
+void ErasedCallThunkHelperBase::call(Callable const& callable, [[maybe_unused]] void* const* args, [[maybe_unused]] void* returnValue, std::index_sequence<Indices...>)
+{
+	if constexpr (std::is_void_v<ReturnType>)
+	{
+		callable(forwardArg<ArgTypes>(args[Indices])...);
+	}
+	else if constexpr (std::is_reference_v<ReturnType>)
+	{
+		std::remove_reference_t<ReturnType>* result = &callable(forwardArg<ArgTypes>(args[Indices])...);
+
+		if (returnValue != nullptr)
+		{
+			*static_cast<std::remove_reference_t<ReturnType>**>(returnValue) = result;
+		}
+	}
+	else
+	{
+		if (returnValue != nullptr)
+		{
+			new (returnValue) ReturnType(callable(forwardArg<ArgTypes>(args[Indices])...));
+		}
+		else
+		{
+			callable(forwardArg<ArgTypes>(args[Indices])...);
+		}
+	}
+}
+
+////////////////// Non-member functions
+
+template <auto FunctionPtr, typename ReturnType, typename... ArgTypes>
+void ErasedCallThunkHelper<FunctionPtr, ReturnType(*)(ArgTypes...)>::invoke(void* /* caller */, void* const* args, void* returnValue)
+{
+	call<ReturnType, ArgTypes...>([](ArgTypes&&... forwardedArgs) -> ReturnType
+								  {
+									  return (*FunctionPtr)(std::forward<ArgTypes>(forwardedArgs)...);
+								  }, args, returnValue, std::index_sequence_for<ArgTypes...>());
+}
+
+////////////////// Methods
+
+template <auto FunctionPtr, typename CallerType, typename ReturnType, typename... ArgTypes>
+void ErasedCallThunkHelper<FunctionPtr, ReturnType(CallerType::*)(ArgTypes...)>::invoke(void* caller, void* const* args, void* returnValue)
+{
+	CallerType& callerRef = *static_cast<CallerType*>(caller);
+
+	call<ReturnType, ArgTypes...>([&callerRef](ArgTypes&&... forwardedArgs) -> ReturnType
+								  {
+									  return (callerRef.*FunctionPtr)(std::forward<ArgTypes>(forwardedArgs)...);
+								  }, args, returnValue, std::index_sequence_for<ArgTypes...>());
+}
+
+template <auto FunctionPtr, typename CallerType, typename ReturnType, typename... ArgTypes>
+void ErasedCallThunkHelper<FunctionPtr, ReturnType(CallerType::*)(ArgTypes...) const>::invoke(void* caller, void* const* args, void* returnValue)
+{
+	CallerType const& callerRef = *static_cast<CallerType const*>(caller);
+
+	call<ReturnType, ArgTypes...>([&callerRef](ArgTypes&&... forwardedArgs) -> ReturnType
+								  {
+									  return (callerRef.*FunctionPtr)(std::forward<ArgTypes>(forwardedArgs)...);
+								  }, args, returnValue, std::index_sequence_for<ArgTypes...>());
+}
@@ -26,6 +26,19 @@ ReturnType Function::checkedInvoke(ArgTypes&&... args) const
 	return invoke<ReturnType, ArgTypes...>(std::forward<ArgTypes>(args)...);
 }
 
+template <typename ReturnType, typename... ArgTypes>
+Result<ReturnType> Function::tryCheckedInvoke(ArgTypes&&... args) const
+{
+	EResultCode code = matchSignature<ReturnType, ArgTypes...>();
+
+	if (code != EResultCode::Success)
+	{
+		return Result<ReturnType>::makeFailure(code);
+	}
+
+	return internal::makeSuccessfulResult<ReturnType>([&]() -> ReturnType { return internalInvoke<ReturnType, ArgTypes...>(std::forward<ArgTypes>(args)...); });
+}
+
 template <auto FuncPtr>
 Function const* getFunction() noexcept
 {
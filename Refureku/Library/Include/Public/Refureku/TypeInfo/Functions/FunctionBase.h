@@ -10,9 +10,16 @@
 #include "Refureku/TypeInfo/Entity/Entity.h"
 #include "Refureku/TypeInfo/Functions/FunctionParameter.h"
 #include "Refureku/TypeInfo/Functions/ICallable.h"
+#include "Refureku/TypeInfo/Functions/ErasedCallThunk.h"
+#include "Refureku/TypeInfo/Functions/NativeEntryPoint.h"
+#include "Refureku/Misc/Result.h"
 
 namespace rfk
 {
+	//Forward declaration
+	template <typename FunctionPrototype>
+	class PreparedCall;
+
 	class FunctionBase : public Entity
 	{
 		public:
@@ -39,6 +46,37 @@ namespace rfk
 			*/
 			RFK_NODISCARD REFUREKU_API bool							hasSameSignature(FunctionBase const& other)	const	noexcept;
 
+			/**
+			*	@brief	Check the provided signature against this function once, and get a handle to call the function without any further check.
+			*			The returned handle can be stored and reused as long as this function is alive.
+			*			This method is defined in Refureku/TypeInfo/Functions/PreparedCall.h, which must be included to call it.
+			*			**WARNING**: Unreflected archetypes can't be compared, so they will pass through the type checks.
+			* 
+			*	@tparam		ReturnType	Return type of the function.
+			*	@tparam...	ArgTypes	Type of all parameters of the function.
+			* 
+			*	@return A handle calling this function with the provided signature.
+			* 
+			*	@exception	ArgCountMismatch	if sizeof...(ArgTypes) is not the same as the value returned by getParametersCount().
+			*	@exception	ArgTypeMismatch		if ArgTypes... are not strictly the same as this function parameter types.
+			*	@exception	ReturnTypeMismatch	if ReturnType is not strictly the same as this function return type.
+			*/
+			template <typename ReturnType, typename... ArgTypes>
+			RFK_NODISCARD PreparedCall<ReturnType(ArgTypes...)>			prepare()									const;
+
+			/**
+			*	@brief	Non-throwing version of FunctionBase::prepare.
+			*			This method is defined in Refureku/TypeInfo/Functions/PreparedCall.h, which must be included to call it.
+			* 
+			*	@tparam		ReturnType	Return type of the function.
+			*	@tparam...	ArgTypes	Type of all parameters of the function.
+			* 
+			*	@return	A handle calling this function with the provided signature, or EResultCode::ArgCountMismatch,
+			*			EResultCode::ArgTypeMismatch or EResultCode::ReturnTypeMismatch if the provided signature doesn't match.
+			*/
+			template <typename ReturnType, typename... ArgTypes>
+			Result<PreparedCall<ReturnType(ArgTypes...)>>				tryPrepare()								const	noexcept;
+
 			/**
 			*	@tparam... ArgTypes Argument types to compare with.
 			*
@@ -78,6 +116,44 @@ namespace rfk
 			*/
 			RFK_NODISCARD REFUREKU_API ICallable*					getInternalFunction()						const	noexcept;
 
+			/**
+			*	@brief	Get the type-erased entry point of this function.
+			*			The thunk can be called with runtime values without knowing the function prototype at compile time.
+			*			See rfk::ErasedCallThunk for the calling convention.
+			*	
+			*	@return The type-erased entry point of this function, nullptr if none was provided.
+			*/
+			RFK_NODISCARD REFUREKU_API ErasedCallThunk				getErasedCallThunk()						const	noexcept;
+
+			/**
+			*	@brief Check whether this function can be called through invokeErased.
+			*	
+			*	@return true if a type-erased entry point was provided for this function, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API bool							canInvokeErased()							const	noexcept;
+
+			/**
+			*	@brief Set the type-erased entry point of this function.
+			*	
+			*	@param thunk Type-erased entry point forwarding the call to the underlying function.
+			*/
+			REFUREKU_API void										setErasedCallThunk(ErasedCallThunk thunk)			noexcept;
+
+			/**
+			*	@brief	Get the native entry point of this function, to call it directly from JIT or FFI code.
+			*			See rfk::NativeEntryPoint for the calling convention.
+			*	
+			*	@return The native entry point of this function, nullptr if none was provided.
+			*/
+			RFK_NODISCARD REFUREKU_API NativeEntryPoint const*		getNativeEntryPoint()						const	noexcept;
+
+			/**
+			*	@brief Set the native entry point of this function.
+			*	
+			*	@param entryPoint Native entry point of the function. It must outlive this function (static storage).
+			*/
+			REFUREKU_API void										setNativeEntryPoint(NativeEntryPoint const* entryPoint)	noexcept;
+
 			/**
 			*	@brief Add a parameter to the function.
 			*	
@@ -135,6 +211,14 @@ namespace rfk
 			template <typename ReturnType>
 			void	checkReturnType()		const;
 
+			/**
+			*	@brief	Non-throwing equivalent of checkReturnType + checkParameterTypes.
+			* 
+			*	@return EResultCode::Success if the provided signature matches this function's, else the code of the first mismatch.
+			*/
+			template <typename ReturnType, typename... ArgTypes>
+			RFK_NODISCARD EResultCode	matchSignature()	const	noexcept;
+
 		private:
 			/**
 			*	@brief Check that the provided type is the same as this function's.
@@ -164,6 +248,16 @@ namespace rfk
 			template <typename... ArgTypes>
 			RFK_NODISCARD bool				hasSameParameterTypes()									const	noexcept;
 
+			/**
+			*	@brief Check that the parameter types match (with the same rules as checkParameterTypes).
+			* 
+			*	@return true if all parameter types match, else false.
+			*/
+			template <std::size_t Rank, typename FirstArgType, typename SecondArgType, typename... OtherArgTypes>
+			RFK_NODISCARD bool				matchParameterTypes()									const	noexcept;
+			template <std::size_t Rank, typename LastArgType>
+			RFK_NODISCARD bool				matchParameterTypes()									const	noexcept;
+
 			/**
 			*	@brief Check that the parameter types match, and throw an ArgTypeMismatch exception if it is not the case.
 			*/
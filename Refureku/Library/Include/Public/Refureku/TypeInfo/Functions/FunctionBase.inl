@@ -107,4 +107,40 @@ void FunctionBase::checkReturnType() const
 	{
 		throwReturnTypeMismatchException();
 	}
+}
+
+template <std::size_t Rank, typename FirstArgType, typename SecondArgType, typename... OtherArgTypes>
+bool FunctionBase::matchParameterTypes() const noexcept
+{
+	return matchParameterTypes<Rank, FirstArgType>() && matchParameterTypes<Rank + 1, SecondArgType, OtherArgTypes...>();
+}
+
+template <std::size_t Rank, typename LastArgType>
+bool FunctionBase::matchParameterTypes() const noexcept
+{
+	return getParameterAt(Rank).getType().match(rfk::getType<LastArgType>());
+}
+
+template <typename ReturnType, typename... ArgTypes>
+EResultCode FunctionBase::matchSignature() const noexcept
+{
+	if (!hasSameReturnType<ReturnType>())
+	{
+		return EResultCode::ReturnTypeMismatch;
+	}
+
+	if (!hasSameParametersCount<ArgTypes...>())
+	{
+		return EResultCode::ArgCountMismatch;
+	}
+
+	if constexpr (sizeof...(ArgTypes) != 0u)
+	{
+		if (!matchParameterTypes<0u, ArgTypes...>())
+		{
+			return EResultCode::ArgTypeMismatch;
+		}
+	}
+
+	return EResultCode::Success;
 }
\ No newline at end of file
@@ -12,11 +12,11 @@ namespace rfk
 	class ICallable
 	{
 		public:
-			//Must be virtual because MemberFunction and NonMemberFunction instances are stored and deleted as SharedPtr<ICallable>
+			//Must be virtual because MemberFunction and NonMemberFunction instances can be owned and deleted as ICallable*
 			virtual	~ICallable() = default;
 
 		protected:
-			ICallable()					= default;
+			constexpr ICallable()		= default;
 			ICallable(ICallable const&)	= default;
 			ICallable(ICallable&&)		= default;
 	};
@@ -0,0 +1,287 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <new>			//placement new
+#include <cstddef>		//std::size_t, std::max_align_t
+#include <cassert>
+#include <array>
+#include <utility>		//std::forward, std::move
+#include <type_traits>	//std::decay_t, std::is_trivially_destructible_v
+
+#include "Refureku/TypeInfo/Functions/Function.h"
+#include "Refureku/TypeInfo/Functions/StaticMethod.h"
+#include "Refureku/TypeInfo/Functions/BoundMethod.h"
+#include "Refureku/Misc/UniquePtr.h"
+
+namespace rfk
+{
+	/**
+	*	@brief	Contiguous arena recording reflected calls to execute them later, typically on another thread.
+	*			Each command stores the type-erased entry point of the called function, the caller pointer and
+	*			a copy of each argument constructed in place, so recording a command never allocates memory.
+	*			The storage of each command is computed at compile time from the decayed argument types,
+	*			which must be the decayed types of the called function parameters (asserted in debug).
+	*			All recorded commands are executed in recording order by a single call to execute(), which then resets the arena.
+	*
+	*			Reference parameters are bound to the copy stored in the buffer, so pass a pointer to retrieve a result.
+	*			Only functions which can be invoked erased (see FunctionBase::canInvokeErased) can be recorded.
+	*
+	*			The buffer is not synchronized: producer threads usually record under a lock while the consumer thread
+	*			swaps the filled buffer with an empty one before executing it outside of the lock.
+	*/
+	class InvocationCommandBuffer
+	{
+		private:
+			/** Signature of the routine destroying the arguments of a command. */
+			using ArgumentsDestructor = void (*)(void* const* args) noexcept;
+
+			/**
+			*	Header of each command.
+			*	It is followed by an array of pointers to the arguments, then by the arguments themselves.
+			*/
+			struct CommandHeader
+			{
+				/** Entry point of the called function. */
+				ErasedCallThunk		thunk;
+
+				/** Caller pointer forwarded to the thunk, nullptr for non-member functions. */
+				void*				caller;
+
+				/** Routine destroying the arguments, nullptr if all arguments are trivially destructible. */
+				ArgumentsDestructor	destroyArguments;
+
+				/** Size in bytes of the whole command, including this header and the padding before the next command. */
+				std::size_t			size;
+			};
+
+			/**
+			*	Compile time layout of a command recording the provided decayed argument types.
+			*/
+			template <typename... ArgTypes>
+			struct CommandLayout
+			{
+				static_assert(((alignof(ArgTypes) <= alignof(std::max_align_t)) && ...), "Over-aligned arguments can't be recorded in an InvocationCommandBuffer.");
+
+				/**
+				*	@brief Compute the offset of each argument from the beginning of the command.
+				*
+				*	@return The offset of each argument.
+				*/
+				RFK_NODISCARD static constexpr std::array<std::size_t, sizeof...(ArgTypes)>	computeArgumentOffsets()			noexcept;
+
+				/**
+				*	@brief Compute the size of the whole command, padded so that the next command is correctly aligned.
+				*
+				*	@return The size of the command.
+				*/
+				RFK_NODISCARD static constexpr std::size_t									computeSize()						noexcept;
+
+				/**
+				*	@brief Destroy all arguments of a command.
+				*
+				*	@param args Pointers to the arguments.
+				*/
+				static void																	destroyArguments(void* const* args)	noexcept;
+
+				/**
+				*	@brief Destroy the first arguments of a command, used when constructing an argument threw.
+				*
+				*	@param args		Pointers to the arguments.
+				*	@param count	Number of constructed arguments to destroy.
+				*/
+				static void																	destroyFirstArguments(void* const*	args,
+																												  std::size_t	count)	noexcept;
+			};
+
+			/** Storage of the commands, allocated once. */
+			UniquePtr<std::max_align_t[]>	_storage;
+
+			/** Size in bytes of the storage. */
+			std::size_t						_capacity		= 0u;
+
+			/** Offset of the end of the last recorded command. */
+			std::size_t						_writeOffset	= 0u;
+
+			/** Offset of the next command to execute. */
+			std::size_t						_readOffset		= 0u;
+
+			/** Number of commands recorded and not executed yet. */
+			std::size_t						_commandsCount	= 0u;
+
+			/**
+			*	@brief Align the provided value up to the provided alignment.
+			*
+			*	@param value		Value to align.
+			*	@param alignment	Alignment, must be a power of 2.
+			*
+			*	@return The aligned value.
+			*/
+			RFK_NODISCARD static constexpr std::size_t	alignUp(std::size_t value,
+																std::size_t alignment)				noexcept;
+
+			/**
+			*	@brief Get the base address of the storage as a byte pointer.
+			*/
+			RFK_NODISCARD inline unsigned char*			getStorageBytes()					const	noexcept;
+
+			/**
+			*	@brief	Copy the arguments in place at the end of the arena and record the command.
+			*
+			*	@param thunk	Entry point of the called function.
+			*	@param caller	Caller pointer forwarded to the thunk.
+			*	@param args		Arguments to copy in the buffer.
+			*
+			*	@return true if the command has been recorded, false if there was not enough space left in the buffer.
+			*/
+			template <typename... ArgTypes>
+			bool										recordCommand(ErasedCallThunk	thunk,
+																	  void*				caller,
+																	  ArgTypes&&...		args);
+
+			/**
+			*	@brief	Check that each decayed argument type is the decayed type of the matching parameter of the function,
+			*			so that the called thunk reads the stored arguments as the right type.
+			*
+			*	@param function Function the arguments are recorded for.
+			*
+			*	@return true if all argument types match the function parameter types, else false.
+			*/
+			template <typename... ArgTypes>
+			RFK_NODISCARD static bool					matchParameterTypes(FunctionBase const& function)	noexcept;
+
+			/**
+			*	@brief Check that the provided parameter type is ArgType, optionally const qualified and/or referenced.
+			*
+			*	@param parameterType Type of the parameter.
+			*
+			*	@return true if the decayed parameter type is ArgType, else false.
+			*/
+			template <typename ArgType>
+			RFK_NODISCARD static bool					isDecayedParameterType(Type const& parameterType)	noexcept;
+
+			/**
+			*	@brief Destroy the arguments of the command located at the provided offset.
+			*
+			*	@param offset Offset of the command in the storage.
+			*
+			*	@return The size of the command.
+			*/
+			inline std::size_t							destroyCommand(std::size_t offset)	const	noexcept;
+
+		public:
+			/**
+			*	@param capacity Size in bytes of the buffer. The whole storage is allocated by the constructor.
+			*/
+			explicit inline InvocationCommandBuffer(std::size_t capacity);
+			inline InvocationCommandBuffer(InvocationCommandBuffer&&)						noexcept;
+			InvocationCommandBuffer(InvocationCommandBuffer const&)							= delete;
+			inline ~InvocationCommandBuffer()												noexcept;
+
+			/**
+			*	@brief	Record a call to a non-member function.
+			*			The decayed type of each argument must be the decayed type of the matching parameter (asserted in debug).
+			*
+			*	@param function	Function to call. It must be invokable erased.
+			*	@param args		Arguments copied (or moved) in the buffer.
+			*
+			*	@return true if the command has been recorded, false if there was not enough space left in the buffer.
+			*
+			*	@exception Any exception potentially thrown when copying (or moving) an argument in the buffer.
+			*			   The arguments already copied are destroyed and the command is not recorded.
+			*/
+			template <typename... ArgTypes>
+			bool	record(Function const&	function,
+						   ArgTypes&&...	args);
+
+			/**
+			*	@brief	Record a call to a static method.
+			*			The decayed type of each argument must be the decayed type of the matching parameter (asserted in debug).
+			*
+			*	@param staticMethod	Static method to call. It must be invokable erased.
+			*	@param args			Arguments copied (or moved) in the buffer.
+			*
+			*	@return true if the command has been recorded, false if there was not enough space left in the buffer.
+			*
+			*	@exception Any exception potentially thrown when copying (or moving) an argument in the buffer.
+			*			   The arguments already copied are destroyed and the command is not recorded.
+			*/
+			template <typename... ArgTypes>
+			bool	record(StaticMethod const&	staticMethod,
+						   ArgTypes&&...		args);
+
+			/**
+			*	@brief	Record a call to a method bound to an instance.
+			*			The instance must outlive the execution of the command.
+			*			The decayed type of each argument must be the decayed type of the matching parameter (asserted in debug).
+			*
+			*	@param boundMethod	Bound method to call. The method must be invokable erased.
+			*	@param args			Arguments copied (or moved) in the buffer.
+			*
+			*	@return true if the command has been recorded, false if there was not enough space left in the buffer.
+			*
+			*	@exception Any exception potentially thrown when copying (or moving) an argument in the buffer.
+			*			   The arguments already copied are destroyed and the command is not recorded.
+			*/
+			template <typename... ArgTypes>
+			bool	record(BoundMethod const&	boundMethod,
+						   ArgTypes&&...		args);
+
+			/**
+			*	@brief	Execute all recorded commands in recording order, then reset the buffer.
+			*			Commands recorded while executing (from a called function) are executed in the same batch.
+			*			If a command throws, the commands that were not executed yet are kept and can be discarded with clear().
+			*
+			*	@return The number of executed commands.
+			*
+			*	@exception Any exception potentially thrown from a called function.
+			*/
+			inline std::size_t			execute();
+
+			/**
+			*	@brief Discard all recorded commands without executing them.
+			*/
+			inline void					clear()												noexcept;
+
+			/**
+			*	@brief Get the number of recorded commands waiting for execution.
+			*
+			*	@return The number of recorded commands waiting for execution.
+			*/
+			RFK_NODISCARD inline std::size_t	getCommandsCount()					const	noexcept;
+
+			/**
+			*	@brief Get the number of bytes used by recorded commands.
+			*
+			*	@return The number of bytes used by recorded commands.
+			*/
+			RFK_NODISCARD inline std::size_t	getUsedSize()						const	noexcept;
+
+			/**
+			*	@brief Get the size in bytes of the buffer.
+			*
+			*	@return The size in bytes of the buffer.
+			*/
+			RFK_NODISCARD inline std::size_t	getCapacity()						const	noexcept;
+
+			/**
+			*	@brief Get the size in bytes a command with the provided argument types takes in the buffer.
+			*
+			*	@tparam... ArgTypes Types of the arguments of the command.
+			*
+			*	@return The size in bytes of the command.
+			*/
+			template <typename... ArgTypes>
+			RFK_NODISCARD static constexpr std::size_t	getCommandSize()					noexcept;
+
+			inline InvocationCommandBuffer&	operator=(InvocationCommandBuffer&&)			noexcept;
+			InvocationCommandBuffer&		operator=(InvocationCommandBuffer const&)		= delete;
+	};
+
+	#include "Refureku/TypeInfo/Functions/InvocationCommandBuffer.inl"
+}
@@ -0,0 +1,290 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+constexpr std::size_t InvocationCommandBuffer::alignUp(std::size_t value, std::size_t alignment) noexcept
+{
+	return (value + alignment - 1u) & ~(alignment - 1u);
+}
+
+template <typename... ArgTypes>
+constexpr std::array<std::size_t, sizeof...(ArgTypes)> InvocationCommandBuffer::CommandLayout<ArgTypes...>::computeArgumentOffsets() noexcept
+{
+	std::array<std::size_t, sizeof...(ArgTypes)>	result{};
+	std::size_t const								sizes[]			= { sizeof(ArgTypes)..., 0u };
+	std::size_t const								alignments[]	= { alignof(ArgTypes)..., 1u };
+
+	//Arguments are stored right after the header and the arguments pointers array
+	std::size_t offset = sizeof(CommandHeader) + sizeof...(ArgTypes) * sizeof(void*);
+
+	for (std::size_t i = 0u; i < sizeof...(ArgTypes); i++)
+	{
+		result[i]	= alignUp(offset, alignments[i]);
+		offset		= result[i] + sizes[i];
+	}
+
+	return result;
+}
+
+template <typename... ArgTypes>
+constexpr std::size_t InvocationCommandBuffer::CommandLayout<ArgTypes...>::computeSize() noexcept
+{
+	std::size_t end = sizeof(CommandHeader);
+
+	if constexpr (sizeof...(ArgTypes) != 0u)
+	{
+		std::size_t const sizes[] = { sizeof(ArgTypes)... };
+
+		end = computeArgumentOffsets().back() + sizes[sizeof...(ArgTypes) - 1u];
+	}
+
+	return alignUp(end, alignof(std::max_align_t));
+}
+
+template <typename... ArgTypes>
+void InvocationCommandBuffer::CommandLayout<ArgTypes...>::destroyArguments(void* const* args) noexcept
+{
+	std::size_t index = 0u;
+
+	(static_cast<ArgTypes*>(args[index++])->~ArgTypes(), ...);
+}
+
+template <typename... ArgTypes>
+void InvocationCommandBuffer::CommandLayout<ArgTypes...>::destroyFirstArguments(void* const* args, std::size_t count) noexcept
+{
+	std::size_t index = 0u;
+
+	((index < count ? static_cast<ArgTypes*>(args[index])->~ArgTypes() : void(), index++), ...);
+}
+
+inline InvocationCommandBuffer::InvocationCommandBuffer(std::size_t capacity):
+	_storage{new std::max_align_t[(capacity + sizeof(std::max_align_t) - 1u) / sizeof(std::max_align_t)]},
+	_capacity{(capacity + sizeof(std::max_align_t) - 1u) / sizeof(std::max_align_t) * sizeof(std::max_align_t)}
+{
+}
+
+inline InvocationCommandBuffer::InvocationCommandBuffer(InvocationCommandBuffer&& other) noexcept:
+	_storage{std::move(other._storage)},
+	_capacity{other._capacity},
+	_writeOffset{other._writeOffset},
+	_readOffset{other._readOffset},
+	_commandsCount{other._commandsCount}
+{
+	other._capacity			= 0u;
+	other._writeOffset		= 0u;
+	other._readOffset		= 0u;
+	other._commandsCount	= 0u;
+}
+
+inline InvocationCommandBuffer::~InvocationCommandBuffer() noexcept
+{
+	clear();
+}
+
+inline unsigned char* InvocationCommandBuffer::getStorageBytes() const noexcept
+{
+	return reinterpret_cast<unsigned char*>(_storage.get());
+}
+
+template <typename... ArgTypes>
+bool InvocationCommandBuffer::recordCommand(ErasedCallThunk thunk, void* caller, ArgTypes&&... args)
+{
+	using Layout = CommandLayout<std::decay_t<ArgTypes>...>;
+
+	constexpr std::size_t commandSize = Layout::computeSize();
+
+	assert(thunk != nullptr);
+
+	if (_capacity - _writeOffset < commandSize)
+	{
+		return false;
+	}
+
+	unsigned char* command = getStorageBytes() + _writeOffset;
+
+	if constexpr (sizeof...(ArgTypes) != 0u)
+	{
+		constexpr std::array<std::size_t, sizeof...(ArgTypes)> argumentOffsets = Layout::computeArgumentOffsets();
+
+		void**		argumentPointers	= reinterpret_cast<void**>(command + sizeof(CommandHeader));
+		std::size_t	index				= 0u;
+
+		//Copy the arguments in place, in order
+		if constexpr ((std::is_nothrow_constructible_v<std::decay_t<ArgTypes>, ArgTypes&&> && ...))
+		{
+			((argumentPointers[index] = new (command + argumentOffsets[index]) std::decay_t<ArgTypes>(std::forward<ArgTypes>(args)), index++), ...);
+		}
+		else
+		{
+			try
+			{
+				((argumentPointers[index] = new (command + argumentOffsets[index]) std::decay_t<ArgTypes>(std::forward<ArgTypes>(args)), index++), ...);
+			}
+			catch (...)
+			{
+				//index is the number of arguments constructed before the throwing one
+				Layout::destroyFirstArguments(argumentPointers, index);
+				throw;
+			}
+		}
+	}
+
+	ArgumentsDestructor destructor = nullptr;
+
+	if constexpr (!(std::is_trivially_destructible_v<std::decay_t<ArgTypes>> && ...))
+	{
+		destructor = &Layout::destroyArguments;
+	}
+
+	new (command) CommandHeader{thunk, caller, destructor, commandSize};
+
+	_writeOffset += commandSize;
+	_commandsCount++;
+
+	return true;
+}
+
+template <typename... ArgTypes>
+bool InvocationCommandBuffer::matchParameterTypes(FunctionBase const& function) noexcept
+{
+	if (function.getParametersCount() != sizeof...(ArgTypes))
+	{
+		return false;
+	}
+
+	std::size_t index = 0u;
+
+	return (isDecayedParameterType<std::decay_t<ArgTypes>>(function.getParameterAt(index++).getType()) && ...);
+}
+
+template <typename ArgType>
+bool InvocationCommandBuffer::isDecayedParameterType(Type const& parameterType) noexcept
+{
+	return	parameterType == rfk::getType<ArgType>() ||
+			parameterType == rfk::getType<ArgType const&>() ||
+			parameterType == rfk::getType<ArgType&>() ||
+			parameterType == rfk::getType<ArgType&&>() ||
+			parameterType == rfk::getType<ArgType const&&>() ||
+			parameterType == rfk::getType<ArgType const>();
+}
+
+template <typename... ArgTypes>
+bool InvocationCommandBuffer::record(Function const& function, ArgTypes&&... args)
+{
+	assert(function.canInvokeErased());
+	assert(matchParameterTypes<ArgTypes...>(function));
+
+	return recordCommand(function.getErasedCallThunk(), nullptr, std::forward<ArgTypes>(args)...);
+}
+
+template <typename... ArgTypes>
+bool InvocationCommandBuffer::record(StaticMethod const& staticMethod, ArgTypes&&... args)
+{
+	assert(staticMethod.canInvokeErased());
+	assert(matchParameterTypes<ArgTypes...>(staticMethod));
+
+	return recordCommand(staticMethod.getErasedCallThunk(), nullptr, std::forward<ArgTypes>(args)...);
+}
+
+template <typename... ArgTypes>
+bool InvocationCommandBuffer::record(BoundMethod const& boundMethod, ArgTypes&&... args)
+{
+	assert(boundMethod.isBound());
+	assert(boundMethod.getMethod()->canInvokeErased());
+	assert(matchParameterTypes<ArgTypes...>(*boundMethod.getMethod()));
+
+	return recordCommand(boundMethod.getMethod()->getErasedCallThunk(), boundMethod.getCaller(), std::forward<ArgTypes>(args)...);
+}
+
+inline std::size_t InvocationCommandBuffer::destroyCommand(std::size_t offset) const noexcept
+{
+	unsigned char*			command	= getStorageBytes() + offset;
+	CommandHeader const*	header	= reinterpret_cast<CommandHeader const*>(command);
+
+	if (header->destroyArguments != nullptr)
+	{
+		header->destroyArguments(reinterpret_cast<void* const*>(command + sizeof(CommandHeader)));
+	}
+
+	return header->size;
+}
+
+inline std::size_t InvocationCommandBuffer::execute()
+{
+	std::size_t executedCount = 0u;
+
+	//_writeOffset is read at each iteration so that commands recorded by a called function are executed as well
+	while (_readOffset < _writeOffset)
+	{
+		unsigned char*			command	= getStorageBytes() + _readOffset;
+		CommandHeader const*	header	= reinterpret_cast<CommandHeader const*>(command);
+
+		header->thunk(header->caller, reinterpret_cast<void* const*>(command + sizeof(CommandHeader)), nullptr);
+
+		_readOffset += destroyCommand(_readOffset);
+		_commandsCount--;
+		executedCount++;
+	}
+
+	_readOffset		= 0u;
+	_writeOffset	= 0u;
+
+	return executedCount;
+}
+
+inline void InvocationCommandBuffer::clear() noexcept
+{
+	while (_readOffset < _writeOffset)
+	{
+		_readOffset += destroyCommand(_readOffset);
+	}
+
+	_readOffset		= 0u;
+	_writeOffset	= 0u;
+	_commandsCount	= 0u;
+}
+
+inline std::size_t InvocationCommandBuffer::getCommandsCount() const noexcept
+{
+	return _commandsCount;
+}
+
+inline std::size_t InvocationCommandBuffer::getUsedSize() const noexcept
+{
+	return _writeOffset - _readOffset;
+}
+
+inline std::size_t InvocationCommandBuffer::getCapacity() const noexcept
+{
+	return _capacity;
+}
+
+template <typename... ArgTypes>
+constexpr std::size_t InvocationCommandBuffer::getCommandSize() noexcept
+{
+	return CommandLayout<std::decay_t<ArgTypes>...>::computeSize();
+}
+
+inline InvocationCommandBuffer& InvocationCommandBuffer::operator=(InvocationCommandBuffer&& other) noexcept
+{
+	if (this != &other)
+	{
+		clear();
+
+		_storage		= std::move(other._storage);
+		_capacity		= other._capacity;
+		_writeOffset	= other._writeOffset;
+		_readOffset		= other._readOffset;
+		_commandsCount	= other._commandsCount;
+
+		other._capacity			= 0u;
+		other._writeOffset		= 0u;
+		other._readOffset		= 0u;
+		other._commandsCount	= 0u;
+	}
+
+	return *this;
+}
@@ -39,8 +39,8 @@ namespace rfk
 			bool	_isConst;
 
 		public:
-			MemberFunction(FunctionPrototype function)		noexcept;
-			MemberFunction(ConstFunctionPrototype function)	noexcept;
+			constexpr MemberFunction(FunctionPrototype function)		noexcept;
+			constexpr MemberFunction(ConstFunctionPrototype function)	noexcept;
 
 #if (defined(_WIN32) || defined(_WIN64))
 			std::size_t getOriginalFunctionSize() const noexcept;
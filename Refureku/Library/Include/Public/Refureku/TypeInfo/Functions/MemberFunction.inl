@@ -6,7 +6,7 @@
 */
 
 template <typename CallerType, typename ReturnType, typename... ArgTypes>
-MemberFunction<CallerType, ReturnType(ArgTypes...)>::MemberFunction(FunctionPrototype function) noexcept:
+constexpr MemberFunction<CallerType, ReturnType(ArgTypes...)>::MemberFunction(FunctionPrototype function) noexcept:
 #if (defined(_WIN32) || defined(_WIN64))
 	_originalFunctionSize{sizeof(FunctionPrototype)},
 #endif
@@ -15,7 +15,7 @@ MemberFunction<CallerType, ReturnType(ArgTypes...)>::MemberFunction(FunctionProt
 {}
 
 template <typename CallerType, typename ReturnType, typename... ArgTypes>
-MemberFunction<CallerType, ReturnType(ArgTypes...)>::MemberFunction(ConstFunctionPrototype function) noexcept:
+constexpr MemberFunction<CallerType, ReturnType(ArgTypes...)>::MemberFunction(ConstFunctionPrototype function) noexcept:
 #if (defined(_WIN32) || defined(_WIN64))
 	_originalFunctionSize{sizeof(ConstFunctionPrototype)},
 #endif
@@ -20,6 +20,9 @@
 
 namespace rfk
 {
+	//Forward declaration
+	class BoundMethod;
+
 	class Method final : public MethodBase
 	{
 		public:
@@ -29,6 +32,12 @@ namespace rfk
 										ICallable*		internalMethod,
 										EMethodFlags	flags,
 										Entity const*	outerEntity)	noexcept;
+			REFUREKU_INTERNAL Method(char const*		name,
+										std::size_t		id,
+										Type const&		returnType,
+										ICallable&		internalMethod,
+										EMethodFlags	flags,
+										Entity const*	outerEntity)	noexcept;
 			REFUREKU_INTERNAL Method(Method&&)							noexcept;
 			REFUREKU_INTERNAL ~Method()									noexcept;
 
@@ -203,6 +212,301 @@ namespace rfk
 			template <typename ReturnType = void, typename... ArgTypes>
 			ReturnType			checkedInvokeUnsafe(void const* caller, ArgTypes&&... args)	const;
 
+			/**
+			*	@brief	Non-throwing version of Method::invoke.
+			*			No exception is thrown by the reflection layer, so this method can be used from code compiled without exceptions.
+			*
+			*	@tparam ReturnType	Return type of the function.
+			*	@tparam CallerType	Type of the calling struct/class.
+			*	@tparam... ArgTypes	Type of all arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param caller	Object instance calling the method.
+			*	@param args		Arguments forwarded to the function call.
+			* 
+			*	@return	The result of the function call, or
+			*			EResultCode::ConstViolation if the caller is const but the method is non-const,
+			*			EResultCode::InvalidArchetype if the caller pointer couldn't be adjusted to the method's outer struct.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function.
+			*/
+			template <typename ReturnType = void, typename CallerType, typename... ArgTypes, typename = internal::IsAdjustableInstance<CallerType>>
+			Result<ReturnType>	tryInvoke(CallerType& caller, ArgTypes&&... args)						const;
+
+			/**
+			*	@brief	Non-throwing version of Method::invokeUnsafe.
+			*			This method DOES NOT perform any pointer adjustment on the provided caller.
+			*
+			*	@tparam ReturnType	Return type of the function.
+			*	@tparam... ArgTypes	Type of all arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param caller	Object instance calling the method.
+			*	@param args		Arguments forwarded to the function call.
+			* 
+			*	@return	The result of the function call. This overload never fails.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function.
+			*/
+			template <typename ReturnType = void, typename... ArgTypes>
+			Result<ReturnType>	tryInvokeUnsafe(void* caller, ArgTypes&&... args)						const;
+
+			/**
+			*	@brief	Non-throwing version of Method::invokeUnsafe.
+			*			This method DOES NOT perform any pointer adjustment on the provided caller.
+			*
+			*	@note This is only an overload of the same method with a const caller.
+			*
+			*	@tparam ReturnType	Return type of the function.
+			*	@tparam... ArgTypes	Type of all arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param caller	Object instance calling the method.
+			*	@param args		Arguments forwarded to the function call.
+			* 
+			*	@return	The result of the function call, or EResultCode::ConstViolation if the method is non-const.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function.
+			*/
+			template <typename ReturnType = void, typename... ArgTypes>
+			Result<ReturnType>	tryInvokeUnsafe(void const* caller, ArgTypes&&... args)					const;
+
+			/**
+			*	@brief	Non-throwing version of Method::checkedInvoke.
+			*			No exception is thrown by the reflection layer, so this method can be used from code compiled without exceptions.
+			*
+			*	@tparam ReturnType	Return type of the function.
+			*	@tparam CallerType	Type of the calling struct/class.
+			*	@tparam... ArgTypes	Type of all arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param caller	Object instance calling the method.
+			*	@param args		Arguments forwarded to the function call.
+			* 
+			*	@return	The result of the function call, or the EResultCode matching the exception Method::checkedInvoke would have thrown.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function.
+			*/
+			template <typename ReturnType = void, typename CallerType, typename... ArgTypes, typename = internal::IsAdjustableInstance<CallerType>>
+			Result<ReturnType>	tryCheckedInvoke(CallerType& caller, ArgTypes&&... args)				const;
+
+			/**
+			*	@brief	Non-throwing version of Method::checkedInvokeUnsafe.
+			*			This method DOES NOT perform any pointer adjustment on the provided caller.
+			*
+			*	@tparam ReturnType	Return type of the function.
+			*	@tparam... ArgTypes	Type of all arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param caller	Object instance calling the method.
+			*	@param args		Arguments forwarded to the function call.
+			* 
+			*	@return	The result of the function call, or EResultCode::ArgCountMismatch, EResultCode::ArgTypeMismatch or
+			*			EResultCode::ReturnTypeMismatch if the provided signature doesn't match.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function.
+			*/
+			template <typename ReturnType = void, typename... ArgTypes>
+			Result<ReturnType>	tryCheckedInvokeUnsafe(void* caller, ArgTypes&&... args)				const;
+
+			/**
+			*	@brief	Non-throwing version of Method::checkedInvokeUnsafe.
+			*			This method DOES NOT perform any pointer adjustment on the provided caller.
+			*
+			*	@note This is only an overload of the same method with a const caller.
+			*
+			*	@tparam ReturnType	Return type of the function.
+			*	@tparam... ArgTypes	Type of all arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param caller	Object instance calling the method.
+			*	@param args		Arguments forwarded to the function call.
+			* 
+			*	@return	The result of the function call, or EResultCode::ConstViolation if the method is non-const,
+			*			or EResultCode::ArgCountMismatch, EResultCode::ArgTypeMismatch or EResultCode::ReturnTypeMismatch
+			*			if the provided signature doesn't match.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function.
+			*/
+			template <typename ReturnType = void, typename... ArgTypes>
+			Result<ReturnType>	tryCheckedInvokeUnsafe(void const* caller, ArgTypes&&... args)			const;
+
+			/**
+			*	@brief	Call the method on each instance of a contiguous array of callers with the same arguments.
+			*			The caller pointer adjustment and the call target are resolved once for the whole batch since all
+			*			the elements of an array share the same dynamic type.
+			*			Arguments are copied for each call (reference parameters are passed as is), so rvalue reference
+			*			parameters receive the same object for every call.
+			*			Return values, if any, are discarded.
+			*			Providing bad return type / parameters is undefined behaviour.
+			*
+			*	@tparam ReturnType	Return type of the function.
+			*	@tparam CallerType	Type of the calling struct/class.
+			*	@tparam... ArgTypes	Type of all arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param callers		Pointer to the first element of the callers array.
+			*	@param callersCount	Number of elements in the callers array.
+			*	@param args			Arguments forwarded to each function call.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function. The remaining calls are not performed.
+			*	@exception ConstViolation if the callers are const but the method is non-const.
+			*/
+			template <typename ReturnType = void, typename CallerType, typename... ArgTypes, typename = internal::IsAdjustableInstance<CallerType>>
+			void				invokeBatch(CallerType*		callers,
+											std::size_t		callersCount,
+											ArgTypes&&...	args)										const;
+
+			/**
+			*	@brief	Call the method on each instance of a strided range of callers with the same arguments.
+			*			This method DOES NOT perform any pointer adjustment on the provided callers so it has an undefined behaviour if
+			*			any caller is not a valid pointer to an object of the method's owner archetype.
+			*			Arguments are copied for each call (reference parameters are passed as is).
+			*			Return values, if any, are discarded.
+			*			Providing bad return type / parameters is undefined behaviour.
+			*
+			*	@tparam ReturnType	Return type of the function.
+			*	@tparam... ArgTypes	Type of all arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param firstCaller	Pointer to the first caller of the range.
+			*	@param callersCount	Number of callers in the range.
+			*	@param stride		Distance in bytes between 2 consecutive callers.
+			*	@param args			Arguments forwarded to each function call.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function. The remaining calls are not performed.
+			*/
+			template <typename ReturnType = void, typename... ArgTypes>
+			void				invokeBatchUnsafe(void*			firstCaller,
+												  std::size_t	callersCount,
+												  std::size_t	stride,
+												  ArgTypes&&...	args)									const;
+
+			/**
+			*	@brief	Call the method on each instance of a strided range of callers with the same arguments.
+			*			This method DOES NOT perform any pointer adjustment on the provided callers so it has an undefined behaviour if
+			*			any caller is not a valid pointer to an object of the method's owner archetype.
+			*			Arguments are copied for each call (reference parameters are passed as is).
+			*			Return values, if any, are discarded.
+			*			Providing bad return type / parameters is undefined behaviour.
+			*
+			*	@note This is only an overload of the same method with const callers.
+			*
+			*	@tparam ReturnType	Return type of the function.
+			*	@tparam... ArgTypes	Type of all arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param firstCaller	Pointer to the first caller of the range.
+			*	@param callersCount	Number of callers in the range.
+			*	@param stride		Distance in bytes between 2 consecutive callers.
+			*	@param args			Arguments forwarded to each function call.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function. The remaining calls are not performed.
+			*	@exception ConstViolation if the method is non-const.
+			*/
+			template <typename ReturnType = void, typename... ArgTypes>
+			void				invokeBatchUnsafe(void const*	firstCaller,
+												  std::size_t	callersCount,
+												  std::size_t	stride,
+												  ArgTypes&&...	args)									const;
+
+			/**
+			*	@brief	Same as Method::invokeBatch, but the return type and arguments types are strictly checked once before the first call.
+			*			**WARNING**: Unreflected archetypes can't be compared, so they will pass through the type checks.
+			*
+			*	@tparam ReturnType	Return type of the function.
+			*	@tparam CallerType	Type of the calling struct/class.
+			*	@tparam... ArgTypes	Type of all arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param callers		Pointer to the first element of the callers array.
+			*	@param callersCount	Number of elements in the callers array.
+			*	@param args			Arguments forwarded to each function call.
+			* 
+			*	@exception	ArgCountMismatch	if sizeof...(ArgTypes) is not the same as the value returned by getParametersCount().
+			*	@exception	ArgTypeMismatch		if ArgTypes... are not strictly the same as this function parameter types.
+			*	@exception	ReturnTypeMismatch	if ReturnType is not strictly the same as this function return type.
+			*	@exception	ConstViolation		if the callers are const but the method is non-const.
+			*	@exception	Any exception potentially thrown from the underlying function. The remaining calls are not performed.
+			*/
+			template <typename ReturnType = void, typename CallerType, typename... ArgTypes, typename = internal::IsAdjustableInstance<CallerType>>
+			void				checkedInvokeBatch(CallerType*		callers,
+												   std::size_t		callersCount,
+												   ArgTypes&&...	args)									const;
+
+			/**
+			*	@brief	Same as Method::invokeBatch, but the callers array is split in chunks dispatched through the provided executor.
+			*			The executor is called once as executor(std::size_t jobsCount, Job const& job), and must call job(jobIndex)
+			*			exactly once for each jobIndex in [0, jobsCount[ (in any order, from any thread) before returning.
+			*			Arguments are shared by all jobs and copied for each call, so they must be safe to read concurrently.
+			*
+			*	@tparam ReturnType	Return type of the function.
+			*	@tparam Executor	Type of the executor.
+			*	@tparam CallerType	Type of the calling struct/class.
+			*	@tparam... ArgTypes	Type of all arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param executor		Executor running the jobs.
+			*	@param chunkSize	Maximum number of callers processed by a single job. 0 is treated as 1.
+			*	@param callers		Pointer to the first element of the callers array.
+			*	@param callersCount	Number of elements in the callers array.
+			*	@param args			Arguments forwarded to each function call.
+			* 
+			*	@exception Any exception potentially thrown from the executor.
+			*	@exception ConstViolation if the callers are const but the method is non-const.
+			*/
+			template <typename ReturnType = void, typename Executor, typename CallerType, typename... ArgTypes, typename = internal::IsAdjustableInstance<CallerType>>
+			void				invokeBatchParallel(Executor&&		executor,
+													std::size_t		chunkSize,
+													CallerType*		callers,
+													std::size_t		callersCount,
+													ArgTypes&&...	args)								const;
+
+			/**
+			*	@brief	Call the method with type-erased arguments.
+			*			The arguments count and types are not checked: providing bad arguments is undefined behaviour.
+			*			Calling this method on a method that can't be invoked erased (see canInvokeErased) is undefined behaviour.
+			*
+			*	@tparam CallerType Type of the calling struct/class.
+			*
+			*	@param caller		Object instance calling the method. The pointer is adjusted the same way Method::invoke does.
+			*	@param args			Array of pointers to the arguments, one per parameter. See rfk::ErasedCallThunk.
+			*	@param returnValue	Pointer to uninitialized storage for the return value, or nullptr to discard it. See rfk::ErasedCallThunk.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function.
+			*	@exception ConstViolation if the caller is const but the method is non-const.
+			*/
+			template <typename CallerType, typename = internal::IsAdjustableInstance<CallerType>>
+			void				invokeErased(CallerType&	caller,
+											 void* const*	args,
+											 void*			returnValue = nullptr)					const;
+
+			/**
+			*	@brief	Call the method with type-erased arguments.
+			*			The arguments count and types are not checked: providing bad arguments is undefined behaviour.
+			*			This method DOES NOT perform any pointer adjustment on the provided caller so it has an undefined behaviour if caller
+			*			is not a valid pointer to an object of the method's owner archetype.
+			*			Calling this method on a method that can't be invoked erased (see canInvokeErased) is undefined behaviour.
+			*
+			*	@param caller		Object instance calling the method.
+			*	@param args			Array of pointers to the arguments, one per parameter. See rfk::ErasedCallThunk.
+			*	@param returnValue	Pointer to uninitialized storage for the return value, or nullptr to discard it. See rfk::ErasedCallThunk.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function.
+			*/
+			REFUREKU_API void	invokeErasedUnsafe(void*		caller,
+												   void* const*	args,
+												   void*		returnValue = nullptr)				const;
+
+			/**
+			*	@brief	Call the method with type-erased arguments.
+			*			The arguments count and types are not checked: providing bad arguments is undefined behaviour.
+			*			This method DOES NOT perform any pointer adjustment on the provided caller so it has an undefined behaviour if caller
+			*			is not a valid pointer to an object of the method's owner archetype.
+			*			Calling this method on a method that can't be invoked erased (see canInvokeErased) is undefined behaviour.
+			*
+			*	@note This is only an overload of the same method with a const caller.
+			*
+			*	@param caller		Object instance calling the method.
+			*	@param args			Array of pointers to the arguments, one per parameter. See rfk::ErasedCallThunk.
+			*	@param returnValue	Pointer to uninitialized storage for the return value, or nullptr to discard it. See rfk::ErasedCallThunk.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function.
+			*	@exception ConstViolation if the method is non-const.
+			*/
+			REFUREKU_API void	invokeErasedUnsafe(void const*	caller,
+												   void* const*	args,
+												   void*		returnValue = nullptr)				const;
+
 			/**
 			*	@brief	Inherit from the properties this method overrides.
 			*			If the method is not an override, this method does nothing.
@@ -213,6 +517,11 @@ namespace rfk
 			//Forward declaration
 			class MethodImpl;
 
+			friend BoundMethod;
+
+			template <typename FunctionPrototype>
+			friend class PreparedCall;
+
 			template <typename FunctionPrototype>
 			class MemberFunctionSafeCallWrapper;
 
@@ -262,6 +571,24 @@ namespace rfk
 			ReturnType						internalInvoke(void const*	 caller,
 														   ArgTypes&&... args)									const;
 
+			/**
+			*	@brief Call the underlying method on each caller of a strided range, copying the args for each call.
+			* 
+			*	@tparam ReturnType	Return type of the method.
+			*	@tparam... ArgTypes	Type of all arguments.
+			*	@tparam T			void or void const.
+			*
+			*	@param firstCaller	Pointer to the first caller of the range.
+			*	@param callersCount	Number of callers in the range.
+			*	@param stride		Distance in bytes between 2 consecutive callers.
+			*	@param args			Arguments copied to each underlying method call.
+			*/
+			template <typename ReturnType, typename... ArgTypes, typename T>
+			void							internalInvokeBatch(T*				firstCaller,
+																std::size_t		callersCount,
+																std::size_t		stride,
+																ArgTypes&...	args)								const;
+
 			/**
 			*	@brief Adjust the caller pointer to a pointer to this method's outer struct.
 			* 
@@ -276,6 +603,18 @@ namespace rfk
 			template <typename CallerType>
 			RFK_NODISCARD CallerType*		adjustCallerPointerAddress(CallerType* caller)						const;
 
+			/**
+			*	@brief Non-throwing version of adjustCallerPointerAddress.
+			* 
+			*	@tparam CallerType The static type of the provided caller.
+			* 
+			*	@param caller The caller pointer to adjust.
+			* 
+			*	@return The adjusted caller pointer, or nullptr if the caller dynamic archetype couldn't be casted to the method outer struct's archetype.
+			*/
+			template <typename CallerType>
+			RFK_NODISCARD CallerType*		tryAdjustCallerPointerAddress(CallerType* caller)			const	noexcept;
+
 			/**
 			*	@brief Throw a ConstViolation exception with the provided message.
 			* 
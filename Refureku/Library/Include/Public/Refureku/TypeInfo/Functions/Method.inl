@@ -120,16 +120,178 @@ ReturnType Method::checkedInvokeUnsafe(void const* caller, ArgTypes&&... args) c
 	return internalInvoke<ReturnType, ArgTypes...>(caller, std::forward<ArgTypes>(args)...);
 }
 
-template <typename CallerType>
-CallerType* Method::adjustCallerPointerAddress(CallerType* caller) const
+template <typename ReturnType, typename CallerType, typename... ArgTypes, typename>
+Result<ReturnType> Method::tryInvoke(CallerType& caller, ArgTypes&&... args) const
 {
-	//Non-virtual methods can be called with non-adjusted instances (doesn't use virtual table)
-	if (!isVirtual())
+	CallerType* adjustedCaller = tryAdjustCallerPointerAddress(&caller);
+
+	if (adjustedCaller == nullptr)
 	{
-		return caller;
+		return Result<ReturnType>::makeFailure(EResultCode::InvalidArchetype);
+	}
+
+	return tryInvokeUnsafe<ReturnType, ArgTypes...>(adjustedCaller, std::forward<ArgTypes>(args)...);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+Result<ReturnType> Method::tryInvokeUnsafe(void* caller, ArgTypes&&... args) const
+{
+	return internal::makeSuccessfulResult<ReturnType>([&]() -> ReturnType { return internalInvoke<ReturnType, ArgTypes...>(caller, std::forward<ArgTypes>(args)...); });
+}
+
+template <typename ReturnType, typename... ArgTypes>
+Result<ReturnType> Method::tryInvokeUnsafe(void const* caller, ArgTypes&&... args) const
+{
+	if (!isConst())
+	{
+		return Result<ReturnType>::makeFailure(EResultCode::ConstViolation);
+	}
+
+	return internal::makeSuccessfulResult<ReturnType>([&]() -> ReturnType { return internalInvoke<ReturnType, ArgTypes...>(caller, std::forward<ArgTypes>(args)...); });
+}
+
+template <typename ReturnType, typename CallerType, typename... ArgTypes, typename>
+Result<ReturnType> Method::tryCheckedInvoke(CallerType& caller, ArgTypes&&... args) const
+{
+	CallerType* adjustedCaller = tryAdjustCallerPointerAddress(&caller);
+
+	if (adjustedCaller == nullptr)
+	{
+		return Result<ReturnType>::makeFailure(EResultCode::InvalidArchetype);
+	}
+
+	return tryCheckedInvokeUnsafe<ReturnType, ArgTypes...>(adjustedCaller, std::forward<ArgTypes>(args)...);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+Result<ReturnType> Method::tryCheckedInvokeUnsafe(void* caller, ArgTypes&&... args) const
+{
+	EResultCode code = matchSignature<ReturnType, ArgTypes...>();
+
+	if (code != EResultCode::Success)
+	{
+		return Result<ReturnType>::makeFailure(code);
+	}
+
+	return internal::makeSuccessfulResult<ReturnType>([&]() -> ReturnType { return internalInvoke<ReturnType, ArgTypes...>(caller, std::forward<ArgTypes>(args)...); });
+}
+
+template <typename ReturnType, typename... ArgTypes>
+Result<ReturnType> Method::tryCheckedInvokeUnsafe(void const* caller, ArgTypes&&... args) const
+{
+	if (!isConst())
+	{
+		return Result<ReturnType>::makeFailure(EResultCode::ConstViolation);
+	}
+
+	EResultCode code = matchSignature<ReturnType, ArgTypes...>();
+
+	if (code != EResultCode::Success)
+	{
+		return Result<ReturnType>::makeFailure(code);
+	}
+
+	return internal::makeSuccessfulResult<ReturnType>([&]() -> ReturnType { return internalInvoke<ReturnType, ArgTypes...>(caller, std::forward<ArgTypes>(args)...); });
+}
+
+template <typename CallerType, typename>
+void Method::invokeErased(CallerType& caller, void* const* args, void* returnValue) const
+{
+	invokeErasedUnsafe(adjustCallerPointerAddress(&caller), args, returnValue);
+}
+
+template <typename ReturnType, typename... ArgTypes, typename T>
+void Method::internalInvokeBatch(T* firstCaller, std::size_t callersCount, std::size_t stride, ArgTypes&... args) const
+{
+	//Resolve the call target once for the whole batch
+	ICallable const&	internalFunction	= *getInternalFunction();
+	auto				caller				= reinterpret_cast<typename CopyConstness<T, char>::Type*>(firstCaller);
+
+	for (std::size_t i = 0u; i < callersCount; i++, caller += stride)
+	{
+		MemberFunctionSafeCallWrapper<ReturnType(ArgTypes...)>::invoke(internalFunction, static_cast<T*>(caller), static_cast<ArgTypes>(args)...);
+	}
+}
+
+template <typename ReturnType, typename CallerType, typename... ArgTypes, typename>
+void Method::invokeBatch(CallerType* callers, std::size_t callersCount, ArgTypes&&... args) const
+{
+	if (callersCount == 0u)
+	{
+		return;
 	}
 
-	CallerType* adjustedCallerPointer = rfk::dynamicCast<CallerType>(caller, CallerType::staticGetArchetype(), caller->getArchetype(), *static_cast<rfk::Struct const*>(getOuterEntity()));
+	//All elements of an array share the same dynamic type, so the first adjusted pointer is enough to adjust the whole batch
+	invokeBatchUnsafe<ReturnType, ArgTypes...>(adjustCallerPointerAddress(callers), callersCount, sizeof(CallerType), std::forward<ArgTypes>(args)...);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+void Method::invokeBatchUnsafe(void* firstCaller, std::size_t callersCount, std::size_t stride, ArgTypes&&... args) const
+{
+	internalInvokeBatch<ReturnType, ArgTypes...>(firstCaller, callersCount, stride, args...);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+void Method::invokeBatchUnsafe(void const* firstCaller, std::size_t callersCount, std::size_t stride, ArgTypes&&... args) const
+{
+	if (!isConst())
+	{
+		throwConstViolationException();
+	}
+
+	internalInvokeBatch<ReturnType, ArgTypes...>(firstCaller, callersCount, stride, args...);
+}
+
+template <typename ReturnType, typename CallerType, typename... ArgTypes, typename>
+void Method::checkedInvokeBatch(CallerType* callers, std::size_t callersCount, ArgTypes&&... args) const
+{
+	checkReturnType<ReturnType>();
+	checkParameterTypes<ArgTypes...>();
+
+	invokeBatch<ReturnType, CallerType, ArgTypes...>(callers, callersCount, std::forward<ArgTypes>(args)...);
+}
+
+template <typename ReturnType, typename Executor, typename CallerType, typename... ArgTypes, typename>
+void Method::invokeBatchParallel(Executor&& executor, std::size_t chunkSize, CallerType* callers, std::size_t callersCount, ArgTypes&&... args) const
+{
+	if (callersCount == 0u)
+	{
+		return;
+	}
+
+	if constexpr (std::is_const_v<CallerType>)
+	{
+		if (!isConst())
+		{
+			throwConstViolationException();
+		}
+	}
+
+	if (chunkSize == 0u)
+	{
+		chunkSize = 1u;
+	}
+
+	//Resolve the adjusted address of the first caller only once, every job starts from it
+	auto		firstCaller = reinterpret_cast<typename CopyConstness<CallerType, char>::Type*>(adjustCallerPointerAddress(callers));
+	std::size_t	jobsCount	= (callersCount + chunkSize - 1u) / chunkSize;
+
+	auto job = [&](std::size_t jobIndex)
+	{
+		std::size_t begin	= jobIndex * chunkSize;
+		std::size_t count	= (callersCount - begin < chunkSize) ? callersCount - begin : chunkSize;
+
+		internalInvokeBatch<ReturnType, ArgTypes...>(static_cast<typename CopyConstness<CallerType, void>::Type*>(firstCaller + begin * sizeof(CallerType)),
+													 count, sizeof(CallerType), args...);
+	};
+
+	std::forward<Executor>(executor)(jobsCount, static_cast<decltype(job) const&>(job));
+}
+
+template <typename CallerType>
+CallerType* Method::adjustCallerPointerAddress(CallerType* caller) const
+{
+	CallerType* adjustedCallerPointer = tryAdjustCallerPointerAddress(caller);
 
 	if (adjustedCallerPointer != nullptr)
 	{
@@ -139,4 +301,16 @@ CallerType* Method::adjustCallerPointerAddress(CallerType* caller) const
 	{
 		throw InvalidArchetype("Failed to adjust the caller pointer since it has no relationship with the method's outer struct.");
 	}
+}
+
+template <typename CallerType>
+CallerType* Method::tryAdjustCallerPointerAddress(CallerType* caller) const noexcept
+{
+	//Non-virtual methods can be called with non-adjusted instances (doesn't use virtual table)
+	if (!isVirtual())
+	{
+		return caller;
+	}
+
+	return rfk::dynamicCast<CallerType>(caller, CallerType::staticGetArchetype(), caller->getArchetype(), *static_cast<rfk::Struct const*>(getOuterEntity()));
 }
\ No newline at end of file
@@ -0,0 +1,156 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>		//std::size_t
+#include <utility>		//std::forward
+#include <type_traits>
+
+#include "Refureku/TypeInfo/Functions/ENativeValueClass.h"
+#include "Refureku/TypeInfo/Functions/ENativeCallingConvention.h"
+
+namespace rfk
+{
+	/** Type-erased native function address. It must be cast back to the exact function pointer type before being called. */
+	using NativeFunctionPtr = void (*)();
+
+	/** ABI-level description of a parameter or return value. */
+	struct NativeValueInfo
+	{
+		/** Size in bytes of the value (sizeof a pointer for pointers and references, 0 for void). */
+		std::size_t			size;
+
+		/** Alignment in bytes of the value (alignof a pointer for pointers and references, 0 for void). */
+		std::size_t			alignment;
+
+		/** Class of the value. */
+		ENativeValueClass	valueClass;
+	};
+
+	/**
+	*	@brief	Native entry point of a reflected function, to emit direct calls from JIT or FFI code.
+	*			For non-member functions and static methods, address is the function itself.
+	*			For methods, address is a generated non-member trampoline taking a pointer to the instance as first parameter
+	*			(followed by the method parameters). The instance pointer is not adjusted, so it must point to an object of the
+	*			method's outer struct.
+	*/
+	struct NativeEntryPoint
+	{
+		/** Native address to call. */
+		NativeFunctionPtr			address;
+
+		/**
+		*	Calling convention to use when calling address.
+		*	Entry points are always non-member functions (methods go through a trampoline),
+		*	so it is the default C calling convention of the target platform.
+		*/
+		ENativeCallingConvention	callingConvention;
+
+		/** Description of the returned value. */
+		NativeValueInfo				returnValue;
+
+		/** Description of the parameters, including the instance pointer for methods. */
+		NativeValueInfo const*		parameters;
+
+		/** Number of elements in parameters. */
+		std::size_t					parametersCount;
+
+		/** true if address is a trampoline forwarding the call to a method, else false. */
+		bool						isMethodTrampoline;
+	};
+
+	namespace internal
+	{
+		/**
+		*	@brief Compute the ABI-level description of T.
+		* 
+		*	@tparam T Type of the parameter or return value.
+		* 
+		*	@return The description of T.
+		*/
+		template <typename T>
+		constexpr NativeValueInfo makeNativeValueInfo() noexcept;
+
+		/**
+		*	@brief Get the default C calling convention of the target platform.
+		* 
+		*	@return The default C calling convention of the target platform.
+		*/
+		constexpr ENativeCallingConvention getNativeCallingConvention() noexcept;
+
+		/** Base declaration of the helper. FunctionPtr is the address of the reflected function. */
+		template <auto FunctionPtr, typename FunctionPtrType = decltype(FunctionPtr)>
+		class NativeEntryPointHelper;
+
+		/** Overload for non-member functions. */
+		template <auto FunctionPtr, typename ReturnType, typename... ArgTypes>
+		class NativeEntryPointHelper<FunctionPtr, ReturnType(*)(ArgTypes...)>
+		{
+			private:
+				static constexpr std::array<NativeValueInfo, sizeof...(ArgTypes)> _parameters{ makeNativeValueInfo<ArgTypes>()... };
+
+			public:
+				/**
+				*	@return The native entry point of the function.
+				*/
+				static NativeEntryPoint const& get() noexcept;
+		};
+
+		/** Overload for noexcept non-member functions. */
+		template <auto FunctionPtr, typename ReturnType, typename... ArgTypes>
+		class NativeEntryPointHelper<FunctionPtr, ReturnType(*)(ArgTypes...) noexcept> : public NativeEntryPointHelper<FunctionPtr, ReturnType(*)(ArgTypes...)>
+		{
+		};
+
+		/** Common implementation for all method overloads. CallerType is const for const methods. */
+		template <auto FunctionPtr, typename CallerType, typename ReturnType, typename... ArgTypes>
+		class NativeMethodEntryPointHelper
+		{
+			private:
+				static constexpr std::array<NativeValueInfo, sizeof...(ArgTypes) + 1u> _parameters{ makeNativeValueInfo<CallerType*>(), makeNativeValueInfo<ArgTypes>()... };
+
+				/**
+				*	@brief Non-member trampoline forwarding the call to the method.
+				*/
+				static ReturnType trampoline(CallerType* caller, ArgTypes... args);
+
+			public:
+				/**
+				*	@return The native entry point of the method.
+				*/
+				static NativeEntryPoint const& get() noexcept;
+		};
+
+		/** Overload for methods. */
+		template <auto FunctionPtr, typename CallerType, typename ReturnType, typename... ArgTypes>
+		class NativeEntryPointHelper<FunctionPtr, ReturnType(CallerType::*)(ArgTypes...)> : public NativeMethodEntryPointHelper<FunctionPtr, CallerType, ReturnType, ArgTypes...>
+		{
+		};
+
+		/** Overload for noexcept methods. */
+		template <auto FunctionPtr, typename CallerType, typename ReturnType, typename... ArgTypes>
+		class NativeEntryPointHelper<FunctionPtr, ReturnType(CallerType::*)(ArgTypes...) noexcept> : public NativeMethodEntryPointHelper<FunctionPtr, CallerType, ReturnType, ArgTypes...>
+		{
+		};
+
+		/** Overload for const methods. */
+		template <auto FunctionPtr, typename CallerType, typename ReturnType, typename... ArgTypes>
+		class NativeEntryPointHelper<FunctionPtr, ReturnType(CallerType::*)(ArgTypes...) const> : public NativeMethodEntryPointHelper<FunctionPtr, CallerType const, ReturnType, ArgTypes...>
+		{
+		};
+
+		/** Overload for const noexcept methods. */
+		template <auto FunctionPtr, typename CallerType, typename ReturnType, typename... ArgTypes>
+		class NativeEntryPointHelper<FunctionPtr, ReturnType(CallerType::*)(ArgTypes...) const noexcept> : public NativeMethodEntryPointHelper<FunctionPtr, CallerType const, ReturnType, ArgTypes...>
+		{
+		};
+
+		#include "Refureku/TypeInfo/Functions/NativeEntryPoint.inl"
+	}
+}
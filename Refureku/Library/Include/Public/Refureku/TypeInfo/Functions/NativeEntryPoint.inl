@@ -0,0 +1,82 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename T>
+constexpr NativeValueInfo makeNativeValueInfo() noexcept
+{
+	using RawType = std::remove_cv_t<T>;
+
+	if constexpr (std::is_void_v<RawType>)
+	{
+		return NativeValueInfo{ 0u, 0u, ENativeValueClass::Void };
+	}
+	else if constexpr (std::is_reference_v<RawType> || std::is_pointer_v<RawType> || std::is_null_pointer_v<RawType>)
+	{
+		return NativeValueInfo{ sizeof(void*), alignof(void*), ENativeValueClass::Pointer };
+	}
+	else if constexpr (std::is_integral_v<RawType> || std::is_enum_v<RawType>)
+	{
+		return NativeValueInfo{ sizeof(RawType), alignof(RawType), ENativeValueClass::Integral };
+	}
+	else if constexpr (std::is_floating_point_v<RawType>)
+	{
+		return NativeValueInfo{ sizeof(RawType), alignof(RawType), ENativeValueClass::FloatingPoint };
+	}
+	else if constexpr (std::is_trivially_copyable_v<RawType> && std::is_trivially_destructible_v<RawType>)
+	{
+		return NativeValueInfo{ sizeof(RawType), alignof(RawType), ENativeValueClass::Aggregate };
+	}
+	else
+	{
+		return NativeValueInfo{ sizeof(RawType), alignof(RawType), ENativeValueClass::NonTrivialAggregate };
+	}
+}
+
+constexpr ENativeCallingConvention getNativeCallingConvention() noexcept
+{
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__x86_64__)
+	#if defined(_WIN32)
+		return ENativeCallingConvention::Win64;
+	#else
+		return ENativeCallingConvention::SystemV;
+	#endif
+#elif defined(_M_IX86) || defined(__i386__)
+	return ENativeCallingConvention::Cdecl;
+#elif defined(_M_ARM64) || defined(__aarch64__)
+	return ENativeCallingConvention::Aapcs64;
+#elif defined(_M_ARM) || defined(__arm__)
+	return ENativeCallingConvention::Aapcs;
+#else
+	return ENativeCallingConvention::Unknown;
+#endif
+}
+
+////////////////// Non-member functions
+
+template <auto FunctionPtr, typename ReturnType, typename... ArgTypes>
+NativeEntryPoint const& NativeEntryPointHelper<FunctionPtr, ReturnType(*)(ArgTypes...)>::get() noexcept
+{
+	static NativeEntryPoint const entryPoint{ reinterpret_cast<NativeFunctionPtr>(FunctionPtr), getNativeCallingConvention(), makeNativeValueInfo<ReturnType>(), _parameters.data(), _parameters.size(), false };
+
+	return entryPoint;
+}
+
+////////////////// Methods
+
+template <auto FunctionPtr, typename CallerType, typename ReturnType, typename... ArgTypes>
+ReturnType NativeMethodEntryPointHelper<FunctionPtr, CallerType, ReturnType, ArgTypes...>::trampoline(CallerType* caller, ArgTypes... args)
+{
+	return (caller->*FunctionPtr)(std::forward<ArgTypes>(args)...);
+}
+
+template <auto FunctionPtr, typename CallerType, typename ReturnType, typename... ArgTypes>
+NativeEntryPoint const& NativeMethodEntryPointHelper<FunctionPtr, CallerType, ReturnType, ArgTypes...>::get() noexcept
+{
+	static NativeEntryPoint const entryPoint{ reinterpret_cast<NativeFunctionPtr>(&trampoline), getNativeCallingConvention(), makeNativeValueInfo<ReturnType>(), _parameters.data(), _parameters.size(), true };
+
+	return entryPoint;
+}
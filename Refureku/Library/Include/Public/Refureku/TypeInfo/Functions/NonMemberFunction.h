@@ -27,9 +27,9 @@ namespace rfk
 
 		public:
 			template <typename Functor>
-			NonMemberFunction(Functor f)					noexcept;
+			constexpr NonMemberFunction(Functor f)					noexcept;
 
-			NonMemberFunction(FunctionPrototype function)	noexcept;
+			constexpr NonMemberFunction(FunctionPrototype function)	noexcept;
 
 			/**
 			*	@brief Get a pointer to the underlying function.
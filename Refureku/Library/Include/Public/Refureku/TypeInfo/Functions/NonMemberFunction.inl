@@ -7,13 +7,13 @@
 
 template <typename ReturnType, typename... ArgTypes>
 template <typename Functor>
-NonMemberFunction<ReturnType(ArgTypes...)>::NonMemberFunction(Functor f) noexcept:
+constexpr NonMemberFunction<ReturnType(ArgTypes...)>::NonMemberFunction(Functor f) noexcept:
 	_function{static_cast<FunctionPrototype>(f)}
 {
 }
 
 template <typename ReturnType, typename... ArgTypes>
-NonMemberFunction<ReturnType(ArgTypes...)>::NonMemberFunction(FunctionPrototype function) noexcept:
+constexpr NonMemberFunction<ReturnType(ArgTypes...)>::NonMemberFunction(FunctionPrototype function) noexcept:
 	_function{function}
 {
 }
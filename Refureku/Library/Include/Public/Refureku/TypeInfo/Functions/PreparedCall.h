@@ -0,0 +1,123 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cassert>
+
+#include "Refureku/TypeInfo/Functions/FunctionBase.h"
+#include "Refureku/TypeInfo/Functions/Function.h"
+#include "Refureku/TypeInfo/Functions/Method.h"
+#include "Refureku/TypeInfo/Functions/StaticMethod.h"
+#include "Refureku/Misc/Result.h"
+
+namespace rfk
+{
+	template <typename FunctionPrototype>
+	class PreparedCall;
+
+	/**
+	*	@brief	Handle to a function whose signature was checked once by FunctionBase::prepare.
+	*			Calling the handle doesn't perform any type check nor metadata lookup.
+	*			PreparedCalls are trivially copyable, so they can be cached (by function id for example) and reused
+	*			as long as the function they were prepared from is alive.
+	*/
+	template <typename ReturnType, typename... ArgTypes>
+	class PreparedCall<ReturnType(ArgTypes...)>
+	{
+		private:
+			/** Function the call was prepared from. */
+			FunctionBase const*	_function			= nullptr;
+
+			/** Cached internal function of the prepared function. */
+			ICallable const*	_internalFunction	= nullptr;
+
+			explicit PreparedCall(FunctionBase const& function)	noexcept;
+
+			friend FunctionBase;
+
+		public:
+			PreparedCall()										= default;
+			PreparedCall(PreparedCall const&)					= default;
+			PreparedCall(PreparedCall&&)						= default;
+
+			/**
+			*	@brief	Call the prepared function or static method.
+			*			Calling this operator on a handle prepared from a Method or on an invalid handle is undefined behaviour.
+			* 
+			*	@param args Arguments forwarded to the function call.
+			* 
+			*	@return The result of the function call.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function.
+			*/
+			ReturnType	operator()(ArgTypes... args)								const;
+
+			/**
+			*	@brief	Call the prepared method.
+			*			Calling this method on a handle that wasn't prepared from a Method or on an invalid handle is undefined behaviour.
+			* 
+			*	@tparam CallerType Type of the calling struct/class.
+			* 
+			*	@param caller	Object instance calling the method. The pointer is adjusted the same way Method::invoke does.
+			*	@param args		Arguments forwarded to the method call.
+			* 
+			*	@return The result of the method call.
+			* 
+			*	@exception Any exception potentially thrown from the underlying method.
+			*	@exception ConstViolation if the caller is const but the method is non-const.
+			*/
+			template <typename CallerType, typename = internal::IsAdjustableInstance<CallerType>>
+			ReturnType	invoke(CallerType& caller, ArgTypes... args)				const;
+
+			/**
+			*	@brief	Call the prepared method without performing any pointer adjustment on the provided caller.
+			*			Calling this method on a handle that wasn't prepared from a Method or on an invalid handle is undefined behaviour.
+			* 
+			*	@param caller	Object instance calling the method.
+			*	@param args		Arguments forwarded to the method call.
+			* 
+			*	@return The result of the method call.
+			* 
+			*	@exception Any exception potentially thrown from the underlying method.
+			*/
+			ReturnType	invokeUnsafe(void* caller, ArgTypes... args)				const;
+
+			/**
+			*	@brief	Call the prepared method without performing any pointer adjustment on the provided caller.
+			*			Calling this method on a handle that wasn't prepared from a Method or on an invalid handle is undefined behaviour.
+			* 
+			*	@note This is only an overload of the same method with a const caller.
+			* 
+			*	@param caller	Object instance calling the method.
+			*	@param args		Arguments forwarded to the method call.
+			* 
+			*	@return The result of the method call.
+			* 
+			*	@exception Any exception potentially thrown from the underlying method.
+			*	@exception ConstViolation if the method is non-const.
+			*/
+			ReturnType	invokeUnsafe(void const* caller, ArgTypes... args)			const;
+
+			/**
+			*	@brief Get the function this call was prepared from.
+			* 
+			*	@return The function this call was prepared from, nullptr if the handle is invalid.
+			*/
+			RFK_NODISCARD FunctionBase const*	getFunction()						const	noexcept;
+
+			/**
+			*	@return true if the handle was prepared from a function, else false.
+			*/
+			RFK_NODISCARD bool					isValid()							const	noexcept;
+
+			PreparedCall&	operator=(PreparedCall const&)							= default;
+			PreparedCall&	operator=(PreparedCall&&)								= default;
+	};
+
+	#include "Refureku/TypeInfo/Functions/PreparedCall.inl"
+}
@@ -0,0 +1,91 @@
+/**
+*	Copyright (c) 2022 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+////////////////// PreparedCall
+
+template <typename ReturnType, typename... ArgTypes>
+PreparedCall<ReturnType(ArgTypes...)>::PreparedCall(FunctionBase const& function) noexcept:
+	_function{&function},
+	_internalFunction{function.getInternalFunction()}
+{
+}
+
+template <typename ReturnType, typename... ArgTypes>
+ReturnType PreparedCall<ReturnType(ArgTypes...)>::operator()(ArgTypes... args) const
+{
+	assert(isValid());
+	assert(_function->getKind() == EEntityKind::Function || static_cast<MethodBase const*>(_function)->isStatic());
+
+	return reinterpret_cast<NonMemberFunction<ReturnType(ArgTypes...)> const*>(_internalFunction)->operator()(std::forward<ArgTypes>(args)...);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+template <typename CallerType, typename>
+ReturnType PreparedCall<ReturnType(ArgTypes...)>::invoke(CallerType& caller, ArgTypes... args) const
+{
+	assert(isValid());
+
+	return invokeUnsafe(static_cast<Method const*>(_function)->adjustCallerPointerAddress(&caller), std::forward<ArgTypes>(args)...);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+ReturnType PreparedCall<ReturnType(ArgTypes...)>::invokeUnsafe(void* caller, ArgTypes... args) const
+{
+	assert(isValid());
+	assert(_function->getKind() == EEntityKind::Method && !static_cast<MethodBase const*>(_function)->isStatic());
+
+	return Method::MemberFunctionSafeCallWrapper<ReturnType(ArgTypes...)>::invoke(*_internalFunction, caller, std::forward<ArgTypes>(args)...);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+ReturnType PreparedCall<ReturnType(ArgTypes...)>::invokeUnsafe(void const* caller, ArgTypes... args) const
+{
+	assert(isValid());
+	assert(_function->getKind() == EEntityKind::Method && !static_cast<MethodBase const*>(_function)->isStatic());
+
+	Method const* method = static_cast<Method const*>(_function);
+
+	if (!method->isConst())
+	{
+		method->throwConstViolationException();
+	}
+
+	return Method::MemberFunctionSafeCallWrapper<ReturnType(ArgTypes...)>::invoke(*_internalFunction, caller, std::forward<ArgTypes>(args)...);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+FunctionBase const* PreparedCall<ReturnType(ArgTypes...)>::getFunction() const noexcept
+{
+	return _function;
+}
+
+template <typename ReturnType, typename... ArgTypes>
+bool PreparedCall<ReturnType(ArgTypes...)>::isValid() const noexcept
+{
+	return _function != nullptr;
+}
+
+////////////////// FunctionBase
+
+template <typename ReturnType, typename... ArgTypes>
+PreparedCall<ReturnType(ArgTypes...)> FunctionBase::prepare() const
+{
+	checkReturnType<ReturnType>();
+	checkParameterTypes<ArgTypes...>();
+
+	return PreparedCall<ReturnType(ArgTypes...)>(*this);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+Result<PreparedCall<ReturnType(ArgTypes...)>> FunctionBase::tryPrepare() const noexcept
+{
+	EResultCode code = matchSignature<ReturnType, ArgTypes...>();
+
+	return (code == EResultCode::Success) ?
+			Result<PreparedCall<ReturnType(ArgTypes...)>>::makeSuccess(PreparedCall<ReturnType(ArgTypes...)>(*this)) :
+			Result<PreparedCall<ReturnType(ArgTypes...)>>::makeFailure(code);
+}
@@ -15,12 +15,22 @@ namespace rfk
 	class StaticMethod final : public MethodBase
 	{
 		public:
+			/**
+			*	@brief	The pointer overload takes ownership of the provided callable (which must be dynamically allocated),
+			*			the reference overload doesn't and expects the callable to outlive the static method (static storage).
+			*/
 			REFUREKU_API	  StaticMethod(char const*		name,
 										   std::size_t		id,
 										   Type const&		returnType,
 										   ICallable*		internalMethod,
 										   EMethodFlags		flags,
 										   Entity const*	outerEntity)	noexcept;
+			REFUREKU_API	  StaticMethod(char const*		name,
+										   std::size_t		id,
+										   Type const&		returnType,
+										   ICallable&		internalMethod,
+										   EMethodFlags		flags,
+										   Entity const*	outerEntity)	noexcept;
 			REFUREKU_INTERNAL StaticMethod(StaticMethod&&)					noexcept;
 			REFUREKU_API	  ~StaticMethod()								noexcept;
 
@@ -68,6 +78,37 @@ namespace rfk
 			template <typename ReturnType = void, typename... ArgTypes>
 			ReturnType	checkedInvoke(ArgTypes&&... args)	const;
 
+			/**
+			*	@brief	Non-throwing version of StaticMethod::checkedInvoke.
+			*			The return type and arguments types are checked the same way, but a mismatch is reported through the returned result.
+			*			No exception is thrown by the reflection layer, so this method can be used from code compiled without exceptions.
+			*
+			*	@tparam ReturnType	Return type of the function.
+			*	@tparam... ArgTypes	Type of all arguments. This can in some cases be omitted thanks to template deduction.
+			*
+			*	@param args Arguments forwarded to the function call.
+			*
+			*	@return	The result of the function call, or EResultCode::ArgCountMismatch, EResultCode::ArgTypeMismatch or
+			*			EResultCode::ReturnTypeMismatch if the provided signature doesn't match.
+			* 
+			*	@exception	Any exception potentially thrown from the underlying function.
+			*/
+			template <typename ReturnType = void, typename... ArgTypes>
+			Result<ReturnType>	tryCheckedInvoke(ArgTypes&&... args)	const;
+
+			/**
+			*	@brief	Call the function with type-erased arguments.
+			*			The arguments count and types are not checked: providing bad arguments is undefined behaviour.
+			*			Calling this method on a function that can't be invoked erased (see canInvokeErased) is undefined behaviour.
+			*
+			*	@param args			Array of pointers to the arguments, one per parameter. See rfk::ErasedCallThunk.
+			*	@param returnValue	Pointer to uninitialized storage for the return value, or nullptr to discard it. See rfk::ErasedCallThunk.
+			* 
+			*	@exception Any exception potentially thrown from the underlying function.
+			*/
+			REFUREKU_API void	invokeErased(void* const*	args,
+											 void*			returnValue = nullptr)	const;
+
 		private:
 			//Forward declaration
 			class StaticMethodImpl;
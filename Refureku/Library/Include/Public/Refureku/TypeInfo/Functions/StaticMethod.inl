@@ -24,4 +24,17 @@ ReturnType StaticMethod::checkedInvoke(ArgTypes&&... args) const
 	checkParameterTypes<ArgTypes...>();
 
 	return invoke<ReturnType, ArgTypes...>(std::forward<ArgTypes>(args)...);
+}
+
+template <typename ReturnType, typename... ArgTypes>
+Result<ReturnType> StaticMethod::tryCheckedInvoke(ArgTypes&&... args) const
+{
+	EResultCode code = matchSignature<ReturnType, ArgTypes...>();
+
+	if (code != EResultCode::Success)
+	{
+		return Result<ReturnType>::makeFailure(code);
+	}
+
+	return internal::makeSuccessfulResult<ReturnType>([&]() -> ReturnType { return internalInvoke<ReturnType, ArgTypes...>(std::forward<ArgTypes>(args)...); });
 }
\ No newline at end of file
@@ -0,0 +1,159 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t, std::nullptr_t
+
+#include "Refureku/Config.h"
+#include "Refureku/TypeInfo/Entity/EEntityKind.h"
+
+namespace rfk
+{
+	//Forward declaration
+	class MetadataArenaScope;
+
+	/** Allocation statistics of the reflection metadata. */
+	struct MetadataAllocationStatistics
+	{
+		/** Number of metadata objects allocated from an arena. */
+		std::size_t	arenaAllocationsCount	= 0u;
+
+		/** Number of metadata objects allocated from the heap because no arena was in use. Always 0 for a single arena. */
+		std::size_t	heapAllocationsCount	= 0u;
+
+		/** Number of metadata objects allocated from an arena which have not been destroyed yet. */
+		std::size_t	liveAllocationsCount	= 0u;
+
+		/** Number of memory chunks currently held. */
+		std::size_t	chunksCount				= 0u;
+
+		/** Size in bytes of the memory chunks currently held. */
+		std::size_t	reservedBytes			= 0u;
+
+		/** Number of bytes of the currently held memory chunks handed out to metadata objects. */
+		std::size_t	usedBytes				= 0u;
+	};
+
+	/**
+	*	@brief	Bump allocator providing the memory of the metadata (entities and types implementations) of a module.
+	*			Metadata objects constructed while a MetadataArenaScope is open on the arena are allocated from it,
+	*			objects constructed outside of any scope are allocated from the heap.
+	*			Only the implementation objects of the entities and types are allocated from the arena: the strings, containers
+	*			and callables they own still come from the heap.
+	*			A scope applies to the whole thread, so any metadata first built while it is open lands in the arena, including
+	*			fundamental archetypes. Types (rfk::getType) and generated class template instantiations open a heap scope instead.
+	*			The memory is released in one shot once both the arena and all the objects allocated from it are destroyed,
+	*			so metadata outliving its arena (a namespace shared with another module for example) stays valid.
+	*			Generated code declares one arena per reflected translation unit, reserved from the generated entity counts.
+	*/
+	class MetadataArena final
+	{
+		public:
+			/**
+			*	@exception std::bad_alloc if the arena state could not be allocated.
+			*/
+			REFUREKU_API MetadataArena();
+			MetadataArena(MetadataArena const&)				= delete;
+			MetadataArena(MetadataArena&&)					= delete;
+			REFUREKU_API ~MetadataArena()					noexcept;
+
+			/**
+			*	@brief	Reserve enough memory to allocate the provided number of entities of the given kind without allocating a new chunk.
+			*			The memory is allocated when the first metadata object is allocated from the arena,
+			*			so all reservations should be made before any scope is opened on the arena.
+			*
+			*	@param entityKind	Kind of the entities to reserve. Must be a single kind.
+			*	@param count		Number of entities to reserve.
+			*/
+			REFUREKU_API void								reserveEntities(EEntityKind	entityKind,
+																			std::size_t	count)		noexcept;
+
+			/**
+			*	@brief Get the allocation statistics of this arena.
+			*
+			*	@return The allocation statistics of this arena.
+			*/
+			RFK_NODISCARD REFUREKU_API
+				MetadataAllocationStatistics				getStatistics()					const	noexcept;
+
+			/**
+			*	@brief Get the allocation statistics of all the metadata of the program, including the metadata allocated from the heap.
+			*
+			*	@return The allocation statistics of all the metadata of the program.
+			*/
+			RFK_NODISCARD REFUREKU_API static
+				MetadataAllocationStatistics				getGlobalStatistics()					noexcept;
+
+			/**
+			*	@brief	Allocate memory for a metadata object from the arena in use in the current thread if any, else from the heap.
+			*			The memory must be released with MetadataArena::deallocate.
+			*
+			*	@param size Size in bytes of the metadata object.
+			*
+			*	@return The allocated memory.
+			*
+			*	@exception std::bad_alloc if the memory could not be allocated.
+			*/
+			RFK_NODISCARD REFUREKU_INTERNAL static void*	allocate(std::size_t size);
+
+			/**
+			*	@brief Release the memory of a metadata object allocated with MetadataArena::allocate.
+			*
+			*	@param ptr Pointer to the metadata object memory.
+			*/
+			REFUREKU_INTERNAL static void					deallocate(void* ptr)					noexcept;
+
+			MetadataArena& operator=(MetadataArena const&)	= delete;
+			MetadataArena& operator=(MetadataArena&&)		= delete;
+
+		private:
+			//Forward declaration
+			class MetadataArenaImpl;
+
+			/** Arena state, shared with the metadata objects allocated from the arena. */
+			MetadataArenaImpl*	_pimpl;
+
+		friend MetadataArenaScope;
+	};
+
+	/**
+	*	@brief	Make a metadata arena the arena in use in the current thread until the scope is closed or destroyed.
+	*			Scopes can be nested, in which case closing a scope restores the arena in use when it was opened.
+	*/
+	class MetadataArenaScope final
+	{
+		private:
+			/** Arena in use when the scope was opened. */
+			MetadataArena::MetadataArenaImpl*	_previousArena;
+
+			/** Is the scope still open? */
+			bool								_isOpen;
+
+		public:
+			REFUREKU_API explicit MetadataArenaScope(MetadataArena& arena)	noexcept;
+
+			/**
+			*	@brief	Allocate the metadata from the heap in the current thread until the scope is closed or destroyed.
+			*			Used to build metadata shared by all modules, like types and class template instantiations,
+			*			which must not land in the arena of whichever module scope happens to be open.
+			*/
+			REFUREKU_API explicit MetadataArenaScope(std::nullptr_t)		noexcept;
+			MetadataArenaScope(MetadataArenaScope const&)					= delete;
+			MetadataArenaScope(MetadataArenaScope&&)						= delete;
+			REFUREKU_API ~MetadataArenaScope()								noexcept;
+
+			/**
+			*	@brief	Restore the arena in use when the scope was opened.
+			*			Has no effect if the scope is already closed.
+			*/
+			REFUREKU_API void	close()	noexcept;
+
+			MetadataArenaScope& operator=(MetadataArenaScope const&)	= delete;
+			MetadataArenaScope& operator=(MetadataArenaScope&&)			= delete;
+	};
+}
\ No newline at end of file
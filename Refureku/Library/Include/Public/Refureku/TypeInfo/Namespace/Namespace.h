@@ -425,6 +425,20 @@ namespace rfk
 			*/
 			REFUREKU_API void										addFunction(Function const& function)										noexcept;
 
+			/**
+			*	@brief	Reserve enough space to add the provided number of entities of each kind to this namespace.
+			*			Useful to avoid rehashing the namespace members when adding a lot of entities.
+			* 
+			*	@param namespacesCount	Number of namespaces to add.
+			*	@param archetypesCount	Number of archetypes to add.
+			*	@param variablesCount	Number of variables to add.
+			*	@param functionsCount	Number of functions to add.
+			*/
+			REFUREKU_API void										reserveMembers(std::size_t namespacesCount,
+																				   std::size_t archetypesCount,
+																				   std::size_t variablesCount,
+																				   std::size_t functionsCount)							noexcept;
+
 			/**
 			*	@brief Remove a nested namespace from this namespace.
 			* 
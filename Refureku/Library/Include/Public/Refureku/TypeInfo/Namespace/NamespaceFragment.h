@@ -72,6 +72,11 @@ namespace rfk
 			REFUREKU_INTERNAL bool					foreachNestedEntity(Visitor<Entity>	visitor,
 																		void*			userData)	const;
 
+			/**
+			*	@brief Merge the fragment nested entities to the merged namespace.
+			*/
+			REFUREKU_INTERNAL void					mergeFragment()									const	noexcept;
+
 			/**
 			*	@brief Unmerge the fragment from the merged namespace.
 			*/
@@ -13,6 +13,7 @@
 #include "Refureku/Misc/Pimpl.h"
 #include "Refureku/TypeInfo/TypePart.h"
 #include "Refureku/TypeInfo/Archetypes/GetArchetype.h"
+#include "Refureku/TypeInfo/MetadataArena.h"
 
 namespace rfk
 {
@@ -55,8 +55,10 @@ void Type::fillType(Type& out_type) noexcept
 template <typename T>
 Type const& getType() noexcept
 {
-	static Type	result;
-	static bool	initialized = false;
+	//Types are shared by all modules, so don't allocate them from the arena of a generated getter requesting them
+	static MetadataArenaScope	heapScope(nullptr);
+	static Type					result;
+	static bool					initialized = false;
 
 	if (!initialized)
 	{
@@ -64,6 +66,7 @@ Type const& getType() noexcept
 
 		Type::fillType<T>(result);
 		result.optimizeMemory();
+		heapScope.close();
 	}
 
 	return result;
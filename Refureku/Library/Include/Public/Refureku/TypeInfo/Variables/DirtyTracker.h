@@ -0,0 +1,150 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>	//std::size_t
+
+#include "Refureku/Config.h"
+#include "Refureku/Misc/Pimpl.h"
+#include "Refureku/Misc/Visitor.h"
+
+namespace rfk
+{
+	//Forward declarations
+	class Struct;
+	class Field;
+
+	/**
+	*	@brief	Per-instance dirty bits for the fields of a struct, indexed by Field::getIndex.
+	*			Constructing a tracker enables dirty tracking for its struct: Field::set and the other writing methods of
+	*			the struct fields then mark the written field dirty in the written instance (see Field::markDirty).
+	*			Only the instances having at least one dirty field are stored, so iterating over the dirty instances and fields
+	*			costs in proportion to the number of changes rather than to the number of instances or fields.
+	*			Instances are identified by address, so destroyed instances must be cleared with DirtyTracker::clearDirty.
+	*			A tracker is not thread-safe: while it is attached, the fields of its struct must not be written concurrently,
+	*			even in different instances. Debug builds assert it. Attaching and detaching trackers is thread-safe.
+	*/
+	class DirtyTracker final
+	{
+		public:
+			/**
+			*	@brief Attach a dirty tracker to a struct, replacing any tracker previously attached to it.
+			*
+			*	@param archetype Struct whose fields are tracked.
+			*/
+			REFUREKU_API DirtyTracker(Struct const& archetype)	noexcept;
+			DirtyTracker(DirtyTracker const&)					= delete;
+			DirtyTracker(DirtyTracker&&)						= delete;
+
+			/**
+			*	@brief Detach the tracker from its struct.
+			*/
+			REFUREKU_API ~DirtyTracker()						noexcept;
+
+			/**
+			*	@brief Mark a field dirty in an instance.
+			*
+			*	@param instance		Pointer to an object of the tracked struct.
+			*	@param fieldIndex	Index of the field in the tracked struct (see Field::getIndex).
+			*/
+			REFUREKU_API void					markDirty(void const*	instance,
+														  std::size_t	fieldIndex);
+
+			/**
+			*	@brief Mark a field dirty in an instance.
+			*
+			*	@param instance	Pointer to an object of the tracked struct.
+			*	@param field	Field of the tracked struct.
+			*/
+			REFUREKU_API void					markDirty(void const*	instance,
+														  Field const&	field);
+
+			/**
+			*	@brief Check whether a field is dirty in an instance.
+			*
+			*	@param instance		Pointer to an object of the tracked struct.
+			*	@param fieldIndex	Index of the field in the tracked struct (see Field::getIndex).
+			*
+			*	@return true if the field is dirty in the instance, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API bool		isDirty(void const*	instance,
+														std::size_t	fieldIndex)				const	noexcept;
+
+			/**
+			*	@brief Check whether any field is dirty in an instance.
+			*
+			*	@param instance Pointer to an object of the tracked struct.
+			*
+			*	@return true if at least one field is dirty in the instance, else false.
+			*/
+			RFK_NODISCARD REFUREKU_API bool		isDirty(void const* instance)				const	noexcept;
+
+			/**
+			*	@brief Execute the given visitor on all dirty fields of an instance, by increasing field index.
+			*
+			*	@param instance	Pointer to an object of the tracked struct.
+			*	@param visitor	Visitor function to call. Return false to abort the foreach loop.
+			*	@param userData	Optional user data forwarded to the visitor.
+			*
+			*	@return	The last visitor result before exiting the loop.
+			*			If the visitor is nullptr or the instance has no dirty field, return false.
+			*
+			*	@exception Any exception potentially thrown from the provided visitor.
+			*/
+			REFUREKU_API bool					foreachDirtyField(void const*		instance,
+																  Visitor<Field>	visitor,
+																  void*				userData)		const;
+
+			/**
+			*	@brief Get the number of instances having at least one dirty field.
+			*
+			*	@return The number of instances having at least one dirty field.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t	getDirtyInstancesCount()				const	noexcept;
+
+			/**
+			*	@brief	Get the instance having at least one dirty field at the given index.
+			*			The order of the dirty instances is unspecified and changes when an instance is cleared.
+			*
+			*	@param index Index of the instance in [0, getDirtyInstancesCount()[.
+			*
+			*	@return The dirty instance at the given index.
+			*/
+			RFK_NODISCARD REFUREKU_API void const*	getDirtyInstanceAt(std::size_t index)	const	noexcept;
+
+			/**
+			*	@brief Clear all dirty fields of an instance.
+			*
+			*	@param instance Pointer to an object of the tracked struct.
+			*/
+			REFUREKU_API void					clearDirty(void const* instance)					noexcept;
+
+			/**
+			*	@brief Clear all dirty fields of all instances.
+			*/
+			REFUREKU_API void					clearAllDirty()										noexcept;
+
+			/**
+			*	@brief Get the tracked struct.
+			*
+			*	@return The tracked struct.
+			*/
+			RFK_NODISCARD REFUREKU_API Struct const&	getArchetype()						const	noexcept;
+
+			DirtyTracker& operator=(DirtyTracker const&)	= delete;
+			DirtyTracker& operator=(DirtyTracker&&)			= delete;
+
+		protected:
+			//Forward declaration
+			class DirtyTrackerImpl;
+
+		private:
+			/** Concrete implementation of the DirtyTracker class. */
+			Pimpl<DirtyTrackerImpl> _pimpl;
+	};
+}
@@ -7,13 +7,21 @@
 
 #pragma once
 
+#include <cstring>	//std::memcpy
+#include <type_traits>
+#include <atomic>
+
 #include "Refureku/TypeInfo/Variables/FieldBase.h"
 #include "Refureku/TypeInfo/Cast.h"
 #include "Refureku/TypeInfo/MethodFieldHelpers.h"
+#include "Refureku/Misc/Result.h"
 #include "Refureku/Exceptions/InvalidArchetype.h"
 
 namespace rfk
 {
+	//Forward declaration
+	class DirtyTracker;
+
 	class Field final : public FieldBase
 	{
 		public:
@@ -23,6 +31,7 @@ namespace rfk
 									EFieldFlags		flags,
 									Struct const*	owner,
 									std::size_t		memoryOffset,
+									std::size_t		index,
 									Entity const*	outerEntity = nullptr)	noexcept;
 			REFUREKU_INTERNAL Field(Field&&)								noexcept;
 			REFUREKU_INTERNAL ~Field()										noexcept;
@@ -165,6 +174,246 @@ namespace rfk
 												  void const*	valuePtr,
 												  std::size_t	valueSize)				const;
 
+			/**
+			*	@brief	Non-throwing version of Field::get.
+			*			No exception is thrown by the reflection layer, so this method can be used from code compiled without exceptions.
+			*
+			*	@tparam ValueType Type to retrieve from the field. See Field::get.
+			*
+			*	@param instance Instance we retrieve the value from.
+			*
+			*	@return	The queried value in the instance, or
+			*			EResultCode::ConstViolation if the field is const and ValueType is an rvalue or a non-const reference,
+			*			EResultCode::InvalidArchetype if the field can't be accessed from the provided instance.
+			*/
+			template <typename ValueType, typename InstanceType, typename = std::enable_if_t<is_value_v<InstanceType> && internal::IsAdjustableInstanceValue<InstanceType>>>
+			Result<ValueType>			tryGet(InstanceType& instance)					const;
+
+			/**
+			*	@brief	Non-throwing version of Field::getUnsafe.
+			*			This method DOES NOT perform any pointer adjustment on the provided instance.
+			*
+			*	@tparam ValueType Type to retrieve from the field. See Field::get.
+			*
+			*	@param instance Instance we retrieve the value from.
+			*
+			*	@return	The queried value in the instance, or
+			*			EResultCode::ConstViolation if the field is const and ValueType is an rvalue or a non-const reference.
+			*/
+			template <typename ValueType>
+			Result<ValueType>			tryGetUnsafe(void* instance)					const;
+
+			/**
+			*	@brief	Non-throwing version of Field::getUnsafe.
+			*			This method DOES NOT perform any pointer adjustment on the provided instance.
+			*
+			*	@note This is only an overload of the same method with a const instance.
+			*
+			*	@tparam ValueType Type to retrieve from the field. See Field::get.
+			*
+			*	@param instance Instance we retrieve the value from.
+			*
+			*	@return The queried value in the instance. This overload never fails.
+			*/
+			template <typename ValueType>
+			Result<ValueType>			tryGetUnsafe(void const* instance)				const;
+
+			/**
+			*	@brief	Non-throwing version of Field::set.
+			*			No exception is thrown by the reflection layer, so this method can be used from code compiled without exceptions.
+			*
+			*	@tparam ValueType Type to write into the field. See Field::set.
+			*
+			*	@param instance Instance we set the value in.
+			*	@param value	Data to set in the instance.
+			*
+			*	@return	EResultCode::Success if the value was set, or
+			*			EResultCode::ConstViolation if the field is const,
+			*			EResultCode::InvalidArchetype if the field can't be accessed from the provided instance.
+			*/
+			template <typename ValueType, typename InstanceType, typename = std::enable_if_t<is_value_v<InstanceType> && internal::IsAdjustableInstanceValue<InstanceType>>>
+			Result<void>				trySet(InstanceType&	instance,
+											   ValueType&&		value)						const;
+
+			/**
+			*	@brief	Non-throwing version of Field::setUnsafe.
+			*			This method DOES NOT perform any pointer adjustment on the provided instance.
+			*
+			*	@tparam ValueType Type to write into the field. See Field::set.
+			*
+			*	@param instance Instance we set the value in.
+			*	@param value	Data to set in the instance.
+			*
+			*	@return EResultCode::Success if the value was set, or EResultCode::ConstViolation if the field is const.
+			*/
+			template <typename ValueType>
+			Result<void>				trySetUnsafe(void*			instance,
+													 ValueType&&	value)					const;
+
+			/**
+			*	@brief	Copy this field from each element of an instances array into a contiguous buffer.
+			*			The instance pointer adjustment and the field offset are resolved once for the whole array since all
+			*			the elements of an array share the same dynamic type.
+			*			This method is not safe if you provide a wrong ValueType.
+			*
+			*	@tparam ValueType Type of the field.
+			*
+			*	@param instances		Pointer to the first element of the instances array.
+			*	@param instancesCount	Number of elements in the instances array.
+			*	@param out_values		Buffer receiving instancesCount values.
+			* 
+			*	@exception InvalidArchetype if the field can't be accessed from the provided instances.
+			*/
+			template <typename ValueType, typename InstanceType, typename = std::enable_if_t<is_value_v<InstanceType> && internal::IsAdjustableInstanceValue<InstanceType>>>
+			void						gather(InstanceType const*	instances,
+											   std::size_t			instancesCount,
+											   ValueType*			out_values)				const;
+
+			/**
+			*	@brief	Copy this field from each instance of a strided range into a contiguous buffer.
+			*			This method DOES NOT perform any pointer adjustment on the provided instances so it is unsafe if any instance
+			*			is not a valid pointer to an object of the field's owner archetype.
+			*			This method is not safe if you provide a wrong ValueType.
+			*
+			*	@tparam ValueType Type of the field.
+			*
+			*	@param firstInstance	Pointer to the first instance of the range.
+			*	@param instancesCount	Number of instances in the range.
+			*	@param stride			Distance in bytes between 2 consecutive instances.
+			*	@param out_values		Buffer receiving instancesCount values.
+			*/
+			template <typename ValueType>
+			void						gatherUnsafe(void const*	firstInstance,
+													 std::size_t	instancesCount,
+													 std::size_t	stride,
+													 ValueType*		out_values)					const;
+
+			/**
+			*	@brief	Copy this field from each instance of an array of instance pointers into a contiguous buffer.
+			*			This method DOES NOT perform any pointer adjustment on the provided instances so it is unsafe if any instance
+			*			is not a valid pointer to an object of the field's owner archetype.
+			*			This method is not safe if you provide a wrong ValueType.
+			*
+			*	@tparam ValueType Type of the field.
+			*
+			*	@param instances		Array of pointers to the instances.
+			*	@param instancesCount	Number of pointers in the instances array.
+			*	@param out_values		Buffer receiving instancesCount values.
+			*/
+			template <typename ValueType>
+			void						gatherUnsafe(void const* const*	instances,
+													 std::size_t		instancesCount,
+													 ValueType*			out_values)				const;
+
+			/**
+			*	@brief	Same as Field::gather, but the instances array is split in chunks dispatched through the provided executor.
+			*			The executor is called once as executor(std::size_t jobsCount, Job const& job), and must call job(jobIndex)
+			*			exactly once for each jobIndex in [0, jobsCount[ (in any order, from any thread) before returning.
+			*
+			*	@tparam ValueType	Type of the field.
+			*	@tparam Executor	Type of the executor.
+			*
+			*	@param executor			Executor running the jobs.
+			*	@param chunkSize		Maximum number of instances processed by a single job. 0 is treated as 1.
+			*	@param instances		Pointer to the first element of the instances array.
+			*	@param instancesCount	Number of elements in the instances array.
+			*	@param out_values		Buffer receiving instancesCount values.
+			* 
+			*	@exception InvalidArchetype if the field can't be accessed from the provided instances.
+			*	@exception Any exception potentially thrown from the executor.
+			*/
+			template <typename ValueType, typename Executor, typename InstanceType, typename = std::enable_if_t<is_value_v<InstanceType> && internal::IsAdjustableInstanceValue<InstanceType>>>
+			void						gatherParallel(Executor&&			executor,
+													   std::size_t			chunkSize,
+													   InstanceType const*	instances,
+													   std::size_t			instancesCount,
+													   ValueType*			out_values)			const;
+
+			/**
+			*	@brief	Copy the values of a contiguous buffer into this field of each element of an instances array.
+			*			The instance pointer adjustment and the field offset are resolved once for the whole array since all
+			*			the elements of an array share the same dynamic type.
+			*			This method is not safe if you provide a wrong ValueType.
+			*
+			*	@tparam ValueType Type of the field.
+			*
+			*	@param instances		Pointer to the first element of the instances array.
+			*	@param instancesCount	Number of elements in the instances array.
+			*	@param values			Buffer containing instancesCount values.
+			* 
+			*	@exception ConstViolation if the field is actually const and therefore readonly.
+			*	@exception InvalidArchetype if the field can't be accessed from the provided instances.
+			*/
+			template <typename ValueType, typename InstanceType, typename = std::enable_if_t<is_value_v<InstanceType> && internal::IsAdjustableInstanceValue<InstanceType>>>
+			void						scatter(InstanceType*		instances,
+												std::size_t			instancesCount,
+												ValueType const*	values)						const;
+
+			/**
+			*	@brief	Copy the values of a contiguous buffer into this field of each instance of a strided range.
+			*			This method DOES NOT perform any pointer adjustment on the provided instances so it is unsafe if any instance
+			*			is not a valid pointer to an object of the field's owner archetype.
+			*			This method is not safe if you provide a wrong ValueType.
+			*
+			*	@tparam ValueType Type of the field.
+			*
+			*	@param firstInstance	Pointer to the first instance of the range.
+			*	@param instancesCount	Number of instances in the range.
+			*	@param stride			Distance in bytes between 2 consecutive instances.
+			*	@param values			Buffer containing instancesCount values.
+			* 
+			*	@exception ConstViolation if the field is actually const and therefore readonly.
+			*/
+			template <typename ValueType>
+			void						scatterUnsafe(void*				firstInstance,
+													  std::size_t		instancesCount,
+													  std::size_t		stride,
+													  ValueType const*	values)					const;
+
+			/**
+			*	@brief	Copy the values of a contiguous buffer into this field of each instance of an array of instance pointers.
+			*			This method DOES NOT perform any pointer adjustment on the provided instances so it is unsafe if any instance
+			*			is not a valid pointer to an object of the field's owner archetype.
+			*			This method is not safe if you provide a wrong ValueType.
+			*
+			*	@tparam ValueType Type of the field.
+			*
+			*	@param instances		Array of pointers to the instances.
+			*	@param instancesCount	Number of pointers in the instances array.
+			*	@param values			Buffer containing instancesCount values.
+			* 
+			*	@exception ConstViolation if the field is actually const and therefore readonly.
+			*/
+			template <typename ValueType>
+			void						scatterUnsafe(void* const*		instances,
+													  std::size_t		instancesCount,
+													  ValueType const*	values)					const;
+
+			/**
+			*	@brief	Same as Field::scatter, but the instances array is split in chunks dispatched through the provided executor.
+			*			The executor is called once as executor(std::size_t jobsCount, Job const& job), and must call job(jobIndex)
+			*			exactly once for each jobIndex in [0, jobsCount[ (in any order, from any thread) before returning.
+			*
+			*	@tparam ValueType	Type of the field.
+			*	@tparam Executor	Type of the executor.
+			*
+			*	@param executor			Executor running the jobs.
+			*	@param chunkSize		Maximum number of instances processed by a single job. 0 is treated as 1.
+			*	@param instances		Pointer to the first element of the instances array.
+			*	@param instancesCount	Number of elements in the instances array.
+			*	@param values			Buffer containing instancesCount values.
+			* 
+			*	@exception ConstViolation if the field is actually const and therefore readonly.
+			*	@exception InvalidArchetype if the field can't be accessed from the provided instances.
+			*	@exception Any exception potentially thrown from the executor.
+			*/
+			template <typename ValueType, typename Executor, typename InstanceType, typename = std::enable_if_t<is_value_v<InstanceType> && internal::IsAdjustableInstanceValue<InstanceType>>>
+			void						scatterParallel(Executor&&			executor,
+														std::size_t			chunkSize,
+														InstanceType*		instances,
+														std::size_t			instancesCount,
+														ValueType const*	values)				const;
+
 			/**
 			*	@brief	Get a pointer to this field in the provided instance.
 			*
@@ -227,6 +476,44 @@ namespace rfk
 			RFK_NODISCARD REFUREKU_API std::size_t
 										getMemoryOffset()								const	noexcept;
 
+			/**
+			*	@brief	Get the index of this field in its owner struct (Field::getOwner()).
+			*			Field indices of a struct are dense: they cover [0, Struct::getFieldsCount()[ in registration order.
+			* 
+			*	@return The index of this field in its owner struct.
+			*/
+			RFK_NODISCARD REFUREKU_API std::size_t
+										getIndex()										const	noexcept;
+
+			/**
+			*	@brief	Mark this field as dirty in the provided instance if a rfk::DirtyTracker is attached to the field's owner struct.
+			*			Field::set, Field::setUnsafe, Field::trySet, Field::trySetUnsafe, Field::scatter and Field::scatterUnsafe
+			*			call it automatically. It must be called manually after writing the field through a pointer or a rfk::FieldAccessor.
+			*
+			*	@param instance Pointer to an object of the field's owner struct. The pointer is not adjusted.
+			*/
+			REFUREKU_API void			markDirty(void const* instance)					const;
+
+			/**
+			*	@brief Mark this field as dirty in each instance of a strided range. See Field::markDirty.
+			*
+			*	@param firstInstance	Pointer to the first instance of the range. The pointers are not adjusted.
+			*	@param instancesCount	Number of instances in the range.
+			*	@param stride			Distance in bytes between 2 consecutive instances.
+			*/
+			REFUREKU_API void			markDirty(void const*	firstInstance,
+												  std::size_t	instancesCount,
+												  std::size_t	stride)					const;
+
+			/**
+			*	@brief Mark this field as dirty in each instance of an array of instance pointers. See Field::markDirty.
+			*
+			*	@param instances		Array of pointers to the instances. The pointers are not adjusted.
+			*	@param instancesCount	Number of pointers in the instances array.
+			*/
+			REFUREKU_API void			markDirty(void const* const*	instances,
+												  std::size_t			instancesCount)	const;
+
 		protected:
 			//Forward declaration
 			class FieldImpl;
@@ -234,6 +521,44 @@ namespace rfk
 			RFK_GEN_GET_PIMPL(FieldImpl, Entity::getPimpl())
 
 		private:
+			/** Dirty tracker slot of the owner struct, cached so that writes check it without any out-of-line call. */
+			std::atomic<DirtyTracker*> const*	_dirtyTracker;
+
+			/**
+			*	@brief Check whether a rfk::DirtyTracker is attached to the field's owner struct.
+			* 
+			*	@return true if writes to this field must be marked dirty, else false.
+			*/
+			RFK_NODISCARD inline bool	isDirtyTracked()								const	noexcept;
+
+			/**
+			*	@brief Copy a field from a strided range of field addresses into a contiguous buffer.
+			* 
+			*	@param firstField	Address of the field in the first instance.
+			*	@param count		Number of values to copy.
+			*	@param stride		Distance in bytes between 2 consecutive field addresses.
+			*	@param out_values	Buffer receiving count values.
+			*/
+			template <typename ValueType>
+			static void					internalGather(unsigned char const*	firstField,
+													   std::size_t			count,
+													   std::size_t			stride,
+													   ValueType*			out_values);
+
+			/**
+			*	@brief Copy the values of a contiguous buffer into a strided range of field addresses.
+			* 
+			*	@param firstField	Address of the field in the first instance.
+			*	@param count		Number of values to copy.
+			*	@param stride		Distance in bytes between 2 consecutive field addresses.
+			*	@param values		Buffer containing count values.
+			*/
+			template <typename ValueType>
+			static void					internalScatter(unsigned char*		firstField,
+														std::size_t			count,
+														std::size_t			stride,
+														ValueType const*	values);
+
 			/**
 			*	@brief Adjust the instance pointer to a pointer to this field's owner struct.
 			* 
@@ -247,6 +572,18 @@ namespace rfk
 			*/
 			template <typename InstanceType>
 			RFK_NODISCARD InstanceType*	adjustInstancePointerAddress(InstanceType* instance) const;
+
+			/**
+			*	@brief Non-throwing version of adjustInstancePointerAddress.
+			* 
+			*	@tparam InstanceType The static type of the provided instance.
+			* 
+			*	@param instance The instance to adjust.
+			* 
+			*	@return The adjusted instance pointer, or nullptr if the instance dynamic archetype is different from the field's owner struct.
+			*/
+			template <typename InstanceType>
+			RFK_NODISCARD InstanceType*	tryAdjustInstancePointerAddress(InstanceType* instance) const noexcept;
 	};
 
 	REFUREKU_TEMPLATE_API(rfk::Allocator<Field const*>);
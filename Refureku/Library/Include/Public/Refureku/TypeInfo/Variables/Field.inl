@@ -42,6 +42,11 @@ template <typename ValueType>
 void Field::setUnsafe(void* instance, ValueType&& value) const
 {
 	FieldBase::set(getPtrUnsafe(instance), std::forward<ValueType>(value));
+
+	if (RFK_UNLIKELY(isDirtyTracked()))
+	{
+		markDirty(instance);
+	}
 }
 
 template <typename InstanceType, typename>
@@ -50,6 +55,77 @@ void Field::set(InstanceType& instance, void const* valuePtr, std::size_t valueS
 	setUnsafe(adjustInstancePointerAddress(&instance), valuePtr, valueSize);
 }
 
+template <typename ValueType, typename InstanceType, typename>
+Result<ValueType> Field::tryGet(InstanceType& instance) const
+{
+	InstanceType* adjustedInstance = tryAdjustInstancePointerAddress(&instance);
+
+	if (adjustedInstance == nullptr)
+	{
+		return Result<ValueType>::makeFailure(EResultCode::InvalidArchetype);
+	}
+
+	return tryGetUnsafe<ValueType>(adjustedInstance);
+}
+
+template <typename ValueType>
+Result<ValueType> Field::tryGetUnsafe(void* instance) const
+{
+	if constexpr (VariableBase::is_value_v<ValueType> || std::is_const_v<std::remove_reference_t<ValueType>>)
+	{
+		return Result<ValueType>::makeSuccess(FieldBase::get<ValueType>(getConstPtrUnsafe(instance)));
+	}
+	else
+	{
+		if (getType().isConst())
+		{
+			return Result<ValueType>::makeFailure(EResultCode::ConstViolation);
+		}
+
+		//The field is not const, so we can safely drop the constness from getConstPtrUnsafe to avoid the throwing getPtrUnsafe
+		return Result<ValueType>::makeSuccess(FieldBase::get<ValueType>(const_cast<void*>(getConstPtrUnsafe(instance))));
+	}
+}
+
+template <typename ValueType>
+Result<ValueType> Field::tryGetUnsafe(void const* instance) const
+{
+	static_assert(!std::is_rvalue_reference_v<ValueType>, "Can't call Field::tryGet with an rvalue reference ValueType from a const instance.");
+
+	return Result<ValueType>::makeSuccess(FieldBase::get<ValueType>(getConstPtrUnsafe(instance)));
+}
+
+template <typename ValueType, typename InstanceType, typename>
+Result<void> Field::trySet(InstanceType& instance, ValueType&& value) const
+{
+	InstanceType* adjustedInstance = tryAdjustInstancePointerAddress(&instance);
+
+	if (adjustedInstance == nullptr)
+	{
+		return Result<void>::makeFailure(EResultCode::InvalidArchetype);
+	}
+
+	return trySetUnsafe<ValueType>(adjustedInstance, std::forward<ValueType>(value));
+}
+
+template <typename ValueType>
+Result<void> Field::trySetUnsafe(void* instance, ValueType&& value) const
+{
+	if (getType().isConst())
+	{
+		return Result<void>::makeFailure(EResultCode::ConstViolation);
+	}
+
+	FieldBase::set(const_cast<void*>(getConstPtrUnsafe(instance)), std::forward<ValueType>(value));
+
+	if (RFK_UNLIKELY(isDirtyTracked()))
+	{
+		markDirty(instance);
+	}
+
+	return Result<void>::makeSuccess();
+}
+
 template <typename InstanceType, typename>
 void* Field::getPtr(InstanceType& instance) const
 {
@@ -62,6 +138,205 @@ void const* Field::getConstPtr(InstanceType const& instance) const
 	return getConstPtrUnsafe(adjustInstancePointerAddress(&instance));
 }
 
+template <typename ValueType, typename InstanceType, typename>
+void Field::gather(InstanceType const* instances, std::size_t instancesCount, ValueType* out_values) const
+{
+	if (instancesCount != 0u)
+	{
+		//All elements share the same dynamic type, so the adjustment of the first one applies to all of them
+		gatherUnsafe(static_cast<void const*>(adjustInstancePointerAddress(instances)), instancesCount, sizeof(InstanceType), out_values);
+	}
+}
+
+template <typename ValueType>
+void Field::gatherUnsafe(void const* firstInstance, std::size_t instancesCount, std::size_t stride, ValueType* out_values) const
+{
+	if (instancesCount != 0u)
+	{
+		internalGather(reinterpret_cast<unsigned char const*>(getConstPtrUnsafe(firstInstance)), instancesCount, stride, out_values);
+	}
+}
+
+template <typename ValueType>
+void Field::gatherUnsafe(void const* const* instances, std::size_t instancesCount, ValueType* out_values) const
+{
+	std::size_t memoryOffset = getMemoryOffset();
+
+	for (std::size_t i = 0u; i < instancesCount; i++)
+	{
+		internalGather(reinterpret_cast<unsigned char const*>(instances[i]) + memoryOffset, 1u, 0u, out_values + i);
+	}
+}
+
+template <typename ValueType, typename Executor, typename InstanceType, typename>
+void Field::gatherParallel(Executor&& executor, std::size_t chunkSize, InstanceType const* instances, std::size_t instancesCount, ValueType* out_values) const
+{
+	if (instancesCount == 0u)
+	{
+		return;
+	}
+
+	if (chunkSize == 0u)
+	{
+		chunkSize = 1u;
+	}
+
+	//Resolve the address of the field in the first instance only once, every job starts from it
+	auto		firstField	= reinterpret_cast<unsigned char const*>(getConstPtrUnsafe(adjustInstancePointerAddress(instances)));
+	std::size_t	jobsCount	= (instancesCount + chunkSize - 1u) / chunkSize;
+
+	auto job = [&](std::size_t jobIndex)
+	{
+		std::size_t begin	= jobIndex * chunkSize;
+		std::size_t count	= (instancesCount - begin < chunkSize) ? instancesCount - begin : chunkSize;
+
+		internalGather(firstField + begin * sizeof(InstanceType), count, sizeof(InstanceType), out_values + begin);
+	};
+
+	std::forward<Executor>(executor)(jobsCount, static_cast<decltype(job) const&>(job));
+}
+
+template <typename ValueType, typename InstanceType, typename>
+void Field::scatter(InstanceType* instances, std::size_t instancesCount, ValueType const* values) const
+{
+	if (instancesCount != 0u)
+	{
+		scatterUnsafe(static_cast<void*>(adjustInstancePointerAddress(instances)), instancesCount, sizeof(InstanceType), values);
+	}
+}
+
+template <typename ValueType>
+void Field::scatterUnsafe(void* firstInstance, std::size_t instancesCount, std::size_t stride, ValueType const* values) const
+{
+	if (instancesCount != 0u)
+	{
+		//getPtrUnsafe throws if the field is const
+		internalScatter(reinterpret_cast<unsigned char*>(getPtrUnsafe(firstInstance)), instancesCount, stride, values);
+
+		if (RFK_UNLIKELY(isDirtyTracked()))
+		{
+			markDirty(firstInstance, instancesCount, stride);
+		}
+	}
+}
+
+template <typename ValueType>
+void Field::scatterUnsafe(void* const* instances, std::size_t instancesCount, ValueType const* values) const
+{
+	if (instancesCount == 0u)
+	{
+		return;
+	}
+
+	//Check the constness once for the whole array
+	internalScatter(reinterpret_cast<unsigned char*>(getPtrUnsafe(instances[0])), 1u, 0u, values);
+
+	std::size_t memoryOffset = getMemoryOffset();
+
+	for (std::size_t i = 1u; i < instancesCount; i++)
+	{
+		internalScatter(reinterpret_cast<unsigned char*>(instances[i]) + memoryOffset, 1u, 0u, values + i);
+	}
+
+	if (RFK_UNLIKELY(isDirtyTracked()))
+	{
+		markDirty(const_cast<void const* const*>(instances), instancesCount);
+	}
+}
+
+template <typename ValueType, typename Executor, typename InstanceType, typename>
+void Field::scatterParallel(Executor&& executor, std::size_t chunkSize, InstanceType* instances, std::size_t instancesCount, ValueType const* values) const
+{
+	if (instancesCount == 0u)
+	{
+		return;
+	}
+
+	if (chunkSize == 0u)
+	{
+		chunkSize = 1u;
+	}
+
+	//Resolve the address of the field in the first instance only once, every job starts from it
+	auto		firstField	= reinterpret_cast<unsigned char*>(getPtrUnsafe(adjustInstancePointerAddress(instances)));
+	std::size_t	jobsCount	= (instancesCount + chunkSize - 1u) / chunkSize;
+
+	auto job = [&](std::size_t jobIndex)
+	{
+		std::size_t begin	= jobIndex * chunkSize;
+		std::size_t count	= (instancesCount - begin < chunkSize) ? instancesCount - begin : chunkSize;
+
+		internalScatter(firstField + begin * sizeof(InstanceType), count, sizeof(InstanceType), values + begin);
+	};
+
+	std::forward<Executor>(executor)(jobsCount, static_cast<decltype(job) const&>(job));
+
+	//Dirty trackers are not thread-safe, so mark the instances once all jobs are done
+	if (RFK_UNLIKELY(isDirtyTracked()))
+	{
+		markDirty(firstField - getMemoryOffset(), instancesCount, sizeof(InstanceType));
+	}
+}
+
+template <typename ValueType>
+void Field::internalGather(unsigned char const* firstField, std::size_t count, std::size_t stride, ValueType* out_values)
+{
+	if constexpr (std::is_trivially_copyable_v<ValueType>)
+	{
+		if (stride == sizeof(ValueType))
+		{
+			//Densely packed fields, copy the whole range at once
+			std::memcpy(out_values, firstField, count * sizeof(ValueType));
+		}
+		else
+		{
+			//Fixed-size copies with a constant stride: compilers lower this loop to plain (or vector gather) loads
+			for (std::size_t i = 0u; i < count; i++)
+			{
+				std::memcpy(out_values + i, firstField + i * stride, sizeof(ValueType));
+			}
+		}
+	}
+	else
+	{
+		for (std::size_t i = 0u; i < count; i++)
+		{
+			out_values[i] = *reinterpret_cast<ValueType const*>(firstField + i * stride);
+		}
+	}
+}
+
+template <typename ValueType>
+void Field::internalScatter(unsigned char* firstField, std::size_t count, std::size_t stride, ValueType const* values)
+{
+	if constexpr (std::is_trivially_copyable_v<ValueType>)
+	{
+		if (stride == sizeof(ValueType))
+		{
+			std::memcpy(firstField, values, count * sizeof(ValueType));
+		}
+		else
+		{
+			for (std::size_t i = 0u; i < count; i++)
+			{
+				std::memcpy(firstField + i * stride, values + i, sizeof(ValueType));
+			}
+		}
+	}
+	else
+	{
+		for (std::size_t i = 0u; i < count; i++)
+		{
+			*reinterpret_cast<ValueType*>(firstField + i * stride) = values[i];
+		}
+	}
+}
+
+inline bool Field::isDirtyTracked() const noexcept
+{
+	return _dirtyTracker->load(std::memory_order_acquire) != nullptr;
+}
+
 template <typename InstanceType>
 InstanceType* Field::adjustInstancePointerAddress(InstanceType* instance) const
 {
@@ -75,5 +350,18 @@ InstanceType* Field::adjustInstancePointerAddress(InstanceType* instance) const
 	//We are sure at this point that the targetArchetype is the instance dynamic archetype.
 	//so we know InstanceType is a parent class of targetArchetype or targetArchetype itself.
 	//In this situation, a single down cast should be enough.
+	return rfk::dynamicDownCast<InstanceType>(instance, InstanceType::staticGetArchetype(), ownerStruct);
+}
+
+template <typename InstanceType>
+InstanceType* Field::tryAdjustInstancePointerAddress(InstanceType* instance) const noexcept
+{
+	Struct const& ownerStruct = *getOwner();
+
+	if (ownerStruct != instance->getArchetype())
+	{
+		return nullptr;
+	}
+
 	return rfk::dynamicDownCast<InstanceType>(instance, InstanceType::staticGetArchetype(), ownerStruct);
 }
\ No newline at end of file
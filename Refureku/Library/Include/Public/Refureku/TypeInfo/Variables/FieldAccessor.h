@@ -0,0 +1,177 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <cstddef>		//std::ptrdiff_t
+#include <cassert>
+#include <utility>		//std::forward
+#include <type_traits>	//std::is_reference_v
+
+#include "Refureku/TypeInfo/Variables/Field.h"
+#include "Refureku/TypeInfo/Archetypes/Struct.h"
+#include "Refureku/Exceptions/InvalidArchetype.h"
+
+namespace rfk
+{
+	/**
+	*	@brief	Handle to a field resolved once for a given instance archetype.
+	*			The pointer adjustment from the instance archetype to the field's owner struct and the field memory offset
+	*			are folded into a single offset when the accessor is bound, so accessing the field is a single add-and-load.
+	*			The instance archetype and the field constness are only checked in debug builds.
+	*
+	*	@tparam ValueType Type of the field. Providing a type different from the field type is undefined behaviour.
+	*/
+	template <typename ValueType>
+	class FieldAccessor
+	{
+		static_assert(!std::is_reference_v<ValueType>, "FieldAccessor ValueType can't be a reference.");
+
+		private:
+			/** Offset from an instance of _instanceArchetype to the field. */
+			std::ptrdiff_t	_offset				= 0;
+
+			/** Bound field. */
+			Field const*	_field				= nullptr;
+
+			/** Archetype of the instances the field is accessed from. */
+			Struct const*	_instanceArchetype	= nullptr;
+
+			/** Is the bound field const? */
+			bool			_isConst			= false;
+
+			/**
+			*	@brief Get the address of the field in the provided instance.
+			*
+			*	@param instance Pointer to an object of the bound instance archetype.
+			*
+			*	@return The address of the field.
+			*/
+			RFK_NODISCARD unsigned char*			getFieldAddress(void const* instance)	const	noexcept;
+
+		public:
+			FieldAccessor()									= default;
+			FieldAccessor(FieldAccessor const&)				= default;
+			FieldAccessor(FieldAccessor&&)					= default;
+
+			/**
+			*	@param instanceArchetype	Archetype of the instances the field will be accessed from.
+			*								It must be the field's owner struct or one of its subclasses.
+			*	@param field				Field to access.
+			*
+			*	@exception InvalidArchetype if the field can't be accessed from an instance of instanceArchetype.
+			*/
+			FieldAccessor(Struct const&	instanceArchetype,
+						  Field const&	field);
+
+			/**
+			*	@brief Bind the accessor to a field, accessed from instances of the field's owner struct.
+			*
+			*	@param field Field to access.
+			*/
+			explicit FieldAccessor(Field const& field)							noexcept;
+
+			/**
+			*	@brief	Get a reference to the field in the provided instance.
+			*			The static archetype of InstanceType must be the bound instance archetype (checked in debug only).
+			*			Getting a non-const reference to a const field is undefined behaviour (checked in debug only).
+			*
+			*	@param instance Instance we get the field from.
+			*
+			*	@return A reference to the field in the provided instance.
+			*/
+			template <typename InstanceType>
+			RFK_NODISCARD ValueType&		get(InstanceType& instance)					const	noexcept;
+
+			/**
+			*	@brief	Get a const reference to the field in the provided instance.
+			*			The static archetype of InstanceType must be the bound instance archetype (checked in debug only).
+			*
+			*	@param instance Instance we get the field from.
+			*
+			*	@return A const reference to the field in the provided instance.
+			*/
+			template <typename InstanceType>
+			RFK_NODISCARD ValueType const&	get(InstanceType const& instance)			const	noexcept;
+
+			/**
+			*	@brief	Get a reference to the field in the provided instance.
+			*			Providing a pointer which is not a valid pointer to an object of the bound instance archetype is undefined behaviour.
+			*			Getting a non-const reference to a const field is undefined behaviour (checked in debug only).
+			*
+			*	@param instance Instance we get the field from.
+			*
+			*	@return A reference to the field in the provided instance.
+			*/
+			RFK_NODISCARD ValueType&		getUnsafe(void* instance)					const	noexcept;
+
+			/**
+			*	@brief	Get a const reference to the field in the provided instance.
+			*			Providing a pointer which is not a valid pointer to an object of the bound instance archetype is undefined behaviour.
+			*
+			*	@param instance Instance we get the field from.
+			*
+			*	@return A const reference to the field in the provided instance.
+			*/
+			RFK_NODISCARD ValueType const&	getUnsafe(void const* instance)				const	noexcept;
+
+			/**
+			*	@brief	Set the field in the provided instance.
+			*			The static archetype of InstanceType must be the bound instance archetype (checked in debug only).
+			*			Setting a const field is undefined behaviour (checked in debug only).
+			*
+			*	@param instance	Instance we set the field in.
+			*	@param value	Value forwarded to the field assignment.
+			*/
+			template <typename InstanceType, typename ArgType>
+			void							set(InstanceType&	instance,
+												ArgType&&		value)					const;
+
+			/**
+			*	@brief	Set the field in the provided instance.
+			*			Providing a pointer which is not a valid pointer to an object of the bound instance archetype is undefined behaviour.
+			*			Setting a const field is undefined behaviour (checked in debug only).
+			*
+			*	@param instance	Instance we set the field in.
+			*	@param value	Value forwarded to the field assignment.
+			*/
+			template <typename ArgType>
+			void							setUnsafe(void*		instance,
+													  ArgType&&	value)					const;
+
+			/**
+			*	@brief Get the bound field.
+			*
+			*	@return The bound field, nullptr if the accessor is unbound.
+			*/
+			RFK_NODISCARD Field const*		getField()									const	noexcept;
+
+			/**
+			*	@brief Get the archetype of the instances the field is accessed from.
+			*
+			*	@return The archetype of the instances the field is accessed from, nullptr if the accessor is unbound.
+			*/
+			RFK_NODISCARD Struct const*		getInstanceArchetype()						const	noexcept;
+
+			/**
+			*	@brief Get the offset from an instance of the bound instance archetype to the field.
+			*
+			*	@return The offset in bytes from an instance of the bound instance archetype to the field.
+			*/
+			RFK_NODISCARD std::ptrdiff_t	getOffset()									const	noexcept;
+
+			/**
+			*	@return true if a field is bound, else false.
+			*/
+			RFK_NODISCARD bool				isBound()									const	noexcept;
+
+			FieldAccessor&	operator=(FieldAccessor const&)	= default;
+			FieldAccessor&	operator=(FieldAccessor&&)		= default;
+	};
+
+	#include "Refureku/TypeInfo/Variables/FieldAccessor.inl"
+}
@@ -0,0 +1,110 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename ValueType>
+FieldAccessor<ValueType>::FieldAccessor(Struct const& instanceArchetype, Field const& field):
+	_field{&field},
+	_instanceArchetype{&instanceArchetype},
+	_isConst{field.getType().isConst()}
+{
+	std::ptrdiff_t ownerOffset = 0;
+
+	//Offset to add to an instanceArchetype pointer to get a pointer to the field owner
+	if (instanceArchetype != *field.getOwner() && !field.getOwner()->getSubclassPointerOffset(instanceArchetype, ownerOffset))
+	{
+		throw InvalidArchetype("The field can't be accessed from an instance of the provided archetype.");
+	}
+
+	_offset = ownerOffset + static_cast<std::ptrdiff_t>(field.getMemoryOffset());
+}
+
+template <typename ValueType>
+FieldAccessor<ValueType>::FieldAccessor(Field const& field) noexcept:
+	_offset{static_cast<std::ptrdiff_t>(field.getMemoryOffset())},
+	_field{&field},
+	_instanceArchetype{field.getOwner()},
+	_isConst{field.getType().isConst()}
+{
+}
+
+template <typename ValueType>
+unsigned char* FieldAccessor<ValueType>::getFieldAddress(void const* instance) const noexcept
+{
+	assert(isBound());
+
+	return const_cast<unsigned char*>(reinterpret_cast<unsigned char const*>(instance)) + _offset;
+}
+
+template <typename ValueType>
+template <typename InstanceType>
+ValueType& FieldAccessor<ValueType>::get(InstanceType& instance) const noexcept
+{
+	assert(InstanceType::staticGetArchetype() == *_instanceArchetype);
+
+	return getUnsafe(static_cast<void*>(&instance));
+}
+
+template <typename ValueType>
+template <typename InstanceType>
+ValueType const& FieldAccessor<ValueType>::get(InstanceType const& instance) const noexcept
+{
+	assert(InstanceType::staticGetArchetype() == *_instanceArchetype);
+
+	return getUnsafe(static_cast<void const*>(&instance));
+}
+
+template <typename ValueType>
+ValueType& FieldAccessor<ValueType>::getUnsafe(void* instance) const noexcept
+{
+	assert(!_isConst);
+
+	return *reinterpret_cast<ValueType*>(getFieldAddress(instance));
+}
+
+template <typename ValueType>
+ValueType const& FieldAccessor<ValueType>::getUnsafe(void const* instance) const noexcept
+{
+	return *reinterpret_cast<ValueType const*>(getFieldAddress(instance));
+}
+
+template <typename ValueType>
+template <typename InstanceType, typename ArgType>
+void FieldAccessor<ValueType>::set(InstanceType& instance, ArgType&& value) const
+{
+	get(instance) = std::forward<ArgType>(value);
+}
+
+template <typename ValueType>
+template <typename ArgType>
+void FieldAccessor<ValueType>::setUnsafe(void* instance, ArgType&& value) const
+{
+	getUnsafe(instance) = std::forward<ArgType>(value);
+}
+
+template <typename ValueType>
+Field const* FieldAccessor<ValueType>::getField() const noexcept
+{
+	return _field;
+}
+
+template <typename ValueType>
+Struct const* FieldAccessor<ValueType>::getInstanceArchetype() const noexcept
+{
+	return _instanceArchetype;
+}
+
+template <typename ValueType>
+std::ptrdiff_t FieldAccessor<ValueType>::getOffset() const noexcept
+{
+	return _offset;
+}
+
+template <typename ValueType>
+bool FieldAccessor<ValueType>::isBound() const noexcept
+{
+	return _field != nullptr;
+}
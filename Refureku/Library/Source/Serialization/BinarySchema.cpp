@@ -0,0 +1,191 @@
+#include "Refureku/Serialization/BinarySchema.h"
+
+#include <algorithm>	//std::sort
+#include <cstring>		//std::memcpy
+#include <cassert>
+
+#include "Refureku/TypeInfo/Archetypes/Struct.h"
+#include "Refureku/TypeInfo/Variables/Field.h"
+#include "Refureku/TypeInfo/Type.h"
+#include "Refureku/TypeInfo/TypePart.h"
+
+using namespace rfk;
+
+namespace
+{
+	constexpr uint64 fnvOffsetBasis	= 14695981039346656037ull;
+	constexpr uint64 fnvPrime		= 1099511628211ull;
+
+	/**
+	*	@brief Combine the bytes of a value into a FNV-1a hash.
+	*/
+	void hashCombine(uint64& inout_hash, uint64 value) noexcept
+	{
+		for (std::size_t i = 0u; i < sizeof(uint64); i++)
+		{
+			inout_hash ^= (value >> (i * 8u)) & 0xFFu;
+			inout_hash *= fnvPrime;
+		}
+	}
+
+	/**
+	*	@brief Append the bytes of a value to a byte vector.
+	*/
+	template <typename T>
+	void append(Vector<unsigned char>& inout_bytes, T value) noexcept
+	{
+		std::size_t size = inout_bytes.size();
+
+		inout_bytes.resize(size + sizeof(T));
+		std::memcpy(inout_bytes.data() + size, &value, sizeof(T));
+	}
+
+	/**
+	*	@brief	Fill a schema field from a struct field.
+	*
+	*	@return true if the field can be serialized, else false.
+	*/
+	bool makeSchemaField(Field const& field, BinarySchemaField& out_schemaField) noexcept
+	{
+		Type const& type = field.getType();
+
+		//Const fields can't be deserialized
+		if (type.isConst())
+		{
+			return false;
+		}
+
+		//Flatten (multidimensional) C arrays
+		std::size_t	elementsCount	= 1u;
+		std::size_t	partIndex		= 0u;
+
+		for (; partIndex < type.getTypePartsCount() && type.getTypePartAt(partIndex).isCArray(); partIndex++)
+		{
+			elementsCount *= type.getTypePartAt(partIndex).getCArraySize();
+		}
+
+		//The element must be a non-const value, not a pointer or a reference
+		if (partIndex + 1u != type.getTypePartsCount() || !type.getTypePartAt(partIndex).isValue() || type.getTypePartAt(partIndex).isConst())
+		{
+			return false;
+		}
+
+		Archetype const* elementArchetype = type.getArchetype();
+
+		if (elementArchetype == nullptr || elementArchetype->getMemorySize() == 0u || elementsCount == 0u)
+		{
+			return false;
+		}
+
+		out_schemaField.field				= &field;
+		out_schemaField.elementArchetype	= elementArchetype;
+		out_schemaField.elementSize			= elementArchetype->getMemorySize();
+		out_schemaField.elementsCount		= static_cast<uint32>(elementsCount);
+
+		switch (elementArchetype->getKind())
+		{
+			case EEntityKind::FundamentalArchetype:
+				[[fallthrough]];
+			case EEntityKind::Enum:
+				out_schemaField.nestedSchema	= nullptr;
+				out_schemaField.payloadSize		= static_cast<uint32>(out_schemaField.elementSize * elementsCount);
+				return true;
+
+			case EEntityKind::Struct:
+				[[fallthrough]];
+			case EEntityKind::Class:
+				out_schemaField.nestedSchema	= &static_cast<Struct const*>(elementArchetype)->getBinarySchema();
+				out_schemaField.payloadSize		= static_cast<uint32>(out_schemaField.nestedSchema->getRecordSize() * elementsCount);
+				return true;
+
+			default:
+				return false;
+		}
+	}
+}
+
+BinarySchema::BinarySchema(Struct const& archetype) noexcept:
+	_archetype{&archetype},
+	_id{fnvOffsetBasis},
+	_recordSize{0u}
+{
+	//Collect serializable fields, including inherited ones
+	_fields.reserve(archetype.getFieldsCount());
+
+	archetype.foreachField([](Field const& field, void* userData)
+						   {
+							   BinarySchemaField schemaField;
+
+							   if (makeSchemaField(field, schemaField))
+							   {
+								   reinterpret_cast<Vector<BinarySchemaField>*>(userData)->push_back(schemaField);
+							   }
+
+							   return true;
+						   }, &_fields, true);
+
+	//Order fields by memory offset so that adjacent bytewise fields can be copied at once
+	std::sort(_fields.begin(), _fields.end(), [](BinarySchemaField const& lhs, BinarySchemaField const& rhs)
+			  {
+				  return lhs.field->getMemoryOffset() < rhs.field->getMemoryOffset();
+			  });
+
+	//Compute the schema id, the operations and the data section size
+	std::size_t dataSize = 0u;
+
+	hashCombine(_id, archetype.getId());
+
+	for (std::size_t i = 0u; i < _fields.size(); i++)
+	{
+		BinarySchemaField const&	schemaField = _fields[i];
+		std::size_t					offset		= schemaField.field->getMemoryOffset();
+
+		hashCombine(_id, schemaField.field->getId());
+		hashCombine(_id, schemaField.elementArchetype->getId());
+		hashCombine(_id, schemaField.elementsCount);
+		hashCombine(_id, schemaField.payloadSize);
+
+		if (schemaField.nestedSchema == nullptr)
+		{
+			std::size_t size = schemaField.elementSize * schemaField.elementsCount;
+
+			//Merge with the previous copy if the field directly follows it in memory
+			if (!_ops.empty() && _ops.back().nestedSchema == nullptr && _ops.back().offset + _ops.back().size == offset)
+			{
+				_ops.back().size += size;
+				_ops.back().fieldsCount++;
+			}
+			else
+			{
+				_ops.push_back(BinarySchemaOp{ offset, size, 0u, nullptr, i, 1u });
+			}
+		}
+		else
+		{
+			hashCombine(_id, schemaField.nestedSchema->getId());
+
+			_ops.push_back(BinarySchemaOp{ offset, schemaField.elementSize, schemaField.elementsCount, schemaField.nestedSchema, i, 1u });
+		}
+
+		dataSize += schemaField.payloadSize;
+	}
+
+	assert(dataSize <= UINT32_MAX);
+
+	//Build the header and field table shared by all records
+	_header.reserve(headerSize + fieldEntrySize * _fields.size());
+
+	append(_header, _id);
+	append(_header, static_cast<uint32>(_fields.size()));
+	append(_header, static_cast<uint32>(dataSize));
+
+	for (BinarySchemaField const& schemaField : _fields)
+	{
+		append(_header, static_cast<uint64>(schemaField.field->getId()));
+		append(_header, static_cast<uint64>(schemaField.elementArchetype->getId()));
+		append(_header, schemaField.elementsCount);
+		append(_header, schemaField.payloadSize);
+	}
+
+	_recordSize = _header.size() + dataSize;
+}
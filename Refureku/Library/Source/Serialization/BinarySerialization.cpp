@@ -0,0 +1,173 @@
+#include "Refureku/Serialization/BinarySerialization.h"
+
+#include "Refureku/TypeInfo/Archetypes/Archetype.h"
+#include "Refureku/TypeInfo/Variables/Field.h"
+
+using namespace rfk;
+
+namespace
+{
+	/**
+	*	@brief Read a value from a possibly unaligned address.
+	*/
+	template <typename T>
+	T read(unsigned char const* data) noexcept
+	{
+		T result;
+
+		std::memcpy(&result, data, sizeof(T));
+
+		return result;
+	}
+
+	/**
+	*	@brief	Get the size of the record starting at the provided address.
+	*
+	*	@return The size of the record, 0 if the buffer is too small to contain the record.
+	*/
+	std::size_t getRecordSize(unsigned char const* record, std::size_t bufferSize) noexcept
+	{
+		if (bufferSize < BinarySchema::headerSize)
+		{
+			return 0u;
+		}
+
+		std::size_t fieldsCount	= read<uint32>(record + sizeof(uint64));
+		std::size_t dataSize	= read<uint32>(record + sizeof(uint64) + sizeof(uint32));
+		std::size_t recordSize	= BinarySchema::headerSize + fieldsCount * BinarySchema::fieldEntrySize + dataSize;
+
+		return (recordSize <= bufferSize) ? recordSize : 0u;
+	}
+
+	/**
+	*	@brief Read the data section of a record having exactly the provided schema.
+	*/
+	void readMatchingRecord(BinarySchema const& schema, unsigned char* instance, unsigned char const* record) noexcept
+	{
+		unsigned char const* data = record + schema.getHeader().size();
+
+		for (BinarySchemaOp const& op : schema.getOps())
+		{
+			if (op.nestedSchema == nullptr)
+			{
+				std::memcpy(instance + op.offset, data, op.size);
+				data += op.size;
+			}
+			else
+			{
+				for (std::size_t i = 0u; i < op.elementsCount; i++)
+				{
+					readMatchingRecord(*op.nestedSchema, instance + op.offset + i * op.size, data);
+					data += op.nestedSchema->getRecordSize();
+				}
+			}
+		}
+	}
+
+	std::size_t readRecord(BinarySchema const& schema, unsigned char* instance, unsigned char const* record, std::size_t bufferSize) noexcept;
+
+	/**
+	*	@brief	Read the payload of a record field into a schema field.
+	*
+	*	@return false if the payload is malformed, else true.
+	*/
+	bool readFieldPayload(BinarySchemaField const& schemaField, unsigned char* instance, unsigned char const* payload,
+						  std::size_t payloadSize, std::size_t elementsCount) noexcept
+	{
+		unsigned char* field = instance + schemaField.field->getMemoryOffset();
+
+		if (schemaField.nestedSchema == nullptr)
+		{
+			//Skip the field if its element size changed
+			if (elementsCount != 0u && payloadSize == elementsCount * schemaField.elementSize)
+			{
+				std::memcpy(field, payload, ((elementsCount < schemaField.elementsCount) ? elementsCount : schemaField.elementsCount) * schemaField.elementSize);
+			}
+
+			return true;
+		}
+
+		//Nested records don't have a fixed size if their schema changed, so walk them
+		for (std::size_t i = 0u; i < elementsCount; i++)
+		{
+			std::size_t recordSize = (i < schemaField.elementsCount) ?
+										readRecord(*schemaField.nestedSchema, field + i * schemaField.elementSize, payload, payloadSize) :
+										getRecordSize(payload, payloadSize);
+
+			if (recordSize == 0u)
+			{
+				return false;
+			}
+
+			payload		+= recordSize;
+			payloadSize -= recordSize;
+		}
+
+		return true;
+	}
+
+	/**
+	*	@brief	Read a record into an instance.
+	*
+	*	@return The size of the record, 0 if the record is malformed.
+	*/
+	std::size_t readRecord(BinarySchema const& schema, unsigned char* instance, unsigned char const* record, std::size_t bufferSize) noexcept
+	{
+		std::size_t recordSize = getRecordSize(record, bufferSize);
+
+		if (recordSize == 0u)
+		{
+			return 0u;
+		}
+
+		//Same schema, same layout: don't look at the field table
+		if (read<uint64>(record) == schema.getId() && recordSize == schema.getRecordSize())
+		{
+			readMatchingRecord(schema, instance, record);
+
+			return recordSize;
+		}
+
+		//Different schema: match fields by id
+		std::size_t				fieldsCount = read<uint32>(record + sizeof(uint64));
+		unsigned char const*	fieldEntry	= record + BinarySchema::headerSize;
+		unsigned char const*	payload		= fieldEntry + fieldsCount * BinarySchema::fieldEntrySize;
+
+		for (std::size_t i = 0u; i < fieldsCount; i++, fieldEntry += BinarySchema::fieldEntrySize)
+		{
+			uint64		fieldId			= read<uint64>(fieldEntry);
+			uint64		archetypeId		= read<uint64>(fieldEntry + sizeof(uint64));
+			std::size_t	elementsCount	= read<uint32>(fieldEntry + sizeof(uint64) * 2u);
+			std::size_t	payloadSize		= read<uint32>(fieldEntry + sizeof(uint64) * 2u + sizeof(uint32));
+
+			if (payloadSize > static_cast<std::size_t>(record + recordSize - payload))
+			{
+				return 0u;
+			}
+
+			for (BinarySchemaField const& schemaField : schema.getFields())
+			{
+				if (schemaField.field->getId() == fieldId)
+				{
+					//Skip the field if its type changed
+					if (schemaField.elementArchetype->getId() == archetypeId &&
+						!readFieldPayload(schemaField, instance, payload, payloadSize, elementsCount))
+					{
+						return 0u;
+					}
+
+					break;
+				}
+			}
+
+			payload += payloadSize;
+		}
+
+		return recordSize;
+	}
+}
+
+std::size_t rfk::deserializeBinary(Struct const& archetype, void* instance, void const* buffer, std::size_t bufferSize)
+{
+	return readRecord(archetype.getBinarySchema(), reinterpret_cast<unsigned char*>(instance), reinterpret_cast<unsigned char const*>(buffer), bufferSize);
+}
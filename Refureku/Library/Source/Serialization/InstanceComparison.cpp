@@ -0,0 +1,152 @@
+#include "Refureku/Serialization/InstanceComparison.h"
+
+#include <cstring>	//std::memcpy, std::memcmp
+
+#include "Refureku/Serialization/BinarySchema.h"
+#include "Refureku/TypeInfo/Archetypes/Struct.h"
+#include "Refureku/TypeInfo/Variables/Field.h"
+
+using namespace rfk;
+
+namespace
+{
+	constexpr uint64 hashMultiplier = 0x9E3779B97F4A7C15ull;
+
+	/**
+	*	@brief Combine a 64-bit word into a hash.
+	*/
+	inline void hashCombine(uint64& inout_hash, uint64 word) noexcept
+	{
+		inout_hash = (inout_hash ^ word) * hashMultiplier;
+		inout_hash ^= inout_hash >> 32u;
+	}
+
+	/**
+	*	@brief Combine a range of bytes into a hash, 8 bytes at a time.
+	*/
+	void hashBytes(uint64& inout_hash, unsigned char const* bytes, std::size_t size) noexcept
+	{
+		uint64 word;
+
+		for (; size >= sizeof(uint64); bytes += sizeof(uint64), size -= sizeof(uint64))
+		{
+			std::memcpy(&word, bytes, sizeof(uint64));
+			hashCombine(inout_hash, word);
+		}
+
+		if (size != 0u)
+		{
+			word = 0u;
+			std::memcpy(&word, bytes, size);
+			hashCombine(inout_hash, word ^ (static_cast<uint64>(size) << 56u));
+		}
+	}
+
+	void hashRecursive(BinarySchema const& schema, unsigned char const* instance, uint64& inout_hash) noexcept
+	{
+		for (BinarySchemaOp const& op : schema.getOps())
+		{
+			if (op.nestedSchema == nullptr)
+			{
+				hashBytes(inout_hash, instance + op.offset, op.size);
+			}
+			else
+			{
+				for (std::size_t i = 0u; i < op.elementsCount; i++)
+				{
+					hashRecursive(*op.nestedSchema, instance + op.offset + i * op.size, inout_hash);
+				}
+			}
+		}
+	}
+
+	/**
+	*	@brief Check whether the data covered by an operation is equal in 2 instances.
+	*/
+	bool equalOp(BinarySchemaOp const& op, unsigned char const* lhs, unsigned char const* rhs) noexcept;
+
+	bool equalRecursive(BinarySchema const& schema, unsigned char const* lhs, unsigned char const* rhs) noexcept
+	{
+		for (BinarySchemaOp const& op : schema.getOps())
+		{
+			if (!equalOp(op, lhs, rhs))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool equalOp(BinarySchemaOp const& op, unsigned char const* lhs, unsigned char const* rhs) noexcept
+	{
+		if (op.nestedSchema == nullptr)
+		{
+			return std::memcmp(lhs + op.offset, rhs + op.offset, op.size) == 0;
+		}
+
+		for (std::size_t i = 0u; i < op.elementsCount; i++)
+		{
+			std::size_t elementOffset = op.offset + i * op.size;
+
+			if (!equalRecursive(*op.nestedSchema, lhs + elementOffset, rhs + elementOffset))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+std::size_t rfk::hashInstance(Struct const& archetype, void const* instance)
+{
+	BinarySchema const&	schema	= archetype.getBinarySchema();
+	uint64				result	= schema.getId();
+
+	hashRecursive(schema, reinterpret_cast<unsigned char const*>(instance), result);
+
+	return static_cast<std::size_t>(result);
+}
+
+bool rfk::equalInstances(Struct const& archetype, void const* lhs, void const* rhs)
+{
+	return equalRecursive(archetype.getBinarySchema(), reinterpret_cast<unsigned char const*>(lhs), reinterpret_cast<unsigned char const*>(rhs));
+}
+
+std::size_t rfk::diffInstances(Struct const& archetype, void const* lhs, void const* rhs, Vector<Field const*>& out_changedFields)
+{
+	BinarySchema const&		schema			= archetype.getBinarySchema();
+	unsigned char const*	lhsBytes		= reinterpret_cast<unsigned char const*>(lhs);
+	unsigned char const*	rhsBytes		= reinterpret_cast<unsigned char const*>(rhs);
+	std::size_t				initialSize		= out_changedFields.size();
+
+	for (BinarySchemaOp const& op : schema.getOps())
+	{
+		//Compare the whole run first, and only look for the changed fields if it differs
+		if (equalOp(op, lhsBytes, rhsBytes))
+		{
+			continue;
+		}
+
+		if (op.fieldsCount == 1u)
+		{
+			out_changedFields.push_back(schema.getFields()[op.firstFieldIndex].field);
+		}
+		else
+		{
+			for (std::size_t i = op.firstFieldIndex; i < op.firstFieldIndex + op.fieldsCount; i++)
+			{
+				BinarySchemaField const&	schemaField = schema.getFields()[i];
+				std::size_t					offset		= schemaField.field->getMemoryOffset();
+
+				if (std::memcmp(lhsBytes + offset, rhsBytes + offset, schemaField.elementSize * schemaField.elementsCount) != 0)
+				{
+					out_changedFields.push_back(schemaField.field);
+				}
+			}
+		}
+	}
+
+	return out_changedFields.size() - initialSize;
+}
@@ -29,4 +29,29 @@ void Archetype::setAccessSpecifier(EAccessSpecifier accessSpecifier) noexcept
 std::size_t Archetype::getMemorySize() const noexcept
 {
 	return getPimpl()->getMemorySize();
+}
+
+std::size_t Archetype::getMemoryAlignment() const noexcept
+{
+	return getPimpl()->getMemoryAlignment();
+}
+
+void Archetype::setMemoryAlignment(std::size_t alignment) noexcept
+{
+	getPimpl()->setMemoryAlignment(alignment);
+}
+
+EArchetypeTraits Archetype::getTraits() const noexcept
+{
+	return getPimpl()->getTraits();
+}
+
+bool Archetype::hasTraits(EArchetypeTraits traits) const noexcept
+{
+	return (getPimpl()->getTraits() & traits) == traits;
+}
+
+void Archetype::setTraits(EArchetypeTraits traits) noexcept
+{
+	getPimpl()->setTraits(traits);
 }
\ No newline at end of file
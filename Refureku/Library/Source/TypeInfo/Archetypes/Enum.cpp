@@ -1,6 +1,6 @@
 #include "Refureku/TypeInfo/Archetypes/Enum.h"
 
-#include <cstring> //std::strcmp
+#include <algorithm>	//std::min
 
 #include "Refureku/TypeInfo/Archetypes/EnumImpl.h"
 #include "Refureku/Misc/Algorithm.h"
@@ -29,18 +29,21 @@ void Enum::setEnumValuesCapacity(std::size_t capacity) noexcept
 
 EnumValue const* Enum::getEnumValueByName(char const* name) const noexcept
 {
-	return (name != nullptr) ? Algorithm::getItemByPredicate(getPimpl()->getEnumValues(), [name](EnumValue const& ev)
-											   {
-												   return std::strcmp(ev.getName(), name) == 0;
-											   }) : nullptr;
+	if (name == nullptr)
+	{
+		return nullptr;
+	}
+
+	std::size_t index = getPimpl()->getEnumValueIndexByName(name);
+
+	return (index != EnumImpl::invalidIndex) ? &getPimpl()->getEnumValues()[index] : nullptr;
 }
 
 EnumValue const* Enum::getEnumValue(int64 value) const noexcept
 {
-	return Algorithm::getItemByPredicate(getPimpl()->getEnumValues(), [value](EnumValue const& ev)
-											   {
-												   return ev.getValue() == value;
-											   });
+	std::size_t index = getPimpl()->getEnumValueIndex(value);
+
+	return (index != EnumImpl::invalidIndex) ? &getPimpl()->getEnumValues()[index] : nullptr;
 }
 
 EnumValue const* Enum::getEnumValueByPredicate(Predicate<EnumValue> predicate, void* userData) const
@@ -50,10 +53,14 @@ EnumValue const* Enum::getEnumValueByPredicate(Predicate<EnumValue> predicate, v
 
 Vector<EnumValue const*> Enum::getEnumValues(int64 value) const noexcept
 {
-	return Algorithm::getItemsByPredicate(getPimpl()->getEnumValues(), [value](EnumValue const& ev)
-												 {
-													 return ev.getValue() == value;
-												 });
+	Vector<EnumValue const*> result;
+
+	for (std::size_t index = getPimpl()->getEnumValueIndex(value); index != EnumImpl::invalidIndex; index = getPimpl()->getNextSameValueIndex(index))
+	{
+		result.push_back(&getPimpl()->getEnumValues()[index]);
+	}
+
+	return result;
 }
 
 Vector<EnumValue const*> Enum::getEnumValuesByPredicate(Predicate<EnumValue> predicate, void* userData) const
@@ -79,4 +86,101 @@ Archetype const& Enum::getUnderlyingArchetype() const noexcept
 bool Enum::foreachEnumValue(Predicate<EnumValue> visitor, void* userData) const
 {
 	return Algorithm::foreach(getPimpl()->getEnumValues(), visitor, userData);
+}
+
+bool Enum::isFlagEnum() const noexcept
+{
+	return getPimpl()->isFlagEnum();
+}
+
+EnumValue const* Enum::getFlagEnumValue(std::size_t bit) const noexcept
+{
+	std::size_t index = getPimpl()->getFlagEnumValueIndex(bit);
+
+	return (index != EnumImpl::invalidIndex) ? &getPimpl()->getEnumValues()[index] : nullptr;
+}
+
+bool Enum::decomposeFlags(int64 value, Visitor<EnumValue> visitor, void* userData) const
+{
+	if (visitor == nullptr)
+	{
+		return false;
+	}
+
+	if (value == 0)
+	{
+		EnumValue const* zeroValue = getEnumValue(0);
+
+		return zeroValue != nullptr && visitor(*zeroValue, userData);
+	}
+
+	bool result = true;
+
+	for (uint64 bits = getPimpl()->getValueBits(value), bit = 0u; bits != 0u; bits >>= 1, bit++)
+	{
+		if ((bits & 1u) != 0u)
+		{
+			std::size_t index = getPimpl()->getFlagEnumValueIndex(static_cast<std::size_t>(bit));
+
+			if (index == EnumImpl::invalidIndex)
+			{
+				//Keep visiting the other bits
+				result = false;
+			}
+			else if (!visitor(getPimpl()->getEnumValues()[index], userData))
+			{
+				return false;
+			}
+		}
+	}
+
+	return result;
+}
+
+bool Enum::parseFlags(std::string_view flags, int64& out_value) const noexcept
+{
+	int64 result = 0;
+
+	//Trim the whole string so that an empty or blank string gives 0
+	flags.remove_prefix(std::min(flags.find_first_not_of(' '), flags.size()));
+
+	while (!flags.empty())
+	{
+		std::size_t			separatorPos	= flags.find('|');
+		std::string_view	name			= flags.substr(0u, separatorPos);
+
+		name.remove_prefix(std::min(name.find_first_not_of(' '), name.size()));
+		name.remove_suffix(name.size() - std::min(name.find_last_not_of(' ') + 1u, name.size()));
+
+		std::size_t index = getPimpl()->getEnumValueIndexByName(name);
+
+		if (index == EnumImpl::invalidIndex)
+		{
+			return false;
+		}
+
+		result |= getPimpl()->getEnumValues()[index].getValue();
+
+		if (separatorPos == std::string_view::npos)
+		{
+			break;
+		}
+
+		//A trailing separator is missing a name
+		flags.remove_prefix(separatorPos + 1u);
+
+		if (flags.find_first_not_of(' ') == std::string_view::npos)
+		{
+			return false;
+		}
+	}
+
+	out_value = result;
+
+	return true;
+}
+
+void Enum::setFlagEnum(bool isFlagEnum) noexcept
+{
+	getPimpl()->setFlagEnum(isFlagEnum);
 }
\ No newline at end of file
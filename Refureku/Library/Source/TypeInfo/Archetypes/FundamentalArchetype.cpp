@@ -4,8 +4,9 @@
 
 using namespace rfk;
 
-FundamentalArchetype::FundamentalArchetype(char const* name, std::size_t id, std::size_t memorySize) noexcept:
-	Archetype(new FundamentalArchetypeImpl(name, id, memorySize))
+FundamentalArchetype::FundamentalArchetype(char const* name, std::size_t id, std::size_t memorySize,
+										   std::size_t memoryAlignment, EArchetypeTraits traits) noexcept:
+	Archetype(new FundamentalArchetypeImpl(name, id, memorySize, memoryAlignment, traits))
 {
 }
 
@@ -5,13 +5,14 @@
 
 #include "Refureku/TypeInfo/Archetypes/ArchetypeRegisterer.h"
 #include "Refureku/TypeInfo/Archetypes/FundamentalArchetype.h"
+#include "Refureku/Misc/CodeGenerationHelpers.h"
 
 using namespace rfk;
 
 template <>
 Archetype const* rfk::getArchetype<void>() noexcept
 {
-	static FundamentalArchetype archetype("void", std::hash<std::string_view>()("void"), 0u);
+	static FundamentalArchetype archetype("void", std::hash<std::string_view>()("void"), 0u, 0u, EArchetypeTraits::Default);
 
 	return &archetype;
 }
@@ -21,7 +22,7 @@ ArchetypeRegisterer voidRegisterer = *rfk::getArchetype<void>();
 template <>
 Archetype const* rfk::getArchetype<std::nullptr_t>() noexcept
 {
-	static FundamentalArchetype archetype("nullptr_t", std::hash<std::string_view>()("nullptr_t"), sizeof(std::nullptr_t));
+	static FundamentalArchetype archetype("nullptr_t", std::hash<std::string_view>()("nullptr_t"), sizeof(std::nullptr_t), alignof(std::nullptr_t), internal::CodeGenerationHelpers::computeArchetypeTraits<std::nullptr_t>());
 
 	return &archetype;
 }
@@ -31,7 +32,7 @@ ArchetypeRegisterer nullptrRegisterer = *rfk::getArchetype<std::nullptr_t>();
 template <>
 Archetype const* rfk::getArchetype<bool>() noexcept
 {
-	static FundamentalArchetype archetype("bool", std::hash<std::string_view>()("bool"), sizeof(bool));
+	static FundamentalArchetype archetype("bool", std::hash<std::string_view>()("bool"), sizeof(bool), alignof(bool), internal::CodeGenerationHelpers::computeArchetypeTraits<bool>());
 
 	return &archetype;
 }
@@ -41,7 +42,7 @@ ArchetypeRegisterer boolRegisterer = *rfk::getArchetype<bool>();
 template <>
 Archetype const* rfk::getArchetype<char>() noexcept
 {
-	static FundamentalArchetype archetype("char", std::hash<std::string_view>()("char"), sizeof(char));
+	static FundamentalArchetype archetype("char", std::hash<std::string_view>()("char"), sizeof(char), alignof(char), internal::CodeGenerationHelpers::computeArchetypeTraits<char>());
 
 	return &archetype;
 }
@@ -51,7 +52,7 @@ ArchetypeRegisterer charRegisterer = *rfk::getArchetype<char>();
 template <>
 Archetype const* rfk::getArchetype<signed char>() noexcept
 {
-	static FundamentalArchetype archetype("signed char", std::hash<std::string_view>()("signed char"), sizeof(signed char));
+	static FundamentalArchetype archetype("signed char", std::hash<std::string_view>()("signed char"), sizeof(signed char), alignof(signed char), internal::CodeGenerationHelpers::computeArchetypeTraits<signed char>());
 
 	return &archetype;
 }
@@ -61,7 +62,7 @@ ArchetypeRegisterer signedCharRegisterer = *rfk::getArchetype<signed char>();
 template <>
 Archetype const* rfk::getArchetype<unsigned char>() noexcept
 {
-	static FundamentalArchetype archetype("unsigned char", std::hash<std::string_view>()("unsigned char"), sizeof(unsigned char));
+	static FundamentalArchetype archetype("unsigned char", std::hash<std::string_view>()("unsigned char"), sizeof(unsigned char), alignof(unsigned char), internal::CodeGenerationHelpers::computeArchetypeTraits<unsigned char>());
 
 	return &archetype;
 }
@@ -71,7 +72,7 @@ ArchetypeRegisterer ucharRegisterer = *rfk::getArchetype<unsigned char>();
 template <>
 Archetype const* rfk::getArchetype<wchar_t>() noexcept
 {
-	static FundamentalArchetype archetype("wchar", std::hash<std::string_view>()("wchar"), sizeof(wchar_t));
+	static FundamentalArchetype archetype("wchar", std::hash<std::string_view>()("wchar"), sizeof(wchar_t), alignof(wchar_t), internal::CodeGenerationHelpers::computeArchetypeTraits<wchar_t>());
 
 	return &archetype;
 }
@@ -81,7 +82,7 @@ ArchetypeRegisterer wcharRegisterer = *rfk::getArchetype<wchar_t>();
 template <>
 Archetype const* rfk::getArchetype<char16_t>() noexcept
 {
-	static FundamentalArchetype archetype("char16", std::hash<std::string_view>()("char16"), sizeof(char16_t));
+	static FundamentalArchetype archetype("char16", std::hash<std::string_view>()("char16"), sizeof(char16_t), alignof(char16_t), internal::CodeGenerationHelpers::computeArchetypeTraits<char16_t>());
 
 	return &archetype;
 }
@@ -91,7 +92,7 @@ ArchetypeRegisterer char16Registerer = *rfk::getArchetype<char16_t>();
 template <>
 Archetype const* rfk::getArchetype<char32_t>() noexcept
 {
-	static FundamentalArchetype archetype("char32", std::hash<std::string_view>()("char32"), sizeof(char32_t));
+	static FundamentalArchetype archetype("char32", std::hash<std::string_view>()("char32"), sizeof(char32_t), alignof(char32_t), internal::CodeGenerationHelpers::computeArchetypeTraits<char32_t>());
 
 	return &archetype;
 }
@@ -101,7 +102,7 @@ ArchetypeRegisterer char32Registerer = *rfk::getArchetype<char32_t>();
 template <>
 Archetype const* rfk::getArchetype<short>() noexcept
 {
-	static FundamentalArchetype archetype("short", std::hash<std::string_view>()("short"), sizeof(short));
+	static FundamentalArchetype archetype("short", std::hash<std::string_view>()("short"), sizeof(short), alignof(short), internal::CodeGenerationHelpers::computeArchetypeTraits<short>());
 
 	return &archetype;
 }
@@ -111,7 +112,7 @@ ArchetypeRegisterer shortRegisterer = *rfk::getArchetype<short>();
 template <>
 Archetype const* rfk::getArchetype<unsigned short>() noexcept
 {
-	static FundamentalArchetype archetype("unsigned short", std::hash<std::string_view>()("unsigned short"), sizeof(unsigned short));
+	static FundamentalArchetype archetype("unsigned short", std::hash<std::string_view>()("unsigned short"), sizeof(unsigned short), alignof(unsigned short), internal::CodeGenerationHelpers::computeArchetypeTraits<unsigned short>());
 
 	return &archetype;
 }
@@ -121,7 +122,7 @@ ArchetypeRegisterer ushortRegisterer = *rfk::getArchetype<unsigned short>();
 template <>
 Archetype const* rfk::getArchetype<int>() noexcept
 {
-	static FundamentalArchetype archetype("int", std::hash<std::string_view>()("int"), sizeof(int));
+	static FundamentalArchetype archetype("int", std::hash<std::string_view>()("int"), sizeof(int), alignof(int), internal::CodeGenerationHelpers::computeArchetypeTraits<int>());
 
 	return &archetype;
 }
@@ -131,7 +132,7 @@ ArchetypeRegisterer intRegisterer = *rfk::getArchetype<int>();
 template <>
 Archetype const* rfk::getArchetype<unsigned int>() noexcept
 {
-	static FundamentalArchetype archetype("unsigned int", std::hash<std::string_view>()("unsigned int"), sizeof(unsigned int));
+	static FundamentalArchetype archetype("unsigned int", std::hash<std::string_view>()("unsigned int"), sizeof(unsigned int), alignof(unsigned int), internal::CodeGenerationHelpers::computeArchetypeTraits<unsigned int>());
 
 	return &archetype;
 }
@@ -141,7 +142,7 @@ ArchetypeRegisterer uintRegisterer = *rfk::getArchetype<unsigned int>();
 template <>
 Archetype const* rfk::getArchetype<long>() noexcept
 {
-	static FundamentalArchetype archetype("long", std::hash<std::string_view>()("long"), sizeof(long));
+	static FundamentalArchetype archetype("long", std::hash<std::string_view>()("long"), sizeof(long), alignof(long), internal::CodeGenerationHelpers::computeArchetypeTraits<long>());
 
 	return &archetype;
 }
@@ -151,7 +152,7 @@ ArchetypeRegisterer longRegisterer = *rfk::getArchetype<long>();
 template <>
 Archetype const* rfk::getArchetype<unsigned long>() noexcept
 {
-	static FundamentalArchetype archetype("unsigned long", std::hash<std::string_view>()("unsigned long"), sizeof(unsigned long));
+	static FundamentalArchetype archetype("unsigned long", std::hash<std::string_view>()("unsigned long"), sizeof(unsigned long), alignof(unsigned long), internal::CodeGenerationHelpers::computeArchetypeTraits<unsigned long>());
 
 	return &archetype;
 }
@@ -161,7 +162,7 @@ ArchetypeRegisterer ulongRegisterer = *rfk::getArchetype<unsigned long>();
 template <>
 Archetype const* rfk::getArchetype<long long>() noexcept
 {
-	static FundamentalArchetype archetype("long long", std::hash<std::string_view>()("long long"), sizeof(long long));
+	static FundamentalArchetype archetype("long long", std::hash<std::string_view>()("long long"), sizeof(long long), alignof(long long), internal::CodeGenerationHelpers::computeArchetypeTraits<long long>());
 
 	return &archetype;
 }
@@ -171,7 +172,7 @@ ArchetypeRegisterer longLongRegisterer = *rfk::getArchetype<long long>();
 template <>
 Archetype const* rfk::getArchetype<unsigned long long>() noexcept
 {
-	static FundamentalArchetype archetype("unsigned long long", std::hash<std::string_view>()("unsigned long long"), sizeof(unsigned long long));
+	static FundamentalArchetype archetype("unsigned long long", std::hash<std::string_view>()("unsigned long long"), sizeof(unsigned long long), alignof(unsigned long long), internal::CodeGenerationHelpers::computeArchetypeTraits<unsigned long long>());
 
 	return &archetype;
 }
@@ -181,7 +182,7 @@ ArchetypeRegisterer ulongLongRegisterer = *rfk::getArchetype<unsigned long long>
 template <>
 Archetype const* rfk::getArchetype<float>() noexcept
 {
-	static FundamentalArchetype archetype("float", std::hash<std::string_view>()("float"), sizeof(float));
+	static FundamentalArchetype archetype("float", std::hash<std::string_view>()("float"), sizeof(float), alignof(float), internal::CodeGenerationHelpers::computeArchetypeTraits<float>());
 
 	return &archetype;
 }
@@ -191,7 +192,7 @@ ArchetypeRegisterer floatRegisterer = *rfk::getArchetype<float>();
 template <>
 Archetype const* rfk::getArchetype<double>() noexcept
 {
-	static FundamentalArchetype archetype("double", std::hash<std::string_view>()("double"), sizeof(double));
+	static FundamentalArchetype archetype("double", std::hash<std::string_view>()("double"), sizeof(double), alignof(double), internal::CodeGenerationHelpers::computeArchetypeTraits<double>());
 
 	return &archetype;
 }
@@ -201,7 +202,7 @@ ArchetypeRegisterer doubleRegisterer = *rfk::getArchetype<double>();
 template <>
 Archetype const* rfk::getArchetype<long double>() noexcept
 {
-	static FundamentalArchetype archetype("long double", std::hash<std::string_view>()("long double"), sizeof(long double));
+	static FundamentalArchetype archetype("long double", std::hash<std::string_view>()("long double"), sizeof(long double), alignof(long double), internal::CodeGenerationHelpers::computeArchetypeTraits<long double>());
 
 	return &archetype;
 }
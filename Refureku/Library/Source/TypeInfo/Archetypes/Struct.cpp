@@ -1,5 +1,7 @@
 #include "Refureku/TypeInfo/Archetypes/Struct.h"
 
+#include <atomic>
+
 #include "Refureku/TypeInfo/Archetypes/StructImpl.h"
 #include "Refureku/TypeInfo/Archetypes/Enum.h"
 #include "Refureku/Misc/Algorithm.h"
@@ -9,6 +11,9 @@ using namespace rfk;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Allocator<Struct const*>;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<Struct const*, rfk::Allocator<Struct const*>>;
 
+/** Next dense index given to a struct used as a property, see Struct::indexPropertyHierarchy. */
+static std::atomic<std::size_t> nextPropertyIndex{0u};
+
 Struct::Struct(char const* name, std::size_t id, std::size_t memorySize, bool isClass, EClassKind classKind) noexcept:
 	Archetype(new StructImpl(name, id, memorySize, isClass, classKind))
 {
@@ -100,6 +105,47 @@ EClassKind Struct::getClassKind() const noexcept
 	return getPimpl()->getClassKind();
 }
 
+BinarySchema const& Struct::getBinarySchema() const
+{
+	return getPimpl()->getBinarySchema(*this);
+}
+
+DirtyTracker* Struct::getDirtyTracker() const noexcept
+{
+	return getPimpl()->getDirtyTracker();
+}
+
+std::atomic<DirtyTracker*> const& Struct::getDirtyTrackerSlot() const noexcept
+{
+	return getPimpl()->getDirtyTrackerSlot();
+}
+
+uint64 Struct::getPropertySignatureBit() const noexcept
+{
+	std::size_t propertyIndex = getPimpl()->getPropertyIndex();
+
+	//The first 64 property structs get a distinct bit. Beyond that, bits are shared and the signature is only a prefilter
+	return (propertyIndex != StructImpl::invalidPropertyIndex) ? (uint64(1u) << (propertyIndex % 64u)) : 0u;
+}
+
+uint64 Struct::indexPropertyHierarchy() const noexcept
+{
+	if (getPimpl()->getPropertyIndex() == StructImpl::invalidPropertyIndex)
+	{
+		//Several threads can index the same struct at once, the index of the losers is left unused
+		getPimpl()->trySetPropertyIndex(nextPropertyIndex++);
+	}
+
+	uint64 result = getPropertySignatureBit();
+
+	for (ParentStruct const& parent : getPimpl()->getDirectParents())
+	{
+		result |= parent.getArchetype().indexPropertyHierarchy();
+	}
+
+	return result;
+}
+
 bool Struct::getPointerOffset(Struct const& to, std::ptrdiff_t& out_pointerOffset) const noexcept
 {
 	//This method is used for downcast in most cases, so search in the parent first.
@@ -784,6 +830,12 @@ Method* Struct::addMethod(char const* name, std::size_t id, Type const& returnTy
 	return (name != nullptr) ? getPimpl()->addMethod(name, id, returnType, internalMethod, flags, this) : nullptr;
 }
 
+Method* Struct::addMethod(char const* name, std::size_t id, Type const& returnType,
+						  ICallable& internalMethod, EMethodFlags flags) noexcept
+{
+	return (name != nullptr) ? getPimpl()->addMethod(name, id, returnType, internalMethod, flags, this) : nullptr;
+}
+
 void Struct::setMethodsCapacity(std::size_t capacity) noexcept
 {
 	return getPimpl()->setMethodsCapacity(capacity);
@@ -795,6 +847,12 @@ StaticMethod* Struct::addStaticMethod(char const* name, std::size_t id, Type con
 	return (name != nullptr) ? getPimpl()->addStaticMethod(name, id, returnType, internalMethod, flags, this) : nullptr;
 }
 
+StaticMethod* Struct::addStaticMethod(char const* name, std::size_t id, Type const& returnType,
+									  ICallable& internalMethod, EMethodFlags flags) noexcept
+{
+	return (name != nullptr) ? getPimpl()->addStaticMethod(name, id, returnType, internalMethod, flags, this) : nullptr;
+}
+
 void Struct::setStaticMethodsCapacity(std::size_t capacity) noexcept
 {
 	return getPimpl()->setStaticMethodsCapacity(capacity);
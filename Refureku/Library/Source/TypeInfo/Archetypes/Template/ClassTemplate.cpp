@@ -1,5 +1,7 @@
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplate.h"
 
+#include <algorithm>	//std::find
+
 #include "Refureku/TypeInfo/Archetypes/Template/ClassTemplateImpl.h"
 #include "Refureku/TypeInfo/Archetypes/Template/TemplateArgument.h"
 #include "Refureku/Misc/Algorithm.h"
@@ -30,21 +32,75 @@ std::size_t ClassTemplate::getTemplateInstantiationsCount() const noexcept
 
 ClassTemplateInstantiation const* ClassTemplate::getTemplateInstantiation(TemplateArgument const** firstArg, std::size_t argsCount) const noexcept
 {
-	if (firstArg != nullptr)
+	if (firstArg == nullptr || argsCount == 0u)
 	{
-		for (ClassTemplateInstantiation const* instantiation : getPimpl()->getTemplateInstantiations())
+		return nullptr;
+	}
+
+	auto isMatchingInstantiation = [firstArg, argsCount](ClassTemplateInstantiation const& instantiation)
+	{
+		if (instantiation.getTemplateArgumentsCount() < argsCount)
+		{
+			return false;
+		}
+
+		for (std::size_t i = 0u; i < argsCount; i++)
+		{
+			if (firstArg[i] != nullptr && instantiation.getTemplateArgumentAt(i) != *firstArg[i])
+			{
+				return false;
+			}
+		}
+
+		return true;
+	};
+
+	ClassTemplateImpl const& pimpl = *getPimpl();
+
+	//Find the first non-wildcard argument
+	std::size_t firstNonNullArgIndex = 0u;
+
+	while (firstNonNullArgIndex < argsCount && firstArg[firstNonNullArgIndex] == nullptr)
+	{
+		firstNonNullArgIndex++;
+	}
+
+	if (firstNonNullArgIndex == argsCount)
+	{
+		//Only wildcards: any instantiation with enough template arguments matches
+		for (ClassTemplateInstantiation const* instantiation : pimpl.getTemplateInstantiations())
+		{
+			if (isMatchingInstantiation(*instantiation))
+			{
+				return instantiation;
+			}
+		}
+	}
+	else if (firstNonNullArgIndex == 0u && std::find(firstArg, firstArg + argsCount, nullptr) == firstArg + argsCount &&
+			 argsCount == pimpl.getMaxTemplateArgumentsCount())
+	{
+		//No wildcard and all template arguments provided: look the whole argument list up
+		auto range = pimpl.getInstantiationsByArguments().equal_range(ClassTemplateImpl::computeTemplateArgumentsHash(firstArg, argsCount));
+
+		for (auto it = range.first; it != range.second; it++)
+		{
+			if (isMatchingInstantiation(*it->second))
+			{
+				return it->second;
+			}
+		}
+	}
+	else if (firstNonNullArgIndex < pimpl.getInstantiationsByArgumentAt().size())
+	{
+		//Wildcards or partial argument list: look the first non-wildcard argument up and check the others
+		auto range = pimpl.getInstantiationsByArgumentAt()[firstNonNullArgIndex].equal_range(
+						ClassTemplateImpl::computeTemplateArgumentHash(*firstArg[firstNonNullArgIndex]));
+
+		for (auto it = range.first; it != range.second; it++)
 		{
-			for (std::size_t i = 0u; i < argsCount; i++)
+			if (isMatchingInstantiation(*it->second))
 			{
-				if (*(firstArg + i) != nullptr && instantiation->getTemplateArgumentAt(i) != **(firstArg + i))
-				{
-					break;
-				}
-				else if (i == argsCount - 1)
-				{
-					//If we reach this point, last 2 template arguments are equal
-					return instantiation;
-				}
+				return it->second;
 			}
 		}
 	}
@@ -42,5 +42,10 @@ std::size_t ClassTemplateInstantiation::getTemplateArgumentsCount() const noexce
 
 void ClassTemplateInstantiation::addTemplateArgument(TemplateArgument const& argument) noexcept
 {
+	ClassTemplate& classTemplate = const_cast<ClassTemplate&>(getPimpl()->getClassTemplate());
+
+	//The class template indexes its instantiations by template arguments, so reindex this instantiation
+	classTemplate.unregisterTemplateInstantiation(*this);
 	getPimpl()->addTemplateArgument(argument);
+	classTemplate.registerTemplateInstantiation(*this);
 }
\ No newline at end of file
@@ -326,6 +326,121 @@ EnumValue const* Database::getEnumValueById(std::size_t id) const noexcept
 	return enumValueCast(getEntityById(id));
 }
 
+DispatchTable const& Database::getDispatchTable(Struct const& propertyArchetype) const
+{
+	return _pimpl->getOrCreateDispatchTable(propertyArchetype);
+}
+
+namespace
+{
+	/**
+	*	@brief	Check whether an entity indexed under a property archetype must be visited by a property query.
+	*			When child classes are valid, an entity carrying several matching properties is only accepted
+	*			under the archetype of its first matching property so that it is visited once.
+	*/
+	bool isMatchingIndexedEntity(Entity const& entity, Struct const& indexedArchetype, Struct const& propertyArchetype,
+								 bool isChildClassValid, EEntityKind kindFilter) noexcept
+	{
+		if (kindFilter != EEntityKind::Undefined && (entity.getKind() & kindFilter) == EEntityKind::Undefined)
+		{
+			return false;
+		}
+
+		return !isChildClassValid || &entity.getProperty(propertyArchetype, true)->getArchetype() == &indexedArchetype;
+	}
+}
+
+bool Database::foreachEntityWithProperty(Struct const& propertyArchetype, Visitor<Entity> visitor, void* userData,
+										 bool isChildClassValid, EEntityKind kindFilter) const
+{
+	if (visitor == nullptr)
+	{
+		return false;
+	}
+
+	DatabaseImpl::EntitiesByProperty const& entitiesByProperty = _pimpl->getEntitiesByProperty();
+
+	if (!isChildClassValid)
+	{
+		auto it = entitiesByProperty.find(&propertyArchetype);
+
+		if (it != entitiesByProperty.cend())
+		{
+			for (Entity const* entity : it->second)
+			{
+				if (isMatchingIndexedEntity(*entity, propertyArchetype, propertyArchetype, false, kindFilter) && !visitor(*entity, userData))
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	for (auto const& [indexedArchetype, entities] : entitiesByProperty)
+	{
+		if (propertyArchetype.isBaseOf(*indexedArchetype))
+		{
+			for (Entity const* entity : entities)
+			{
+				if (isMatchingIndexedEntity(*entity, *indexedArchetype, propertyArchetype, true, kindFilter) && !visitor(*entity, userData))
+				{
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+std::size_t Database::getEntitiesWithPropertyCount(Struct const& propertyArchetype, bool isChildClassValid, EEntityKind kindFilter) const noexcept
+{
+	DatabaseImpl::EntitiesByProperty const&	entitiesByProperty	= _pimpl->getEntitiesByProperty();
+	std::size_t								result				= 0u;
+
+	if (!isChildClassValid)
+	{
+		auto it = entitiesByProperty.find(&propertyArchetype);
+
+		if (it == entitiesByProperty.cend())
+		{
+			return 0u;
+		}
+		else if (kindFilter == EEntityKind::Undefined)
+		{
+			return it->second.size();
+		}
+
+		for (Entity const* entity : it->second)
+		{
+			if (isMatchingIndexedEntity(*entity, propertyArchetype, propertyArchetype, false, kindFilter))
+			{
+				result++;
+			}
+		}
+
+		return result;
+	}
+
+	for (auto const& [indexedArchetype, entities] : entitiesByProperty)
+	{
+		if (propertyArchetype.isBaseOf(*indexedArchetype))
+		{
+			for (Entity const* entity : entities)
+			{
+				if (isMatchingIndexedEntity(*entity, *indexedArchetype, propertyArchetype, true, kindFilter))
+				{
+					result++;
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
 Database const& rfk::getDatabase() noexcept
 {
 	return Database::getInstance();
@@ -0,0 +1,38 @@
+#include "Refureku/TypeInfo/DispatchTable.h"
+
+#include "Refureku/TypeInfo/Functions/MethodBase.h"
+
+using namespace rfk;
+
+DispatchTable::DispatchTable(Struct const& propertyArchetype) noexcept:
+	_propertyArchetype{&propertyArchetype}
+{
+}
+
+void DispatchTable::addIfMatching(FunctionBase const& function)
+{
+	Property const* property = function.getProperty(*_propertyArchetype);
+
+	if (property != nullptr)
+	{
+		_entries.push_back(DispatchTableEntry{	&function,
+												property,
+												function.getErasedCallThunk(),
+												function.getKind() == EEntityKind::Method && !static_cast<MethodBase const&>(function).isStatic() });
+	}
+}
+
+void DispatchTable::remove(FunctionBase const& function) noexcept
+{
+	for (std::size_t i = 0u; i < _entries.size(); i++)
+	{
+		if (_entries[i].function == &function)
+		{
+			//Fill the hole with the last entry to keep the entries dense
+			_entries[i] = _entries.back();
+			_entries.resize(_entries.size() - 1u);
+
+			return;
+		}
+	}
+}
@@ -24,6 +24,12 @@ Property const* Entity::getPropertyAt(std::size_t propertyIndex) const noexcept
 
 Property const* Entity::getProperty(Struct const& archetype, bool isChildClassValid) const noexcept
 {
+	//No property of this entity inherits from archetype
+	if ((_pimpl->getPropertiesSignature() & archetype.getPropertySignatureBit()) == 0u)
+	{
+		return nullptr;
+	}
+
 	//Iterate over all props to find a matching property
 	if (isChildClassValid)
 	{
@@ -53,6 +59,11 @@ Property const* Entity::getProperty(Struct const& archetype, bool isChildClassVa
 
 Property const* Entity::getPropertyByName(char const* name) const noexcept
 {
+	if (name == nullptr || (_pimpl->getPropertyNamesSignature() & EntityImpl::getNameSignatureBit(name)) == 0u)
+	{
+		return nullptr;
+	}
+
 	return getPropertyByPredicate([](Property const& prop, void* userData)
 								  {
 									  return prop.getArchetype().hasSameName(*reinterpret_cast<char const**>(userData)); 
@@ -68,6 +79,12 @@ Vector<Property const*> Entity::getProperties(Struct const& archetype, bool isCh
 {
 	Vector<Property const*> result;
 
+	//No property of this entity inherits from archetype
+	if ((_pimpl->getPropertiesSignature() & archetype.getPropertySignatureBit()) == 0u)
+	{
+		return result;
+	}
+
 	//Iterate over all props to find a matching property
 	if (isChildClassValid)
 	{
@@ -97,6 +114,11 @@ Vector<Property const*> Entity::getProperties(Struct const& archetype, bool isCh
 
 Vector<Property const*> Entity::getPropertiesByName(char const* name) const noexcept
 {
+	if (name == nullptr || (_pimpl->getPropertyNamesSignature() & EntityImpl::getNameSignatureBit(name)) == 0u)
+	{
+		return Vector<Property const*>();
+	}
+
 	return getPropertiesByPredicate([](Property const& prop, void* userData)
 									{
 										return prop.getArchetype().hasSameName(*reinterpret_cast<char const**>(userData)); 
@@ -1,6 +1,7 @@
 #include "Refureku/TypeInfo/Functions/Function.h"
 
 #include <type_traits>	//std::underlying_type_t
+#include <cassert>
 
 #include "Refureku/TypeInfo/Functions/FunctionImpl.h"
 
@@ -12,12 +13,24 @@ template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<Function const*, rfk::Alloc
 using EFunctionFlagsUnderlyingType = std::underlying_type_t<EFunctionFlags>;
 
 Function::Function(char const* name, std::size_t id, Type const& returnType, ICallable* internalFunction, EFunctionFlags flags) noexcept:
-	FunctionBase(new FunctionImpl(name, id, returnType, internalFunction, flags))
+	FunctionBase(new FunctionImpl(name, id, returnType, internalFunction, true, flags))
+{
+}
+
+Function::Function(char const* name, std::size_t id, Type const& returnType, ICallable& internalFunction, EFunctionFlags flags) noexcept:
+	FunctionBase(new FunctionImpl(name, id, returnType, &internalFunction, false, flags))
 {
 }
 
 Function::~Function() noexcept = default;
 
+void Function::invokeErased(void* const* args, void* returnValue) const
+{
+	assert(canInvokeErased());
+
+	getErasedCallThunk()(nullptr, args, returnValue);
+}
+
 bool Function::isInline() const noexcept
 {
 	return static_cast<EFunctionFlagsUnderlyingType>(getFlags() & EFunctionFlags::Inline) != static_cast<EFunctionFlagsUnderlyingType>(0);
@@ -74,6 +74,31 @@ ICallable* FunctionBase::getInternalFunction() const noexcept
 	return getPimpl()->getInternalFunction();
 }
 
+ErasedCallThunk FunctionBase::getErasedCallThunk() const noexcept
+{
+	return getPimpl()->getErasedCallThunk();
+}
+
+bool FunctionBase::canInvokeErased() const noexcept
+{
+	return getPimpl()->getErasedCallThunk() != nullptr;
+}
+
+void FunctionBase::setErasedCallThunk(ErasedCallThunk thunk) noexcept
+{
+	getPimpl()->setErasedCallThunk(thunk);
+}
+
+NativeEntryPoint const* FunctionBase::getNativeEntryPoint() const noexcept
+{
+	return getPimpl()->getNativeEntryPoint();
+}
+
+void FunctionBase::setNativeEntryPoint(NativeEntryPoint const* entryPoint) noexcept
+{
+	getPimpl()->setNativeEntryPoint(entryPoint);
+}
+
 void FunctionBase::throwArgCountMismatchException(std::size_t received) const
 {
 	throw ArgCountMismatch("Tried to call " + std::string(getName()) + " with " + std::to_string(received) + " arguments but " + std::to_string(getParametersCount()) + " were expected.");
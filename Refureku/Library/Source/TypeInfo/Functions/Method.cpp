@@ -14,7 +14,13 @@ template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<Method const*, rfk::Allocat
 
 Method::Method(char const* name, std::size_t id, Type const& returnType,
 					 ICallable* internalMethod, EMethodFlags flags, Entity const* outerEntity) noexcept:
-	MethodBase(new MethodImpl(name, id, returnType, internalMethod, flags, outerEntity))
+	MethodBase(new MethodImpl(name, id, returnType, internalMethod, true, flags, outerEntity))
+{
+}
+
+Method::Method(char const* name, std::size_t id, Type const& returnType,
+			   ICallable& internalMethod, EMethodFlags flags, Entity const* outerEntity) noexcept:
+	MethodBase(new MethodImpl(name, id, returnType, &internalMethod, false, flags, outerEntity))
 {
 }
 
@@ -61,6 +67,26 @@ void Method::inheritBaseMethodProperties() noexcept
 	}
 }
 
+void Method::invokeErasedUnsafe(void* caller, void* const* args, void* returnValue) const
+{
+	assert(canInvokeErased());
+
+	getErasedCallThunk()(caller, args, returnValue);
+}
+
+void Method::invokeErasedUnsafe(void const* caller, void* const* args, void* returnValue) const
+{
+	if (!isConst())
+	{
+		throwConstViolationException();
+	}
+
+	assert(canInvokeErased());
+
+	//The thunk of a const method never writes through the caller pointer
+	getErasedCallThunk()(const_cast<void*>(caller), args, returnValue);
+}
+
 void Method::throwConstViolationException() const
 {
 	throw ConstViolation("Can't call a non-const member function on a const caller instance.");
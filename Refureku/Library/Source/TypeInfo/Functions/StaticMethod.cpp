@@ -1,5 +1,7 @@
 #include "Refureku/TypeInfo/Functions/StaticMethod.h"
 
+#include <cassert>
+
 #include "Refureku/TypeInfo/Functions/StaticMethodImpl.h"
 
 using namespace rfk;
@@ -9,10 +11,23 @@ template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<StaticMethod const*, rfk::A
 
 StaticMethod::StaticMethod(char const* name, std::size_t id, Type const& returnType,
 								 ICallable* internalMethod, EMethodFlags flags, Entity const* outerEntity) noexcept:
-	MethodBase(new StaticMethodImpl(name, id, returnType, internalMethod, flags, outerEntity))
+	MethodBase(new StaticMethodImpl(name, id, returnType, internalMethod, true, flags, outerEntity))
+{
+}
+
+StaticMethod::StaticMethod(char const* name, std::size_t id, Type const& returnType,
+						   ICallable& internalMethod, EMethodFlags flags, Entity const* outerEntity) noexcept:
+	MethodBase(new StaticMethodImpl(name, id, returnType, &internalMethod, false, flags, outerEntity))
 {
 }
 
 StaticMethod::StaticMethod(StaticMethod&&) noexcept = default;
 
-StaticMethod::~StaticMethod() noexcept = default;
\ No newline at end of file
+StaticMethod::~StaticMethod() noexcept = default;
+
+void StaticMethod::invokeErased(void* const* args, void* returnValue) const
+{
+	assert(canInvokeErased());
+
+	getErasedCallThunk()(nullptr, args, returnValue);
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include "Refureku/TypeInfo/MetadataArena.h"
+
+#include <mutex>
+#include <atomic>
+
+#include "Refureku/TypeInfo/MetadataArenaImpl.h"
+
+using namespace rfk;
+
+namespace
+{
+	/** Mutex protecting the state of all arenas. Arenas are only used at registration, so contention is not a concern. */
+	std::mutex					arenasMutex;
+
+	/** Number of metadata objects allocated from the heap. */
+	std::atomic<std::size_t>	heapAllocationsCount{0u};
+}
+
+MetadataArena::MetadataArena():
+	_pimpl{new MetadataArenaImpl()}
+{
+}
+
+MetadataArena::~MetadataArena() noexcept
+{
+	std::lock_guard lock(arenasMutex);
+
+	//If metadata allocated from this arena is still alive, the state is deleted with the last of these objects
+	if (_pimpl->releaseArena())
+	{
+		delete _pimpl;
+	}
+}
+
+void MetadataArena::reserveEntities(EEntityKind entityKind, std::size_t count) noexcept
+{
+	std::lock_guard lock(arenasMutex);
+
+	_pimpl->reserve(MetadataArenaImpl::computeFootprint(MetadataArenaImpl::getEntityImplSize(entityKind)) * count);
+}
+
+MetadataAllocationStatistics MetadataArena::getStatistics() const noexcept
+{
+	std::lock_guard lock(arenasMutex);
+
+	return _pimpl->getStatistics();
+}
+
+MetadataAllocationStatistics MetadataArena::getGlobalStatistics() noexcept
+{
+	MetadataAllocationStatistics result;
+
+	{
+		std::lock_guard lock(arenasMutex);
+
+		result = MetadataArenaImpl::getGlobalStatistics();
+	}
+
+	result.heapAllocationsCount = heapAllocationsCount.load(std::memory_order_relaxed);
+
+	return result;
+}
+
+void* MetadataArena::allocate(std::size_t size)
+{
+	MetadataArenaImpl*					currentArena = MetadataArenaImpl::getCurrentArena();
+	MetadataArenaImpl::AllocationHeader*	header;
+
+	if (currentArena != nullptr)
+	{
+		std::lock_guard lock(arenasMutex);
+
+		header = currentArena->allocate(size);
+	}
+	else
+	{
+		header = new (::operator new(sizeof(MetadataArenaImpl::AllocationHeader) + size)) MetadataArenaImpl::AllocationHeader{nullptr};
+
+		heapAllocationsCount.fetch_add(1u, std::memory_order_relaxed);
+	}
+
+	return header + 1;
+}
+
+void MetadataArena::deallocate(void* ptr) noexcept
+{
+	if (ptr == nullptr)
+	{
+		return;
+	}
+
+	MetadataArenaImpl::AllocationHeader* header = static_cast<MetadataArenaImpl::AllocationHeader*>(ptr) - 1;
+
+	if (header->arena == nullptr)
+	{
+		::operator delete(header);
+	}
+	else
+	{
+		std::lock_guard lock(arenasMutex);
+
+		//The last object of an arena which has already been destroyed releases the whole arena memory
+		if (header->arena->release())
+		{
+			delete header->arena;
+		}
+	}
+}
+
+MetadataArenaScope::MetadataArenaScope(MetadataArena& arena) noexcept:
+	_previousArena{MetadataArena::MetadataArenaImpl::getCurrentArena()},
+	_isOpen{true}
+{
+	MetadataArena::MetadataArenaImpl::setCurrentArena(arena._pimpl);
+}
+
+MetadataArenaScope::MetadataArenaScope(std::nullptr_t) noexcept:
+	_previousArena{MetadataArena::MetadataArenaImpl::getCurrentArena()},
+	_isOpen{true}
+{
+	MetadataArena::MetadataArenaImpl::setCurrentArena(nullptr);
+}
+
+MetadataArenaScope::~MetadataArenaScope() noexcept
+{
+	close();
+}
+
+void MetadataArenaScope::close() noexcept
+{
+	if (_isOpen)
+	{
+		MetadataArena::MetadataArenaImpl::setCurrentArena(_previousArena);
+		_isOpen = false;
+	}
+}
\ No newline at end of file
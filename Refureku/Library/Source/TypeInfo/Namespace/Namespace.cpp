@@ -257,12 +257,22 @@ Function const* Namespace::getFunctionByName(char const* name, EFunctionFlags fl
 
 Vector<Function const*> Namespace::getFunctionsByName(char const* name, EFunctionFlags flags) const noexcept
 {
-	return Algorithm::getEntitiesByNameAndPredicate(getPimpl()->getFunctions(),
-														name,
-														[flags](Function const& func)
-														{
-															return (func.getFlags() & flags) == flags;
-														});
+	Vector<Function const*> result;
+
+	if (name != nullptr)
+	{
+		getPimpl()->getFunctions().foreachEntityNamed(name, [&result, flags](Function const& func)
+													  {
+														  if ((func.getFlags() & flags) == flags)
+														  {
+															  result.push_back(&func);
+														  }
+
+														  return true;
+													  });
+	}
+
+	return result;
 }
 
 Function const* Namespace::getFunctionByPredicate(Predicate<Function> predicate, void* userData) const
@@ -327,6 +337,11 @@ void Namespace::addFunction(Function const& function) noexcept
 	getPimpl()->addFunction(function);
 }
 
+void Namespace::reserveMembers(std::size_t namespacesCount, std::size_t archetypesCount, std::size_t variablesCount, std::size_t functionsCount) noexcept
+{
+	getPimpl()->reserveMembers(namespacesCount, archetypesCount, variablesCount, functionsCount);
+}
+
 void Namespace::removeNamespace(Namespace const& nestedNamespace) noexcept
 {
 	getPimpl()->removeNamespace(nestedNamespace);
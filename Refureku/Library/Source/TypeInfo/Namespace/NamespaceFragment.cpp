@@ -43,6 +43,11 @@ bool NamespaceFragment::foreachNestedEntity(Visitor<Entity> visitor, void* userD
 	return Algorithm::foreach(getPimpl()->getNestedEntities(), visitor, userData);
 }
 
+void NamespaceFragment::mergeFragment() const noexcept
+{
+	getPimpl()->mergeFragment();
+}
+
 void NamespaceFragment::unmergeFragment() const noexcept
 {
 	getPimpl()->unmergeFragment();
@@ -0,0 +1,68 @@
+#include "Refureku/TypeInfo/Variables/DirtyTracker.h"
+
+#include "Refureku/TypeInfo/Variables/DirtyTrackerImpl.h"
+#include "Refureku/TypeInfo/Archetypes/StructImpl.h"
+
+using namespace rfk;
+
+DirtyTracker::DirtyTracker(Struct const& archetype) noexcept:
+	_pimpl{new DirtyTrackerImpl(archetype)}
+{
+	const_cast<Struct&>(archetype).getPimpl()->setDirtyTracker(this);
+}
+
+DirtyTracker::~DirtyTracker() noexcept
+{
+	//Don't detach a tracker which replaced this one
+	const_cast<Struct&>(_pimpl->getArchetype()).getPimpl()->detachDirtyTracker(this);
+}
+
+void DirtyTracker::markDirty(void const* instance, std::size_t fieldIndex)
+{
+	_pimpl->markDirty(instance, fieldIndex);
+}
+
+void DirtyTracker::markDirty(void const* instance, Field const& field)
+{
+	_pimpl->markDirty(instance, field.getIndex());
+}
+
+bool DirtyTracker::isDirty(void const* instance, std::size_t fieldIndex) const noexcept
+{
+	return _pimpl->isDirty(instance, fieldIndex);
+}
+
+bool DirtyTracker::isDirty(void const* instance) const noexcept
+{
+	return _pimpl->isDirty(instance);
+}
+
+bool DirtyTracker::foreachDirtyField(void const* instance, Visitor<Field> visitor, void* userData) const
+{
+	return _pimpl->foreachDirtyField(instance, visitor, userData);
+}
+
+std::size_t DirtyTracker::getDirtyInstancesCount() const noexcept
+{
+	return _pimpl->getDirtyInstances().size();
+}
+
+void const* DirtyTracker::getDirtyInstanceAt(std::size_t index) const noexcept
+{
+	return _pimpl->getDirtyInstances()[index];
+}
+
+void DirtyTracker::clearDirty(void const* instance) noexcept
+{
+	_pimpl->clearDirty(instance);
+}
+
+void DirtyTracker::clearAllDirty() noexcept
+{
+	_pimpl->clearAllDirty();
+}
+
+Struct const& DirtyTracker::getArchetype() const noexcept
+{
+	return _pimpl->getArchetype();
+}
@@ -1,6 +1,8 @@
 #include "Refureku/TypeInfo/Variables/Field.h"
 
 #include "Refureku/TypeInfo/Variables/FieldImpl.h"
+#include "Refureku/TypeInfo/Variables/DirtyTracker.h"
+#include "Refureku/TypeInfo/Archetypes/Struct.h"
 
 using namespace rfk;
 
@@ -8,8 +10,9 @@ template class REFUREKU_TEMPLATE_API_DEF rfk::Allocator<Field const*>;
 template class REFUREKU_TEMPLATE_API_DEF rfk::Vector<Field const*, rfk::Allocator<Field const*>>;
 
 Field::Field(char const* name, std::size_t id, Type const& type, EFieldFlags flags,
-				   Struct const* owner, std::size_t memoryOffset, Entity const* outerEntity) noexcept:
-	FieldBase(new FieldImpl(name, id, type, flags, owner, memoryOffset, outerEntity))
+				   Struct const* owner, std::size_t memoryOffset, std::size_t index, Entity const* outerEntity) noexcept:
+	FieldBase(new FieldImpl(name, id, type, flags, owner, memoryOffset, index, outerEntity)),
+	_dirtyTracker{&owner->getDirtyTrackerSlot()}
 {
 }
 
@@ -22,9 +25,59 @@ std::size_t	Field::getMemoryOffset() const noexcept
 	return getPimpl()->getMemoryOffset();
 }
 
+std::size_t Field::getIndex() const noexcept
+{
+	return getPimpl()->getIndex();
+}
+
+void Field::markDirty(void const* instance) const
+{
+	DirtyTracker* tracker = _dirtyTracker->load(std::memory_order_acquire);
+
+	if (tracker != nullptr)
+	{
+		tracker->markDirty(instance, getIndex());
+	}
+}
+
+void Field::markDirty(void const* firstInstance, std::size_t instancesCount, std::size_t stride) const
+{
+	DirtyTracker* tracker = _dirtyTracker->load(std::memory_order_acquire);
+
+	if (tracker != nullptr)
+	{
+		std::size_t index = getIndex();
+
+		for (std::size_t i = 0u; i < instancesCount; i++)
+		{
+			tracker->markDirty(reinterpret_cast<uint8 const*>(firstInstance) + i * stride, index);
+		}
+	}
+}
+
+void Field::markDirty(void const* const* instances, std::size_t instancesCount) const
+{
+	DirtyTracker* tracker = _dirtyTracker->load(std::memory_order_acquire);
+
+	if (tracker != nullptr)
+	{
+		std::size_t index = getIndex();
+
+		for (std::size_t i = 0u; i < instancesCount; i++)
+		{
+			tracker->markDirty(instances[i], index);
+		}
+	}
+}
+
 void Field::setUnsafe(void* instance, void const* valuePtr, std::size_t valueSize) const
 {
 	FieldBase::set(getPtrUnsafe(instance), valuePtr, valueSize);
+
+	if (RFK_UNLIKELY(isDirtyTracked()))
+	{
+		markDirty(instance);
+	}
 }
 
 void* Field::getPtrUnsafe(void* instance) const
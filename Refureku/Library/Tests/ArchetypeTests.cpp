@@ -136,6 +136,64 @@ TEST(Rfk_Archetype_getMemorySize, Enum)
 	EXPECT_EQ(rfk::getEnum<TestEnumClass>()->getMemorySize(), sizeof(TestEnumClass));
 }
 
+//=========================================================
+//============ Archetype::getMemoryAlignment ==============
+//=========================================================
+
+TEST(Rfk_Archetype_getMemoryAlignment, FundamentalType)
+{
+	EXPECT_EQ(rfk::getArchetype<void>()->getMemoryAlignment(), 0u);
+	EXPECT_EQ(rfk::getArchetype<bool>()->getMemoryAlignment(), alignof(bool));
+	EXPECT_EQ(rfk::getArchetype<int>()->getMemoryAlignment(), alignof(int));
+	EXPECT_EQ(rfk::getArchetype<double>()->getMemoryAlignment(), alignof(double));
+	EXPECT_EQ(rfk::getArchetype<long double>()->getMemoryAlignment(), alignof(long double));
+}
+
+TEST(Rfk_Archetype_getMemoryAlignment, StructClass)
+{
+	EXPECT_EQ(rfk::getArchetype<TestClass>()->getMemoryAlignment(), alignof(TestClass));
+}
+
+TEST(Rfk_Archetype_getMemoryAlignment, ClassTemplateInstantiation)
+{
+	EXPECT_EQ(rfk::getArchetype<SingleTypeTemplateClassTemplate<int>>()->getMemoryAlignment(), alignof(SingleTypeTemplateClassTemplate<int>));
+}
+
+TEST(Rfk_Archetype_getMemoryAlignment, Enum)
+{
+	EXPECT_EQ(rfk::getEnum<TestEnum>()->getMemoryAlignment(), alignof(TestEnum));
+	EXPECT_EQ(rfk::getEnum<TestEnumClass>()->getMemoryAlignment(), alignof(TestEnumClass));
+}
+
+//=========================================================
+//================= Archetype::getTraits ==================
+//=========================================================
+
+TEST(Rfk_Archetype_getTraits, FundamentalType)
+{
+	EXPECT_EQ(rfk::getArchetype<void>()->getTraits(), rfk::EArchetypeTraits::Default);
+	EXPECT_TRUE(rfk::getArchetype<int>()->hasTraits(rfk::EArchetypeTraits::TriviallyCopyable | rfk::EArchetypeTraits::TriviallyDestructible |
+													rfk::EArchetypeTraits::DefaultConstructible | rfk::EArchetypeTraits::TriviallyConstructible |
+													rfk::EArchetypeTraits::StandardLayout));
+	EXPECT_FALSE(rfk::getArchetype<int>()->hasTraits(rfk::EArchetypeTraits::Polymorphic));
+}
+
+TEST(Rfk_Archetype_getTraits, StructClass)
+{
+	rfk::Archetype const* archetype = rfk::getArchetype<TestClass>();
+
+	EXPECT_EQ(archetype->hasTraits(rfk::EArchetypeTraits::TriviallyCopyable), std::is_trivially_copyable_v<TestClass>);
+	EXPECT_EQ(archetype->hasTraits(rfk::EArchetypeTraits::TriviallyDestructible), std::is_trivially_destructible_v<TestClass>);
+	EXPECT_EQ(archetype->hasTraits(rfk::EArchetypeTraits::DefaultConstructible), std::is_default_constructible_v<TestClass>);
+	EXPECT_EQ(archetype->hasTraits(rfk::EArchetypeTraits::StandardLayout), std::is_standard_layout_v<TestClass>);
+	EXPECT_EQ(archetype->hasTraits(rfk::EArchetypeTraits::Polymorphic), std::is_polymorphic_v<TestClass>);
+}
+
+TEST(Rfk_Archetype_getTraits, Enum)
+{
+	EXPECT_EQ(rfk::getEnum<TestEnum>()->getTraits(), rfk::getEnum<TestEnum>()->getUnderlyingArchetype().getTraits());
+}
+
 //=========================================================
 //============ Archetype::setAccessSpecifier ==============
 //=========================================================
@@ -0,0 +1,173 @@
+#include <vector>
+#include <algorithm>	//std::copy
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+
+#include "TestSerialization.h"
+
+//=========================================================
+//==================== BinarySchema =======================
+//=========================================================
+
+TEST(Rfk_BinarySchema, SkipUnserializableFields)
+{
+	rfk::BinarySchema const& schema = TestSerializationStruct::staticGetArchetype().getBinarySchema();
+
+	//intField, enumField, doubleArray, position, path
+	EXPECT_EQ(schema.getFields().size(), 5u);
+	EXPECT_EQ(&schema.getArchetype(), &TestSerializationStruct::staticGetArchetype());
+}
+
+TEST(Rfk_BinarySchema, SameSchemaForSameStruct)
+{
+	EXPECT_EQ(&TestSerializationStruct::staticGetArchetype().getBinarySchema(), &TestSerializationStruct::staticGetArchetype().getBinarySchema());
+	EXPECT_NE(TestSerializationStruct::staticGetArchetype().getBinarySchema().getId(), TestSerializationVector::staticGetArchetype().getBinarySchema().getId());
+}
+
+TEST(Rfk_BinarySchema, NestedRecordSize)
+{
+	rfk::BinarySchema const& schema = TestSerializationVector::staticGetArchetype().getBinarySchema();
+
+	EXPECT_EQ(schema.getRecordSize(), rfk::BinarySchema::headerSize + 2u * rfk::BinarySchema::fieldEntrySize + 2u * sizeof(float));
+
+	//x and y are adjacent so they are copied at once
+	EXPECT_EQ(schema.getOps().size(), 1u);
+}
+
+//=========================================================
+//=================== serializeBinary =====================
+//=========================================================
+
+TEST(Rfk_serializeBinary, BufferTooSmall)
+{
+	TestSerializationStruct	instance;
+	unsigned char			buffer[8];
+
+	EXPECT_EQ(rfk::serializeBinary(TestSerializationStruct::staticGetArchetype(), &instance, buffer, sizeof(buffer)), 0u);
+}
+
+TEST(Rfk_serializeBinary, SinkReceivesSameBytesAsBuffer)
+{
+	TestSerializationStruct		instance;
+	std::vector<unsigned char>	buffer(TestSerializationStruct::staticGetArchetype().getBinarySchema().getRecordSize());
+	std::vector<unsigned char>	stream;
+
+	instance.intField = 1;
+
+	EXPECT_EQ(rfk::serializeBinary(TestSerializationStruct::staticGetArchetype(), &instance, buffer.data(), buffer.size()), buffer.size());
+
+	rfk::serializeBinary(TestSerializationStruct::staticGetArchetype(), &instance, [&stream](void const* data, std::size_t size)
+						 {
+							 stream.insert(stream.end(), static_cast<unsigned char const*>(data), static_cast<unsigned char const*>(data) + size);
+						 });
+
+	EXPECT_EQ(stream, buffer);
+}
+
+//=========================================================
+//================== deserializeBinary ====================
+//=========================================================
+
+TEST(Rfk_deserializeBinary, RoundTrip)
+{
+	TestSerializationStruct		instance;
+	TestSerializationStruct		result;
+	std::vector<unsigned char>	buffer(TestSerializationStruct::staticGetArchetype().getBinarySchema().getRecordSize());
+
+	instance.intField		= 1;
+	instance.enumField		= TestEnumClass::Value3;
+	instance.doubleArray[1]	= 2.0;
+	instance.position.y		= 3.0f;
+	instance.path[1].x		= 4.0f;
+	instance.pointerField	= &instance.intField;
+
+	rfk::serializeBinary(TestSerializationStruct::staticGetArchetype(), &instance, buffer.data(), buffer.size());
+
+	EXPECT_EQ(rfk::deserializeBinary(TestSerializationStruct::staticGetArchetype(), &result, buffer.data(), buffer.size()), buffer.size());
+	EXPECT_EQ(result.intField, 1);
+	EXPECT_EQ(result.enumField, TestEnumClass::Value3);
+	EXPECT_EQ(result.doubleArray[1], 2.0);
+	EXPECT_EQ(result.position.y, 3.0f);
+	EXPECT_EQ(result.path[1].x, 4.0f);
+	EXPECT_EQ(result.pointerField, nullptr);
+}
+
+TEST(Rfk_deserializeBinary, TruncatedRecord)
+{
+	TestSerializationStruct		instance;
+	std::vector<unsigned char>	buffer(TestSerializationStruct::staticGetArchetype().getBinarySchema().getRecordSize());
+
+	rfk::serializeBinary(TestSerializationStruct::staticGetArchetype(), &instance, buffer.data(), buffer.size());
+
+	EXPECT_EQ(rfk::deserializeBinary(TestSerializationStruct::staticGetArchetype(), &instance, buffer.data(), buffer.size() - 1u), 0u);
+}
+
+TEST(Rfk_deserializeBinary, MatchFieldsById)
+{
+	TestSerializationVector		instance;
+	TestSerializationVector		result;
+	std::vector<unsigned char>	buffer(TestSerializationVector::staticGetArchetype().getBinarySchema().getRecordSize());
+
+	instance.x = 1.0f;
+	instance.y = 2.0f;
+
+	rfk::serializeBinary(TestSerializationVector::staticGetArchetype(), &instance, buffer.data(), buffer.size());
+
+	//Change the schema id so that the field table is used, and swap the field table entries
+	buffer[0] ^= 0xFFu;
+
+	std::vector<unsigned char> firstEntry(buffer.begin() + rfk::BinarySchema::headerSize,
+										  buffer.begin() + rfk::BinarySchema::headerSize + rfk::BinarySchema::fieldEntrySize);
+	std::copy(buffer.begin() + rfk::BinarySchema::headerSize + rfk::BinarySchema::fieldEntrySize,
+			  buffer.begin() + rfk::BinarySchema::headerSize + 2u * rfk::BinarySchema::fieldEntrySize,
+			  buffer.begin() + rfk::BinarySchema::headerSize);
+	std::copy(firstEntry.begin(), firstEntry.end(), buffer.begin() + rfk::BinarySchema::headerSize + rfk::BinarySchema::fieldEntrySize);
+
+	EXPECT_EQ(rfk::deserializeBinary(TestSerializationVector::staticGetArchetype(), &result, buffer.data(), buffer.size()), buffer.size());
+	EXPECT_EQ(result.x, 2.0f);
+	EXPECT_EQ(result.y, 1.0f);
+}
+
+//=========================================================
+//================== InstanceComparison ===================
+//=========================================================
+
+TEST(Rfk_InstanceComparison, IgnoreUnserializableFields)
+{
+	TestSerializationStruct lhs;
+	TestSerializationStruct rhs;
+
+	rhs.pointerField			= &rhs.intField;
+	rhs.nonReflectedField.i		= 1;
+
+	EXPECT_TRUE(rfk::equalInstances(TestSerializationStruct::staticGetArchetype(), &lhs, &rhs));
+	EXPECT_EQ(rfk::hashInstance(TestSerializationStruct::staticGetArchetype(), &lhs), rfk::hashInstance(TestSerializationStruct::staticGetArchetype(), &rhs));
+}
+
+TEST(Rfk_InstanceComparison, NestedFieldDiffers)
+{
+	TestSerializationStruct lhs;
+	TestSerializationStruct rhs;
+
+	rhs.path[1].y = 1.0f;
+
+	EXPECT_FALSE(rfk::equalInstances(TestSerializationStruct::staticGetArchetype(), &lhs, &rhs));
+	EXPECT_NE(rfk::hashInstance(TestSerializationStruct::staticGetArchetype(), &lhs), rfk::hashInstance(TestSerializationStruct::staticGetArchetype(), &rhs));
+}
+
+TEST(Rfk_InstanceComparison, DiffReportsChangedFields)
+{
+	TestSerializationStruct		lhs;
+	TestSerializationStruct		rhs;
+	rfk::Vector<rfk::Field const*>	changedFields;
+
+	EXPECT_EQ(rfk::diffInstances(TestSerializationStruct::staticGetArchetype(), &lhs, &rhs, changedFields), 0u);
+
+	rhs.enumField	= TestEnumClass::Value2;
+	rhs.position.x	= 1.0f;
+
+	ASSERT_EQ(rfk::diffInstances(TestSerializationStruct::staticGetArchetype(), &lhs, &rhs, changedFields), 2u);
+	EXPECT_EQ(changedFields[0], TestSerializationStruct::staticGetArchetype().getFieldByName("enumField"));
+	EXPECT_EQ(changedFields[1], TestSerializationStruct::staticGetArchetype().getFieldByName("position"));
+}
@@ -0,0 +1,116 @@
+#include <stdexcept>		//std::logic_error
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+
+#include "TestMethods.h"
+
+//=========================================================
+//=============== BoundMethod::BoundMethod ================
+//=========================================================
+
+TEST(Rfk_BoundMethod_BoundMethod, DefaultConstructedIsUnbound)
+{
+	rfk::BoundMethod boundMethod;
+
+	EXPECT_FALSE(boundMethod.isBound());
+	EXPECT_EQ(boundMethod.getCaller(), nullptr);
+	EXPECT_EQ(boundMethod.getMethod(), nullptr);
+}
+
+TEST(Rfk_BoundMethod_BoundMethod, BindNonConstMethodOnConstInstance)
+{
+	TestMethodClass const instance;
+
+	EXPECT_THROW(rfk::BoundMethod(instance, *TestMethodClass::staticGetArchetype().getMethodByName("returnIntNoParam")), rfk::ConstViolation);
+	EXPECT_NO_THROW(rfk::BoundMethod(instance, *TestMethodClass::staticGetArchetype().getMethodByName("constNoReturnNoParam")));
+}
+
+TEST(Rfk_BoundMethod_BoundMethod, ThrowInvalidCaller)
+{
+	TestMethodClass2 instance;
+
+	EXPECT_THROW(rfk::BoundMethod(instance, *TestMethodClass::staticGetArchetype().getMethodByName("virtualNoReturnNoParam")), rfk::InvalidArchetype);
+}
+
+//=========================================================
+//================= BoundMethod::invoke ===================
+//=========================================================
+
+TEST(Rfk_BoundMethod_invoke, SuccessfullCall)
+{
+	TestMethodClass		instance;
+	rfk::BoundMethod	boundMethod(instance, *TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt"));
+
+	EXPECT_TRUE(boundMethod.isBound());
+	EXPECT_EQ(boundMethod.invoke<int>(42), 42);
+}
+
+TEST(Rfk_BoundMethod_invoke, ThrowingCall)
+{
+	TestMethodClass		instance;
+	rfk::BoundMethod	boundMethod(instance, *TestMethodClass::staticGetArchetype().getMethodByName("throwing"));
+
+	EXPECT_THROW(boundMethod.invoke(), std::logic_error);
+}
+
+TEST(Rfk_BoundMethod_invoke, CallParentIntroducedVirtualMethodOnMultiplePInheritancePClass)
+{
+	MultiplePInheritancePClassMethodOverride	instance;
+	rfk::BoundMethod							boundMethod(instance, *MultiplePInheritancePClassMethodOverride::staticGetArchetype().getMethodByName("methodNoInheritancePClass4", rfk::EMethodFlags::Default, true));
+
+	EXPECT_EQ(boundMethod.invoke<EMethodTestCallResult>(), EMethodTestCallResult::NoInheritancePClass);
+}
+
+//=========================================================
+//============== BoundMethod::invokeErased ================
+//=========================================================
+
+TEST(Rfk_BoundMethod_invokeErased, SuccessfullCall)
+{
+	TestMethodClass		instance;
+	rfk::BoundMethod	boundMethod(instance, *TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt"));
+	int					arg		= 42;
+	void*				args[]	= { &arg };
+	int					result	= 0;
+
+	boundMethod.invokeErased(args, &result);
+	EXPECT_EQ(result, 42);
+}
+
+//=========================================================
+//============ BoundMethod comparison / hash ==============
+//=========================================================
+
+TEST(Rfk_BoundMethod_operatorEqual, SameInstanceSameMethod)
+{
+	TestMethodClass		instance;
+	rfk::Method const&	method = *TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt");
+
+	EXPECT_EQ(rfk::BoundMethod(instance, method), rfk::BoundMethod(instance, method));
+	EXPECT_EQ(std::hash<rfk::BoundMethod>()(rfk::BoundMethod(instance, method)), std::hash<rfk::BoundMethod>()(rfk::BoundMethod(instance, method)));
+}
+
+TEST(Rfk_BoundMethod_operatorEqual, DifferentInstanceOrMethod)
+{
+	TestMethodClass		instance;
+	TestMethodClass		instance2;
+	rfk::Method const&	method	= *TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt");
+	rfk::Method const&	method2	= *TestMethodClass::staticGetArchetype().getMethodByName("returnIntNoParam");
+
+	EXPECT_NE(rfk::BoundMethod(instance, method), rfk::BoundMethod(instance2, method));
+	EXPECT_NE(rfk::BoundMethod(instance, method), rfk::BoundMethod(instance, method2));
+}
+
+TEST(Rfk_BoundMethod_hash, StoreInUnorderedSet)
+{
+	TestMethodClass						instance;
+	rfk::Method const&					method = *TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt");
+	std::unordered_set<rfk::BoundMethod> delegates;
+
+	delegates.emplace(instance, method);
+	delegates.emplace(instance, method);
+
+	EXPECT_EQ(delegates.size(), 1u);
+}
@@ -308,6 +308,40 @@ TEST(Rfk_ClassTemplate_getTemplateInstantiation, NonExistingMixedTemplateInstant
 	EXPECT_EQ(mixedTemplateClass2->getTemplateInstantiation(templateArgs.data(), templateArgs.size()), nullptr);
 }
 
+TEST(Rfk_ClassTemplate_getTemplateInstantiation, WildcardTemplateArgument)
+{
+	rfk::TypeTemplateArgument arg1(rfk::getType<int>());
+	rfk::TypeTemplateArgument arg3(rfk::getType<double>());
+	rfk::TypeTemplateArgument arg3NonExisting(rfk::getType<long double>());
+
+	std::vector<rfk::TemplateArgument const*> templateArgs{ &arg1, nullptr, &arg3 };
+
+	rfk::ClassTemplateInstantiation const* instantiation = multTypeClass->getTemplateInstantiation(templateArgs.data(), templateArgs.size());
+
+	ASSERT_NE(instantiation, nullptr);
+	EXPECT_EQ(instantiation->getTemplateArgumentAt(2u), arg3);
+
+	templateArgs[0] = nullptr;
+	EXPECT_NE(multTypeClass->getTemplateInstantiation(templateArgs.data(), templateArgs.size()), nullptr);
+
+	templateArgs[2] = &arg3NonExisting;
+	EXPECT_EQ(multTypeClass->getTemplateInstantiation(templateArgs.data(), templateArgs.size()), nullptr);
+}
+
+//=========================================================
+//====== internal::computeClassNestedEntityId =============
+//=========================================================
+
+TEST(Rfk_ClassTemplate_computeClassNestedEntityId, CompileTimeId)
+{
+	constexpr std::size_t intId		= rfk::internal::computeClassNestedEntityId<SingleTypeTemplateClassTemplate<int>>("field");
+	constexpr std::size_t floatId	= rfk::internal::computeClassNestedEntityId<SingleTypeTemplateClassTemplate<float>>("field");
+
+	EXPECT_NE(intId, floatId);
+	EXPECT_NE(intId, rfk::internal::computeClassNestedEntityId<SingleTypeTemplateClassTemplate<int>>("method"));
+	EXPECT_EQ(intId, rfk::internal::computeClassNestedEntityId<SingleTypeTemplateClassTemplate<int>>("field"));
+}
+
 //=========================================================
 //===== ClassTemplate::getTemplateInstantiationsCount =====
 //=========================================================
@@ -1,7 +1,9 @@
 #include <stdexcept>	//std::logic_error
+#include <thread>
 
 #include <gtest/gtest.h>
 #include <Refureku/Refureku.h>
+#include <Refureku/TypeInfo/Entity/DefaultEntityRegisterer.h>
 
 #include "TestStruct.h"
 #include "TestEnum.h"
@@ -1410,4 +1412,117 @@ TEST(Rfk_Database_getEnumValueById, NonEnumValueEntityId)
 	EXPECT_EQ(rfk::getDatabase().getEnumValueById(FileLevelClass::staticGetArchetype().getStaticFieldByName("_staticField")->getId()), nullptr);
 	EXPECT_EQ(rfk::getDatabase().getEnumValueById(FileLevelClass::staticGetArchetype().getMethodByName("method")->getId()), nullptr);
 	EXPECT_EQ(rfk::getDatabase().getEnumValueById(FileLevelClass::staticGetArchetype().getStaticMethodByName("staticMethod")->getId()), nullptr);
-}
\ No newline at end of file
+}
+
+//=========================================================
+//============= Database::getDispatchTable ================
+//=========================================================
+
+TEST(Rfk_Database_getDispatchTable, IndexFunctionsWithProperty)
+{
+	rfk::DispatchTable const& dispatchTable = rfk::getDatabase().getDispatchTable<TestDabataseProperty>();
+
+	EXPECT_EQ(&dispatchTable.getPropertyArchetype(), &TestDabataseProperty::staticGetArchetype());
+	EXPECT_EQ(dispatchTable.getEntriesCount(), 2u);
+
+	for (rfk::DispatchTableEntry const& entry : dispatchTable)
+	{
+		EXPECT_TRUE(entry.function->hasSameName("fileLevelFunc") || entry.function->hasSameName("fileLevelFunc3"));
+		EXPECT_EQ(entry.property->getArchetype(), TestDabataseProperty::staticGetArchetype());
+		EXPECT_FALSE(entry.requiresCaller);
+		EXPECT_NO_THROW(entry.invoke(nullptr, nullptr));
+	}
+}
+
+TEST(Rfk_Database_getDispatchTable, SameTableForSameProperty)
+{
+	EXPECT_EQ(&rfk::getDatabase().getDispatchTable<TestDabataseProperty>(), &rfk::getDatabase().getDispatchTable(TestDabataseProperty::staticGetArchetype()));
+}
+
+TEST(Rfk_Database_getDispatchTable, ConcurrentFirstRetrieval)
+{
+	rfk::Struct const&			propertyArchetype = FileLevelClass::staticGetArchetype();
+	rfk::DispatchTable const*	dispatchTables[4];
+	std::thread					threads[4];
+
+	for (std::size_t i = 0u; i < 4u; i++)
+	{
+		threads[i] = std::thread([&dispatchTables, &propertyArchetype, i]()
+								 {
+									 dispatchTables[i] = &rfk::getDatabase().getDispatchTable(propertyArchetype);
+								 });
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (rfk::DispatchTable const* dispatchTable : dispatchTables)
+	{
+		EXPECT_EQ(dispatchTable, dispatchTables[0]);
+	}
+}
+
+TEST(Rfk_Database_getDispatchTable, UpdateOnRegistration)
+{
+	rfk::DispatchTable const&	dispatchTable	= rfk::getDatabase().getDispatchTable<TestDabataseProperty>();
+	std::size_t					entriesCount	= dispatchTable.getEntriesCount();
+	TestDabataseProperty		property;
+	rfk::Function				function("manualFunction", 123456789u, rfk::getType<void>(), new rfk::NonMemberFunction<void()>(&fileLevelFunc2), rfk::EFunctionFlags::Default);
+
+	function.addProperty(property);
+
+	{
+		rfk::DefaultEntityRegisterer registerer(function);
+
+		EXPECT_EQ(dispatchTable.getEntriesCount(), entriesCount + 1u);
+	}
+
+	EXPECT_EQ(dispatchTable.getEntriesCount(), entriesCount);
+}
+
+//=========================================================
+//=========== Database::foreachEntityWithProperty =========
+//=========================================================
+
+TEST(Rfk_Database_foreachEntityWithProperty, KindFilter)
+{
+	std::size_t count = 0u;
+
+	EXPECT_TRUE(rfk::getDatabase().foreachEntityWithProperty<TestDabataseProperty>([](rfk::Entity const& entity, void* userData)
+																				   {
+																					   EXPECT_TRUE(entity.hasSameName("fileLevelFunc") || entity.hasSameName("fileLevelFunc3"));
+																					   (*reinterpret_cast<std::size_t*>(userData))++;
+
+																					   return true;
+																				   }, &count, true, rfk::EEntityKind::Function));
+	EXPECT_EQ(count, 2u);
+	EXPECT_EQ(rfk::getDatabase().getEntitiesWithPropertyCount(TestDabataseProperty::staticGetArchetype(), true, rfk::EEntityKind::Class | rfk::EEntityKind::Struct), 4u);
+}
+
+TEST(Rfk_Database_foreachEntityWithProperty, BreakingLoop)
+{
+	EXPECT_FALSE(rfk::getDatabase().foreachEntityWithProperty<TestDabataseProperty>(nullptr, nullptr));
+	EXPECT_FALSE(rfk::getDatabase().foreachEntityWithProperty<TestDabataseProperty>([](rfk::Entity const&, void*)
+																					{
+																						return false;
+																					}, nullptr));
+}
+
+TEST(Rfk_Database_foreachEntityWithProperty, UpdateOnRegistration)
+{
+	std::size_t				entitiesCount	= rfk::getDatabase().getEntitiesWithPropertyCount(TestDabataseProperty::staticGetArchetype());
+	TestDabataseProperty	property;
+	rfk::Function			function("manualFunction", 123456789u, rfk::getType<void>(), new rfk::NonMemberFunction<void()>(&fileLevelFunc2), rfk::EFunctionFlags::Default);
+
+	function.addProperty(property);
+
+	{
+		rfk::DefaultEntityRegisterer registerer(function);
+
+		EXPECT_EQ(rfk::getDatabase().getEntitiesWithPropertyCount(TestDabataseProperty::staticGetArchetype()), entitiesCount + 1u);
+	}
+
+	EXPECT_EQ(rfk::getDatabase().getEntitiesWithPropertyCount(TestDabataseProperty::staticGetArchetype()), entitiesCount);
+}
@@ -10,6 +10,7 @@
 #include "TestEnum.h"
 #include "TestNamespace.h"
 #include "TypeTemplateClassTemplate.h"
+#include "TestDatabase.h"
 
 //=========================================================
 //================== Entity::getName ======================
@@ -290,6 +291,21 @@ TEST(Rfk_Entity_getPropertyNonTemplate, WithoutChildClasses)
 	EXPECT_EQ(TestClass::staticGetArchetype().getProperty(kodgen::ParseAllNested::staticGetArchetype(), false), nullptr);				//Not found
 }
 
+TEST(Rfk_Entity_getPropertyNonTemplate, AddedProperty)
+{
+	rfk::Struct						s("Struct", 0u, 1u, false);
+	MultipleInheritedPropertyChild	property(0);
+
+	EXPECT_EQ(s.getProperty(MultipleInheritedProperty::staticGetArchetype(), true), nullptr);
+
+	s.addProperty(property);
+
+	EXPECT_EQ(s.getProperty(MultipleInheritedProperty::staticGetArchetype(), true), &property);			//Catch child
+	EXPECT_EQ(s.getProperty(MultipleInheritedProperty::staticGetArchetype(), false), nullptr);			//Ignore child class
+	EXPECT_EQ(s.getProperty(UniqueInheritedProperty::staticGetArchetype(), true), nullptr);				//Not found
+	EXPECT_EQ(s.getPropertyByName("MultipleInheritedPropertyChild"), &property);
+}
+
 //=========================================================
 //================ Entity::getProperty<> ==================
 //=========================================================
@@ -512,6 +528,23 @@ TEST(Rfk_Entity_foreachProperty, ThrowingVisitor)
 	EXPECT_THROW(TestClass::staticGetArchetype().foreachProperty(visitor, nullptr), std::logic_error);
 }
 
+//=========================================================
+//================ Entity shared properties ===============
+//=========================================================
+
+TEST(Rfk_Entity_sharedProperty, SharedPropertyWithoutArguments)
+{
+	rfk::Function const* func	= rfk::getDatabase().getFileLevelFunctionByName("fileLevelFunc");
+	rfk::Function const* func3	= rfk::getDatabase().getFileLevelFunctionByName("fileLevelFunc3");
+
+	ASSERT_NE(func, nullptr);
+	ASSERT_NE(func3, nullptr);
+
+	//Both functions carry a TestDabataseProperty without arguments
+	EXPECT_EQ(func->getPropertyAt(0u), func3->getPropertyAt(0u));
+	EXPECT_EQ(func->getPropertyAt(0u), FileLevelClass::staticGetArchetype().getProperty<TestDabataseProperty>());
+}
+
 //=========================================================
 //================== Entity::operator == ==================
 //=========================================================
@@ -1,4 +1,6 @@
 #include <stdexcept>	//std::logic_error
+#include <limits>		//std::numeric_limits
+#include <string>
 
 #include <gtest/gtest.h>
 #include <Refureku/Refureku.h>
@@ -51,6 +53,38 @@ TEST(Rfk_Enum_getEnumValue, NonExistantValue)
 	EXPECT_EQ(rfk::getEnum<TestEnumClass>()->getEnumValue(-1), nullptr);
 }
 
+TEST(Rfk_Enum_getEnumValue, SparseValues)
+{
+	rfk::Enum e("SparseEnum", 0u, rfk::getArchetype<rfk::int64>());
+
+	e.addEnumValue("Min", 1u, std::numeric_limits<rfk::int64>::min());
+	e.addEnumValue("Zero", 2u, 0);
+	e.addEnumValue("Max", 3u, std::numeric_limits<rfk::int64>::max());
+
+	EXPECT_EQ(e.getEnumValue(std::numeric_limits<rfk::int64>::min()), &e.getEnumValueAt(0));
+	EXPECT_EQ(e.getEnumValue(0), &e.getEnumValueAt(1));
+	EXPECT_EQ(e.getEnumValue(std::numeric_limits<rfk::int64>::max()), &e.getEnumValueAt(2));
+	EXPECT_EQ(e.getEnumValue(1), nullptr);
+	EXPECT_EQ(e.getEnumValueByName("Max"), &e.getEnumValueAt(2));
+}
+
+TEST(Rfk_Enum_getEnumValue, DecreasingValues)
+{
+	rfk::Enum e("DecreasingEnum", 0u, rfk::getArchetype<rfk::int64>());
+
+	for (rfk::int64 i = 0; i < 100; i++)
+	{
+		e.addEnumValue("Value", static_cast<std::size_t>(i) + 1u, std::numeric_limits<rfk::int64>::min() + 99 - i);
+	}
+
+	for (rfk::int64 i = 0; i < 100; i++)
+	{
+		EXPECT_EQ(e.getEnumValue(std::numeric_limits<rfk::int64>::min() + 99 - i), &e.getEnumValueAt(static_cast<std::size_t>(i)));
+	}
+
+	EXPECT_EQ(e.getEnumValue(std::numeric_limits<rfk::int64>::min() + 100), nullptr);
+}
+
 //=========================================================
 //============ Enum::getEnumValueByPredicate ==============
 //=========================================================
@@ -110,6 +144,15 @@ TEST(Rfk_Enum_getEnumValues, MultipleValues)
 	EXPECT_EQ(rfk::getEnum<TestEnumClass>()->getEnumValues(1 << 2).size(), 2u);
 }
 
+TEST(Rfk_Enum_getEnumValues, RegistrationOrder)
+{
+	rfk::Vector<rfk::EnumValue const*> values = rfk::getEnum<TestEnumClass>()->getEnumValues(1 << 2);
+
+	ASSERT_EQ(values.size(), 2u);
+	EXPECT_STREQ(values[0]->getName(), "Value3");
+	EXPECT_STREQ(values[1]->getName(), "Value3Alias");
+}
+
 //=========================================================
 //============ Enum::getEnumValuesByPredicate =============
 //=========================================================
@@ -238,4 +281,158 @@ TEST(Rfk_Enum_foreachEnumValue, ThrowingVisitor)
 	};
 
 	EXPECT_THROW(rfk::getEnum<TestEnumClass>()->foreachEnumValue(visitor, nullptr), std::logic_error);
-}
\ No newline at end of file
+}
+
+//=========================================================
+//=================== Enum::isFlagEnum ====================
+//=========================================================
+
+TEST(Rfk_Enum_isFlagEnum, DetectedFlagEnum)
+{
+	EXPECT_TRUE(rfk::getEnum<TestEnumClass>()->isFlagEnum());
+}
+
+TEST(Rfk_Enum_isFlagEnum, SetFlagEnum)
+{
+	rfk::Enum e("FlagEnum", 0u, rfk::getArchetype<int>());
+
+	e.addEnumValue("Value1", 1u, 1);
+	e.addEnumValue("Value3", 2u, 3);
+
+	EXPECT_FALSE(e.isFlagEnum());
+
+	e.setFlagEnum(true);
+
+	EXPECT_TRUE(e.isFlagEnum());
+}
+
+//=========================================================
+//================= Enum::decomposeFlags ==================
+//=========================================================
+
+TEST(Rfk_Enum_decomposeFlags, NullptrVisitor)
+{
+	EXPECT_FALSE(rfk::getEnum<TestEnumClass>()->decomposeFlags(1 << 0, nullptr, nullptr));
+}
+
+TEST(Rfk_Enum_decomposeFlags, CombinedValue)
+{
+	std::string names;
+
+	EXPECT_TRUE(rfk::getEnum<TestEnumClass>()->decomposeFlags(static_cast<rfk::int64>(TestEnumClass::Value123), [](rfk::EnumValue const& ev, void* data)
+				{
+					std::string& names = *reinterpret_cast<std::string*>(data);
+
+					names += (names.empty() ? "" : "|") + std::string(ev.getName());
+
+					return true;
+				}, &names));
+
+	EXPECT_EQ(names, "Value1|Value2|Value3");
+}
+
+TEST(Rfk_Enum_decomposeFlags, UnknownBit)
+{
+	int visitsCount = 0;
+
+	EXPECT_FALSE(rfk::getEnum<TestEnumClass>()->decomposeFlags((1 << 0) | (1 << 3), [](rfk::EnumValue const&, void* data)
+				 {
+					 (*reinterpret_cast<int*>(data))++;
+
+					 return true;
+				 }, &visitsCount));
+
+	EXPECT_EQ(visitsCount, 1);
+}
+
+TEST(Rfk_Enum_decomposeFlags, SignedUnderlyingType)
+{
+	rfk::Enum e("SignedFlagEnum", 0u, rfk::getArchetype<rfk::int32>());
+
+	e.addEnumValue("Value1", 1u, 1);
+	e.addEnumValue("SignBit", 2u, std::numeric_limits<rfk::int32>::min());
+
+	//The sign bit of the underlying type must not be sign-extended to the upper bits
+	EXPECT_TRUE(e.isFlagEnum());
+	EXPECT_EQ(e.getFlagEnumValue(31u), e.getEnumValueByName("SignBit"));
+
+	std::string names;
+
+	EXPECT_TRUE(e.decomposeFlags(std::numeric_limits<rfk::int32>::min() | 1, [](rfk::EnumValue const& ev, void* data)
+				{
+					std::string& names = *reinterpret_cast<std::string*>(data);
+
+					names += (names.empty() ? "" : "|") + std::string(ev.getName());
+
+					return true;
+				}, &names));
+
+	EXPECT_EQ(names, "Value1|SignBit");
+}
+
+//=========================================================
+//=================== Enum::parseFlags ====================
+//=========================================================
+
+TEST(Rfk_Enum_parseFlags, ValidFlags)
+{
+	rfk::int64 value = 0;
+
+	EXPECT_TRUE(rfk::getEnum<TestEnumClass>()->parseFlags("Value1 | Value3", value));
+	EXPECT_EQ(value, (1 << 0) | (1 << 2));
+
+	EXPECT_TRUE(rfk::getEnum<TestEnumClass>()->parseFlags("", value));
+	EXPECT_EQ(value, 0);
+}
+
+TEST(Rfk_Enum_parseFlags, InvalidFlags)
+{
+	rfk::int64 value = 42;
+
+	EXPECT_FALSE(rfk::getEnum<TestEnumClass>()->parseFlags("Value1|Value4", value));
+	EXPECT_FALSE(rfk::getEnum<TestEnumClass>()->parseFlags("Value1|", value));
+	EXPECT_FALSE(rfk::getEnum<TestEnumClass>()->parseFlags("Value1||Value2", value));
+	EXPECT_EQ(value, 42);
+}
+
+//=========================================================
+//================== rfk::enumToString ====================
+//=========================================================
+
+TEST(Rfk_enumToString, ExistantValue)
+{
+	static_assert(rfk::enumToString(TestEnumClass::Value2) == "Value2");
+
+	EXPECT_EQ(rfk::enumToString(TestEnumValue3), "TestEnumValue3");
+	EXPECT_EQ(rfk::enumToString(TestEnumClass::Value123), "Value123");
+}
+
+TEST(Rfk_enumToString, AliasedValue)
+{
+	//The first declared enum value holding the value is returned
+	EXPECT_EQ(rfk::enumToString(TestEnumClass::Value3Alias), "Value3");
+}
+
+TEST(Rfk_enumToString, NonExistantValue)
+{
+	EXPECT_TRUE(rfk::enumToString(static_cast<TestEnumClass>(3)).empty());
+}
+
+//=========================================================
+//================== rfk::stringToEnum ====================
+//=========================================================
+
+TEST(Rfk_stringToEnum, ExistantName)
+{
+	static_assert(rfk::stringToEnum<TestEnumClass>("Value3Alias") == TestEnumClass::Value3);
+
+	EXPECT_EQ(rfk::stringToEnum<TestEnum>("TestEnumValue2"), TestEnumValue2);
+	EXPECT_EQ(rfk::stringToEnum<TestEnumClass>("Value1"), TestEnumClass::Value1);
+}
+
+TEST(Rfk_stringToEnum, NonExistantName)
+{
+	EXPECT_FALSE(rfk::stringToEnum<TestEnum>("").has_value());
+	EXPECT_FALSE(rfk::stringToEnum<TestEnumClass>("value1").has_value());	//Test case
+	EXPECT_FALSE(rfk::stringToEnum<TestEnumClass>("Value").has_value());
+}
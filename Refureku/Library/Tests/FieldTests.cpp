@@ -530,4 +530,322 @@ TEST(Rfk_Field_setUnsafe, SetConstInt)
 	EXPECT_NE(field->getUnsafe<int>(&instance), newValue);
 
 	EXPECT_THROW(field->setUnsafe(&instance, &newValue, sizeof(int)), rfk::ConstViolation);
-}
\ No newline at end of file
+}
+
+//=========================================================
+//================ Field::tryGet / trySet =================
+//=========================================================
+
+TEST(Rfk_Field_tryGet, GetIntByValue)
+{
+	TestFieldsClass instance;
+
+	rfk::Result<int> result = TestFieldsClass::staticGetArchetype().getFieldByName("intField")->tryGet<int>(instance);
+
+	EXPECT_TRUE(result.isSuccess());
+	EXPECT_EQ(result.getValue(), 42);
+}
+
+TEST(Rfk_Field_tryGet, GetTestClassByLVRef)
+{
+	TestFieldsClass instance;
+
+	rfk::Result<TestClass&> result = TestFieldsClass::staticGetArchetype().getFieldByName("testClassField")->tryGet<TestClass&>(instance);
+
+	EXPECT_TRUE(result.isSuccess());
+	EXPECT_EQ(&result.getValue(), &instance.testClassField);
+}
+
+TEST(Rfk_Field_tryGet, ConstViolation)
+{
+	TestFieldsClass instance;
+
+	EXPECT_EQ(TestFieldsClass::staticGetArchetype().getFieldByName("constIntField")->tryGet<int&>(instance).getCode(), rfk::EResultCode::ConstViolation);
+	EXPECT_EQ(TestFieldsClass::staticGetArchetype().getFieldByName("constIntField")->tryGet<int const&>(instance).getValue(), 314);
+}
+
+TEST(Rfk_Field_tryGet, InvalidArchetype)
+{
+	TestFieldsUnrelatedClass instance;
+
+	EXPECT_EQ(TestFieldsClass::staticGetArchetype().getFieldByName("constIntField")->tryGet<int>(instance).getCode(), rfk::EResultCode::InvalidArchetype);
+}
+
+TEST(Rfk_Field_trySet, SetInt)
+{
+	TestFieldsClass instance;
+
+	EXPECT_TRUE(TestFieldsClass::staticGetArchetype().getFieldByName("intField")->trySet(instance, 2).isSuccess());
+	EXPECT_EQ(instance.intField, 2);
+}
+
+TEST(Rfk_Field_trySet, ConstViolation)
+{
+	TestFieldsClass instance;
+
+	EXPECT_EQ(TestFieldsClass::staticGetArchetype().getFieldByName("constIntField")->trySet(instance, 2).getCode(), rfk::EResultCode::ConstViolation);
+	EXPECT_EQ(instance.constIntField, 314);
+}
+
+TEST(Rfk_Field_trySet, InvalidArchetype)
+{
+	TestFieldsUnrelatedClass instance;
+
+	EXPECT_EQ(TestFieldsClass::staticGetArchetype().getFieldByName("intField")->trySet(instance, 2).getCode(), rfk::EResultCode::InvalidArchetype);
+}
+
+//=========================================================
+//================ Field::gather / scatter ================
+//=========================================================
+
+TEST(Rfk_Field_gather, GatherArray)
+{
+	TestFieldsClass instances[4];
+	int				values[4];
+
+	for (int i = 0; i < 4; i++)
+	{
+		instances[i].intField = i;
+	}
+
+	TestFieldsClass::staticGetArchetype().getFieldByName("intField")->gather(instances, 4u, values);
+
+	for (int i = 0; i < 4; i++)
+	{
+		EXPECT_EQ(values[i], i);
+	}
+}
+
+TEST(Rfk_Field_gather, GatherPointerArray)
+{
+	TestFieldsClass instance1;
+	TestFieldsClass instance2;
+	void const*		instances[] = { &instance2, &instance1 };
+	int				values[2];
+
+	instance1.intField = 1;
+	instance2.intField = 2;
+
+	TestFieldsClass::staticGetArchetype().getFieldByName("intField")->gatherUnsafe(instances, 2u, values);
+
+	EXPECT_EQ(values[0], 2);
+	EXPECT_EQ(values[1], 1);
+}
+
+TEST(Rfk_Field_gather, ThrowInvalidArchetype)
+{
+	TestFieldsUnrelatedClass	instances[2];
+	int							values[2];
+
+	EXPECT_THROW(TestFieldsClass::staticGetArchetype().getFieldByName("intField")->gather(instances, 2u, values), rfk::InvalidArchetype);
+}
+
+TEST(Rfk_Field_gather, GatherParallel)
+{
+	TestFieldsClass instances[5];
+	int				values[5];
+
+	for (int i = 0; i < 5; i++)
+	{
+		instances[i].intField = i;
+	}
+
+	std::size_t jobsCount = 0u;
+	TestFieldsClass::staticGetArchetype().getFieldByName("intField")->gatherParallel([&jobsCount](std::size_t count, auto const& job)
+																					  {
+																						  jobsCount = count;
+
+																						  for (std::size_t i = 0u; i < count; i++)
+																						  {
+																							  job(i);
+																						  }
+																					  }, 2u, instances, 5u, values);
+
+	EXPECT_EQ(jobsCount, 3u);
+
+	for (int i = 0; i < 5; i++)
+	{
+		EXPECT_EQ(values[i], i);
+	}
+}
+
+TEST(Rfk_Field_scatter, ScatterArray)
+{
+	TestFieldsClass instances[4];
+	int				values[] = { 3, 2, 1, 0 };
+
+	TestFieldsClass::staticGetArchetype().getFieldByName("intField")->scatter(instances, 4u, values);
+
+	for (int i = 0; i < 4; i++)
+	{
+		EXPECT_EQ(instances[i].intField, 3 - i);
+	}
+}
+
+TEST(Rfk_Field_scatter, ScatterPointerArray)
+{
+	TestFieldsClass instance1;
+	TestFieldsClass instance2;
+	void*			instances[] = { &instance2, &instance1 };
+	int				values[] = { 1, 2 };
+
+	TestFieldsClass::staticGetArchetype().getFieldByName("intField")->scatterUnsafe(instances, 2u, values);
+
+	EXPECT_EQ(instance1.intField, 2);
+	EXPECT_EQ(instance2.intField, 1);
+}
+
+TEST(Rfk_Field_scatter, ThrowConstViolation)
+{
+	TestFieldsClass instances[2];
+	int				values[] = { 1, 2 };
+
+	EXPECT_THROW(TestFieldsClass::staticGetArchetype().getFieldByName("constIntField")->scatter(instances, 2u, values), rfk::ConstViolation);
+	EXPECT_EQ(instances[0].constIntField, 314);
+}
+
+TEST(Rfk_Field_scatter, ScatterParallel)
+{
+	TestFieldsClass instances[5];
+	int				values[] = { 4, 3, 2, 1, 0 };
+
+	TestFieldsClass::staticGetArchetype().getFieldByName("intField")->scatterParallel([](std::size_t count, auto const& job)
+																					   {
+																						   for (std::size_t i = count; i > 0u; i--)
+																						   {
+																							   job(i - 1u);
+																						   }
+																					   }, 0u, instances, 5u, values);
+
+	for (int i = 0; i < 5; i++)
+	{
+		EXPECT_EQ(instances[i].intField, 4 - i);
+	}
+}
+
+//=========================================================
+//==================== FieldAccessor ======================
+//=========================================================
+
+TEST(Rfk_FieldAccessor, DefaultConstructedIsUnbound)
+{
+	rfk::FieldAccessor<int> accessor;
+
+	EXPECT_FALSE(accessor.isBound());
+	EXPECT_EQ(accessor.getField(), nullptr);
+	EXPECT_EQ(accessor.getInstanceArchetype(), nullptr);
+}
+
+TEST(Rfk_FieldAccessor, GetSetOwnerField)
+{
+	TestFieldsClass			instance;
+	rfk::FieldAccessor<int>	accessor(*TestFieldsClass::staticGetArchetype().getFieldByName("intField"));
+
+	EXPECT_EQ(accessor.getInstanceArchetype(), &TestFieldsClass::staticGetArchetype());
+	EXPECT_EQ(&accessor.get(instance), &instance.intField);
+
+	accessor.set(instance, 2);
+	EXPECT_EQ(instance.intField, 2);
+}
+
+TEST(Rfk_FieldAccessor, GetConstField)
+{
+	TestFieldsClass const	instance;
+	rfk::FieldAccessor<int>	accessor(*TestFieldsClass::staticGetArchetype().getFieldByName("constIntField"));
+
+	EXPECT_EQ(accessor.get(instance), 314);
+	EXPECT_EQ(accessor.getUnsafe(static_cast<void const*>(&instance)), 314);
+}
+
+TEST(Rfk_FieldAccessor, FoldParentOffset)
+{
+	TestFieldsClassChild	instance;
+	rfk::FieldAccessor<int>	accessor(TestFieldsClassChild::staticGetArchetype(), *TestFieldsClass2::staticGetArchetype().getFieldByName("intField2"));
+
+	EXPECT_EQ(accessor.getOffset(), reinterpret_cast<unsigned char*>(&instance.intField2) - reinterpret_cast<unsigned char*>(&instance));
+	EXPECT_EQ(&accessor.get(instance), &instance.intField2);
+
+	accessor.setUnsafe(&instance, 3);
+	EXPECT_EQ(instance.intField2, 3);
+}
+
+TEST(Rfk_FieldAccessor, ThrowInvalidArchetype)
+{
+	EXPECT_THROW(rfk::FieldAccessor<int>(TestFieldsUnrelatedClass::staticGetArchetype(), *TestFieldsClass::staticGetArchetype().getFieldByName("intField")), rfk::InvalidArchetype);
+}
+
+//=========================================================
+//===================== DirtyTracker ======================
+//=========================================================
+
+TEST(Rfk_DirtyTracker, AttachDetach)
+{
+	EXPECT_EQ(TestFieldsClass::staticGetArchetype().getDirtyTracker(), nullptr);
+
+	{
+		rfk::DirtyTracker tracker(TestFieldsClass::staticGetArchetype());
+
+		EXPECT_EQ(TestFieldsClass::staticGetArchetype().getDirtyTracker(), &tracker);
+	}
+
+	EXPECT_EQ(TestFieldsClass::staticGetArchetype().getDirtyTracker(), nullptr);
+}
+
+TEST(Rfk_DirtyTracker, SetMarksFieldDirty)
+{
+	TestFieldsClass		instance;
+	TestFieldsClass		otherInstance;
+	rfk::Field const*	intField = TestFieldsClass::staticGetArchetype().getFieldByName("intField");
+	rfk::DirtyTracker	tracker(TestFieldsClass::staticGetArchetype());
+
+	intField->set(instance, 1);
+
+	EXPECT_TRUE(tracker.isDirty(&instance));
+	EXPECT_TRUE(tracker.isDirty(&instance, intField->getIndex()));
+	EXPECT_FALSE(tracker.isDirty(&otherInstance));
+	ASSERT_EQ(tracker.getDirtyInstancesCount(), 1u);
+	EXPECT_EQ(tracker.getDirtyInstanceAt(0u), &instance);
+}
+
+TEST(Rfk_DirtyTracker, ForeachDirtyField)
+{
+	TestFieldsClass		instance;
+	rfk::Field const*	intField = TestFieldsClass::staticGetArchetype().getFieldByName("intField");
+	rfk::Field const*	testClassField = TestFieldsClass::staticGetArchetype().getFieldByName("testClassField");
+	rfk::DirtyTracker	tracker(TestFieldsClass::staticGetArchetype());
+
+	intField->markDirty(&instance);
+	tracker.markDirty(&instance, *testClassField);
+
+	std::size_t dirtyFieldsCount = 0u;
+	EXPECT_TRUE(tracker.foreachDirtyField(&instance, [](rfk::Field const&, void* userData)
+				{
+					(*reinterpret_cast<std::size_t*>(userData))++;
+
+					return true;
+				}, &dirtyFieldsCount));
+
+	EXPECT_EQ(dirtyFieldsCount, 2u);
+}
+
+TEST(Rfk_DirtyTracker, ClearDirty)
+{
+	TestFieldsClass		instances[3];
+	rfk::Field const*	intField = TestFieldsClass::staticGetArchetype().getFieldByName("intField");
+	rfk::DirtyTracker	tracker(TestFieldsClass::staticGetArchetype());
+	int					values[] = { 1, 2, 3 };
+
+	intField->scatter(instances, 3u, values);
+
+	EXPECT_EQ(tracker.getDirtyInstancesCount(), 3u);
+
+	tracker.clearDirty(&instances[0]);
+
+	EXPECT_EQ(tracker.getDirtyInstancesCount(), 2u);
+	EXPECT_FALSE(tracker.isDirty(&instances[0]));
+	EXPECT_TRUE(tracker.isDirty(&instances[2], intField->getIndex()));
+
+	tracker.clearAllDirty();
+
+	EXPECT_EQ(tracker.getDirtyInstancesCount(), 0u);
+}
@@ -98,6 +98,25 @@ TEST(Rfk_Function_invoke, ThrowingCall)
 	EXPECT_THROW(rfk::getDatabase().getFileLevelFunctionByName("func_noParam_throwLogicError")->invoke(), std::logic_error);
 }
 
+//=========================================================
+//=============== Function::invokeErased ==================
+//=========================================================
+
+TEST(Rfk_Function_invokeErased, SuccessfullCall)
+{
+	int		arg		= 42;
+	void*	args[]	= { &arg };
+	int		result	= 0;
+
+	rfk::getDatabase().getFileLevelFunctionByName("func_return_singleParam")->invokeErased(args, &result);
+	EXPECT_EQ(result, 42);
+}
+
+TEST(Rfk_Function_invokeErased, ThrowingCall)
+{
+	EXPECT_THROW(rfk::getDatabase().getFileLevelFunctionByName("func_noParam_throwLogicError")->invokeErased(nullptr), std::logic_error);
+}
+
 //=========================================================
 //=============== Function::checkedInvoke =================
 //=========================================================
@@ -152,4 +171,51 @@ TEST(Rfk_Function_checkedInvoke, NonReflectedTypeBypassArgTypeMismatch)
 TEST(Rfk_Function_checkedInvoke, ThrowingCall)
 {
 	EXPECT_THROW(rfk::getDatabase().getFileLevelFunctionByName("func_noParam_throwLogicError")->checkedInvoke(), std::logic_error);
+}
+
+//=========================================================
+//============ Function::getNativeEntryPoint ==============
+//=========================================================
+
+TEST(Rfk_Function_getNativeEntryPoint, CallNativeAddress)
+{
+	rfk::NativeEntryPoint const* entryPoint = rfk::getDatabase().getFileLevelFunctionByName("func_return_singleParam")->getNativeEntryPoint();
+
+	ASSERT_NE(entryPoint, nullptr);
+	EXPECT_FALSE(entryPoint->isMethodTrampoline);
+	EXPECT_EQ(entryPoint->address, reinterpret_cast<rfk::NativeFunctionPtr>(&func_return_singleParam));
+	EXPECT_EQ(reinterpret_cast<int (*)(int)>(entryPoint->address)(42), 42);
+}
+
+TEST(Rfk_Function_getNativeEntryPoint, ParametersDescription)
+{
+	rfk::NativeEntryPoint const* entryPoint = rfk::getDatabase().getFileLevelFunctionByName("func_return_singleParam")->getNativeEntryPoint();
+
+	ASSERT_NE(entryPoint, nullptr);
+	EXPECT_EQ(entryPoint->callingConvention, rfk::internal::getNativeCallingConvention());
+	EXPECT_EQ(entryPoint->returnValue.valueClass, rfk::ENativeValueClass::Integral);
+	EXPECT_EQ(entryPoint->returnValue.size, sizeof(int));
+	ASSERT_EQ(entryPoint->parametersCount, 1u);
+	EXPECT_EQ(entryPoint->parameters[0].valueClass, rfk::ENativeValueClass::Integral);
+	EXPECT_EQ(entryPoint->parameters[0].size, sizeof(int));
+}
+
+//=========================================================
+//============= Function::tryCheckedInvoke ================
+//=========================================================
+
+TEST(Rfk_Function_tryCheckedInvoke, SuccessfullCall)
+{
+	rfk::Result<int> result = rfk::getDatabase().getFileLevelFunctionByName("func_return_singleParam")->tryCheckedInvoke<int>(42);
+
+	EXPECT_TRUE(result.isSuccess());
+	EXPECT_EQ(result.getValue(), 42);
+	EXPECT_TRUE(rfk::getDatabase().getFileLevelFunctionByName("func_noParam")->tryCheckedInvoke<void>().isSuccess());
+}
+
+TEST(Rfk_Function_tryCheckedInvoke, SignatureMismatch)
+{
+	EXPECT_EQ(rfk::getDatabase().getFileLevelFunctionByName("func_return_singleParam")->tryCheckedInvoke(42).getCode(), rfk::EResultCode::ReturnTypeMismatch);
+	EXPECT_EQ(rfk::getDatabase().getFileLevelFunctionByName("func_singleParam")->tryCheckedInvoke<void>(1, 2).getCode(), rfk::EResultCode::ArgCountMismatch);
+	EXPECT_EQ(rfk::getDatabase().getFileLevelFunctionByName("func_singleParam")->tryCheckedInvoke<void>(1.0f).getCode(), rfk::EResultCode::ArgTypeMismatch);
 }
\ No newline at end of file
@@ -42,6 +42,12 @@ class CLASS() TestMethodClass : public rfk::Object
 	METHOD()
 	void					constNoReturnNoParam() const;
 
+	METHOD()
+	void					constIncrementParam(int& param) const;
+
+	METHOD()
+	void					constIncrementPointee(int* pointee) const;
+
 	TestMethodClass_GENERATED 
 };
 
@@ -0,0 +1,55 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Refureku library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "TestEnum.h"
+#include "NonReflectedClass.h"
+
+#include "Generated/TestSerialization.rfkh.h"
+
+struct STRUCT() TestSerializationVector
+{
+	FIELD()
+	float	x = 0.0f;
+
+	FIELD()
+	float	y = 0.0f;
+
+	TestSerializationVector_GENERATED
+};
+
+struct STRUCT() TestSerializationStruct
+{
+	FIELD()
+	int							intField		= 0;
+
+	FIELD()
+	TestEnumClass				enumField		= TestEnumClass::Value1;
+
+	FIELD()
+	double						doubleArray[2]	= { 0.0, 0.0 };
+
+	FIELD()
+	TestSerializationVector		position;
+
+	FIELD()
+	TestSerializationVector		path[2];
+
+	FIELD()
+	int const					constIntField	= 314;
+
+	FIELD()
+	int*						pointerField	= nullptr;
+
+	FIELD()
+	NonReflectedClass			nonReflectedField;
+
+	TestSerializationStruct_GENERATED
+};
+
+File_TestSerialization_GENERATED
@@ -149,4 +149,36 @@ TEST(Rfk_Instantiators, UnalignedClassUniqueInstantiation)
 	rfk::UniquePtr<VirtualClass2> ptr = rfk::getDatabase().getFileLevelClassByName("MultipleInheritanceInstantiator")->makeUniqueInstance<VirtualClass2>();
 
 	EXPECT_EQ(ptr->method22(), 3);
-}
\ No newline at end of file
+}
+
+TEST(Rfk_Instantiators, TryMakeUniqueInstance)
+{
+	rfk::Struct const* archetype = rfk::getDatabase().getFileLevelClassByName("TestUniqueInstantiatorNotDefaultCtor");
+
+	rfk::Result<rfk::UniquePtr<TestInstantiatorBase>> result = archetype->tryMakeUniqueInstance<TestInstantiatorBase>(10);
+
+	ASSERT_TRUE(result.isSuccess());
+	EXPECT_EQ(result.getValue()->value, 10);
+	EXPECT_EQ(archetype->tryMakeUniqueInstance<TestInstantiatorBase>().getCode(), rfk::EResultCode::NoMatchingInstantiator);
+}
+
+struct NullInstantiated {};
+
+static rfk::UniquePtr<NullInstantiated> nullUniqueInstantiator()
+{
+	return nullptr;
+}
+
+TEST(Rfk_Instantiators, TryMakeInstanceInstantiatorReturnedNull)
+{
+	rfk::Struct archetype("NullInstantiated", 0xC0C0, sizeof(NullInstantiated), false);
+	rfk::NonMemberFunction<rfk::UniquePtr<NullInstantiated>()> callable(&nullUniqueInstantiator);
+	rfk::StaticMethod instantiator("", 0u, rfk::getType<rfk::UniquePtr<NullInstantiated>>(), callable, rfk::EMethodFlags::Default, nullptr);
+
+	archetype.addUniqueInstantiator(instantiator);
+
+	EXPECT_EQ(archetype.tryMakeUniqueInstance<NullInstantiated>().getCode(), rfk::EResultCode::InstantiatorReturnedNull);
+	EXPECT_EQ(archetype.tryMakeSharedInstance<NullInstantiated>().getCode(), rfk::EResultCode::InstantiatorReturnedNull);
+	EXPECT_EQ(archetype.tryMakeUniqueInstance<NullInstantiated>(1).getCode(), rfk::EResultCode::NoMatchingInstantiator);
+	EXPECT_EQ(archetype.tryMakeSharedInstance<NullInstantiated>(1).getCode(), rfk::EResultCode::NoMatchingInstantiator);
+}
@@ -0,0 +1,156 @@
+#include <string>
+#include <stdexcept>	//std::logic_error, std::runtime_error
+#include <utility>		//std::swap
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+
+#include "TestFunctions.h"
+#include "TestMethods.h"
+#include "TestStaticMethods.h"
+
+//=========================================================
+//========= InvocationCommandBuffer::record ===============
+//=========================================================
+
+TEST(Rfk_InvocationCommandBuffer_record, FailWhenFull)
+{
+	rfk::InvocationCommandBuffer	buffer(rfk::InvocationCommandBuffer::getCommandSize<int>() * 2u);
+	rfk::Function const*			function = rfk::getDatabase().getFileLevelFunctionByName("func_singleParam");
+
+	EXPECT_TRUE(buffer.record(*function, 1));
+	EXPECT_TRUE(buffer.record(*function, 2));
+	EXPECT_FALSE(buffer.record(*function, 3));
+	EXPECT_EQ(buffer.getCommandsCount(), 2u);
+	EXPECT_EQ(buffer.getUsedSize(), buffer.getCapacity());
+}
+
+TEST(Rfk_InvocationCommandBuffer_record, CommandSizeDependsOnArguments)
+{
+	EXPECT_LT(rfk::InvocationCommandBuffer::getCommandSize<>(), rfk::InvocationCommandBuffer::getCommandSize<std::string>());
+	EXPECT_EQ(rfk::InvocationCommandBuffer::getCommandSize<int const&>(), rfk::InvocationCommandBuffer::getCommandSize<int>());
+}
+
+struct ThrowingCopyArgument
+{
+	static inline int	aliveCount	= 0;
+
+	bool				throwOnCopy	= false;
+
+	ThrowingCopyArgument(bool shouldThrowOnCopy = false):
+		throwOnCopy{shouldThrowOnCopy}
+	{
+		aliveCount++;
+	}
+
+	ThrowingCopyArgument(ThrowingCopyArgument const& other):
+		throwOnCopy{other.throwOnCopy}
+	{
+		if (throwOnCopy)
+		{
+			throw std::runtime_error("Copy failed");
+		}
+
+		aliveCount++;
+	}
+
+	~ThrowingCopyArgument()
+	{
+		aliveCount--;
+	}
+};
+
+static void takeThrowingCopyArguments(ThrowingCopyArgument const&, ThrowingCopyArgument) {}
+
+TEST(Rfk_InvocationCommandBuffer_record, DestroyCopiedArgumentsOnThrow)
+{
+	rfk::NonMemberFunction<void(ThrowingCopyArgument const&, ThrowingCopyArgument)>	callable(&takeThrowingCopyArguments);
+	rfk::Function																	function("takeThrowingCopyArguments", 0xC0C1, rfk::getType<void>(), callable, rfk::EFunctionFlags::Default);
+
+	function.addParameter("first", 0u, rfk::getType<ThrowingCopyArgument const&>());
+	function.addParameter("second", 0u, rfk::getType<ThrowingCopyArgument>());
+	function.setErasedCallThunk(&rfk::internal::ErasedCallThunkHelper<&takeThrowingCopyArguments>::invoke);
+
+	rfk::InvocationCommandBuffer	buffer(1024u);
+	ThrowingCopyArgument			argument;
+	ThrowingCopyArgument			throwingArgument(true);
+
+	//The first argument copy must be destroyed when copying the second one throws
+	EXPECT_THROW(buffer.record(function, argument, throwingArgument), std::runtime_error);
+	EXPECT_EQ(ThrowingCopyArgument::aliveCount, 2);
+	EXPECT_EQ(buffer.getCommandsCount(), 0u);
+	EXPECT_EQ(buffer.getUsedSize(), 0u);
+
+	EXPECT_TRUE(buffer.record(function, argument, argument));
+	EXPECT_EQ(buffer.execute(), 1u);
+	EXPECT_EQ(ThrowingCopyArgument::aliveCount, 2);
+}
+
+//=========================================================
+//========= InvocationCommandBuffer::execute ==============
+//=========================================================
+
+TEST(Rfk_InvocationCommandBuffer_execute, ExecuteInRecordingOrder)
+{
+	TestMethodClass					instance;
+	rfk::BoundMethod				boundMethod(instance, *TestMethodClass::staticGetArchetype().getMethodByName("constIncrementPointee"));
+	rfk::InvocationCommandBuffer	buffer(1024u);
+	int								value = 0;
+
+	EXPECT_TRUE(buffer.record(boundMethod, &value));
+	EXPECT_TRUE(buffer.record(boundMethod, &value));
+	EXPECT_TRUE(buffer.record(*rfk::getDatabase().getFileLevelFunctionByName("func_singleParam"), 42));
+	EXPECT_EQ(value, 0);
+
+	EXPECT_EQ(buffer.execute(), 3u);
+	EXPECT_EQ(value, 2);
+	EXPECT_EQ(buffer.getCommandsCount(), 0u);
+	EXPECT_EQ(buffer.getUsedSize(), 0u);
+}
+
+TEST(Rfk_InvocationCommandBuffer_execute, ArgumentsAreCopied)
+{
+	TestMethodClass					instance;
+	rfk::InvocationCommandBuffer	buffer(1024u);
+	int								value = 0;
+
+	//The reference parameter is bound to the copy stored in the buffer
+	EXPECT_TRUE(buffer.record(rfk::BoundMethod(instance, *TestMethodClass::staticGetArchetype().getMethodByName("constIncrementParam")), value));
+	EXPECT_EQ(buffer.execute(), 1u);
+	EXPECT_EQ(value, 0);
+}
+
+TEST(Rfk_InvocationCommandBuffer_execute, KeepRemainingCommandsOnThrow)
+{
+	TestMethodClass					instance;
+	rfk::InvocationCommandBuffer	buffer(1024u);
+	int								value = 0;
+
+	EXPECT_TRUE(buffer.record(*TestStaticMethodClass::staticGetArchetype().getStaticMethodByName("throwing")));
+	EXPECT_TRUE(buffer.record(rfk::BoundMethod(instance, *TestMethodClass::staticGetArchetype().getMethodByName("constIncrementPointee")), &value));
+
+	EXPECT_THROW(buffer.execute(), std::logic_error);
+	EXPECT_EQ(buffer.getCommandsCount(), 2u);
+
+	buffer.clear();
+	EXPECT_EQ(buffer.getCommandsCount(), 0u);
+	EXPECT_EQ(buffer.execute(), 0u);
+	EXPECT_EQ(value, 0);
+}
+
+TEST(Rfk_InvocationCommandBuffer_execute, SwapBuffers)
+{
+	TestMethodClass					instance;
+	rfk::BoundMethod				boundMethod(instance, *TestMethodClass::staticGetArchetype().getMethodByName("constIncrementPointee"));
+	rfk::InvocationCommandBuffer	producerBuffer(256u);
+	rfk::InvocationCommandBuffer	consumerBuffer(256u);
+	int								value = 0;
+
+	EXPECT_TRUE(producerBuffer.record(boundMethod, &value));
+
+	std::swap(producerBuffer, consumerBuffer);
+
+	EXPECT_EQ(producerBuffer.getCommandsCount(), 0u);
+	EXPECT_EQ(consumerBuffer.execute(), 1u);
+	EXPECT_EQ(value, 1);
+}
@@ -0,0 +1,128 @@
+#include <memory>	//std::unique_ptr
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+
+//=========================================================
+//=========== MetadataArena::reserveEntities ==============
+//=========================================================
+
+TEST(Rfk_MetadataArena_reserveEntities, SingleChunk)
+{
+	rfk::Type const& intType = rfk::getType<int>();
+
+	rfk::MetadataArena arena;
+	arena.reserveEntities(rfk::EEntityKind::Struct, 2u);
+	arena.reserveEntities(rfk::EEntityKind::Field, 1u);
+
+	rfk::MetadataArenaScope scope(arena);
+	rfk::Struct a("ArenaStructA", 0xA0A0, 4u, false);
+	rfk::Struct b("ArenaStructB", 0xA0A1, 4u, false);
+	a.addField("field", 0xA0A2, intType, rfk::EFieldFlags::Public, 0u, &a);
+	scope.close();
+
+	rfk::MetadataAllocationStatistics statistics = arena.getStatistics();
+
+	EXPECT_EQ(statistics.arenaAllocationsCount, 3u);
+	EXPECT_EQ(statistics.liveAllocationsCount, 3u);
+	EXPECT_EQ(statistics.chunksCount, 1u);
+	EXPECT_EQ(statistics.usedBytes, statistics.reservedBytes);
+	EXPECT_NE(a.getFieldByName("field"), nullptr);
+}
+
+//=========================================================
+//================= MetadataArenaScope ====================
+//=========================================================
+
+TEST(Rfk_MetadataArenaScope, HeapAllocationOutsideScope)
+{
+	std::size_t heapAllocationsCount = rfk::MetadataArena::getGlobalStatistics().heapAllocationsCount;
+
+	rfk::MetadataArena arena;
+
+	{
+		rfk::MetadataArenaScope scope(arena);
+	}
+
+	rfk::Struct s("HeapStruct", 0xA0A3, 4u, false);
+
+	EXPECT_EQ(arena.getStatistics().arenaAllocationsCount, 0u);
+	EXPECT_EQ(rfk::MetadataArena::getGlobalStatistics().heapAllocationsCount, heapAllocationsCount + 1u);
+}
+
+TEST(Rfk_MetadataArenaScope, NestedScopes)
+{
+	rfk::MetadataArena outerArena;
+	rfk::MetadataArenaScope outerScope(outerArena);
+
+	{
+		rfk::MetadataArena innerArena;
+		rfk::MetadataArenaScope innerScope(innerArena);
+		rfk::Struct inner("InnerArenaStruct", 0xA0A4, 4u, false);
+
+		EXPECT_EQ(innerArena.getStatistics().liveAllocationsCount, 1u);
+	}
+
+	rfk::Struct outer("OuterArenaStruct", 0xA0A5, 4u, false);
+
+	EXPECT_EQ(outerArena.getStatistics().liveAllocationsCount, 1u);
+}
+
+TEST(Rfk_MetadataArenaScope, HeapScope)
+{
+	struct ArenaScopeTypeTag {};
+
+	rfk::MetadataArena arena;
+	rfk::MetadataArenaScope scope(arena);
+
+	{
+		rfk::MetadataArenaScope heapScope(nullptr);
+		rfk::Struct s("HeapScopeStruct", 0xA0A8, 4u, false);
+	}
+
+	//Types are shared by all modules so they open a heap scope too
+	[[maybe_unused]] rfk::Type const& type = rfk::getType<ArenaScopeTypeTag const*>();
+
+	EXPECT_EQ(arena.getStatistics().arenaAllocationsCount, 0u);
+
+	rfk::Struct s("ArenaScopeStruct", 0xA0A9, 4u, false);
+
+	EXPECT_EQ(arena.getStatistics().arenaAllocationsCount, 1u);
+}
+
+//=========================================================
+//============ MetadataArena::~MetadataArena ==============
+//=========================================================
+
+TEST(Rfk_MetadataArena_destructor, ReleaseAllChunks)
+{
+	rfk::MetadataAllocationStatistics statistics = rfk::MetadataArena::getGlobalStatistics();
+
+	{
+		rfk::MetadataArena arena;
+		rfk::MetadataArenaScope scope(arena);
+		rfk::Struct s("ReleasedArenaStruct", 0xA0A6, 4u, false);
+	}
+
+	EXPECT_EQ(rfk::MetadataArena::getGlobalStatistics().chunksCount, statistics.chunksCount);
+	EXPECT_EQ(rfk::MetadataArena::getGlobalStatistics().liveAllocationsCount, statistics.liveAllocationsCount);
+}
+
+TEST(Rfk_MetadataArena_destructor, MetadataOutlivingArena)
+{
+	std::size_t chunksCount = rfk::MetadataArena::getGlobalStatistics().chunksCount;
+	std::unique_ptr<rfk::Struct> outliving;
+
+	{
+		rfk::MetadataArena arena;
+		rfk::MetadataArenaScope scope(arena);
+		outliving = std::make_unique<rfk::Struct>("OutlivingArenaStruct", 0xA0A7, 4u, false);
+	}
+
+	EXPECT_EQ(rfk::MetadataArena::getGlobalStatistics().chunksCount, chunksCount + 1u);
+	EXPECT_STREQ(outliving->getName(), "OutlivingArenaStruct");
+
+	outliving.reset();
+
+	EXPECT_EQ(rfk::MetadataArena::getGlobalStatistics().chunksCount, chunksCount);
+}
\ No newline at end of file
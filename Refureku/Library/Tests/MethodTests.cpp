@@ -483,4 +483,173 @@ TEST(Rfk_Method_checkedInvoke, ThrowingCall)
 	TestMethodClass instance;
 
 	EXPECT_THROW(TestMethodClass::staticGetArchetype().getMethodByName("throwing")->checkedInvoke(instance), std::logic_error);
-}
\ No newline at end of file
+}
+
+//=========================================================
+//========= Method::tryInvoke / tryCheckedInvoke ==========
+//=========================================================
+
+TEST(Rfk_Method_tryInvoke, SuccessfullCall)
+{
+	TestMethodClass instance;
+
+	rfk::Result<int> result = TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt")->tryInvoke<int>(instance, 42);
+
+	EXPECT_TRUE(result.isSuccess());
+	EXPECT_EQ(result.getValue(), 42);
+}
+
+TEST(Rfk_Method_tryInvoke, ConstViolation)
+{
+	TestMethodClass const instance;
+
+	EXPECT_EQ(TestMethodClass::staticGetArchetype().getMethodByName("noReturnNoParam")->tryInvoke(instance).getCode(), rfk::EResultCode::ConstViolation);
+	EXPECT_TRUE(TestMethodClass::staticGetArchetype().getMethodByName("constNoReturnNoParam")->tryInvoke(instance).isSuccess());
+}
+
+TEST(Rfk_Method_tryInvoke, InvalidArchetype)
+{
+	TestMethodClass2 instance;
+
+	EXPECT_EQ(TestMethodClass::staticGetArchetype().getMethodByName("virtualNoReturnNoParam")->tryInvoke(instance).getCode(), rfk::EResultCode::InvalidArchetype);
+}
+
+TEST(Rfk_Method_tryCheckedInvoke, SignatureMismatch)
+{
+	TestMethodClass instance;
+
+	EXPECT_EQ(TestMethodClass::staticGetArchetype().getMethodByName("returnIntNoParam")->tryCheckedInvoke<float>(instance).getCode(), rfk::EResultCode::ReturnTypeMismatch);
+	EXPECT_EQ(TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt")->tryCheckedInvoke<int>(instance, 1, 2).getCode(), rfk::EResultCode::ArgCountMismatch);
+	EXPECT_EQ(TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt")->tryCheckedInvoke<int>(instance, 1.0f).getCode(), rfk::EResultCode::ArgTypeMismatch);
+	EXPECT_EQ(TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt")->tryCheckedInvoke<int>(instance, 1).getValue(), 1);
+}
+
+//=========================================================
+//============= Method::getNativeEntryPoint ===============
+//=========================================================
+
+TEST(Rfk_Method_getNativeEntryPoint, CallTrampoline)
+{
+	TestMethodClass					instance;
+	rfk::NativeEntryPoint const*	entryPoint = TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt")->getNativeEntryPoint();
+
+	ASSERT_NE(entryPoint, nullptr);
+	EXPECT_TRUE(entryPoint->isMethodTrampoline);
+	ASSERT_EQ(entryPoint->parametersCount, 2u);
+	EXPECT_EQ(entryPoint->parameters[0].valueClass, rfk::ENativeValueClass::Pointer);
+	EXPECT_EQ(entryPoint->parameters[1].valueClass, rfk::ENativeValueClass::Integral);
+	EXPECT_EQ(reinterpret_cast<int (*)(TestMethodClass*, int)>(entryPoint->address)(&instance, 42), 42);
+}
+
+//=========================================================
+//================= Method::invokeBatch ===================
+//=========================================================
+
+TEST(Rfk_Method_invokeBatch, CallEachInstance)
+{
+	TestMethodClass instances[10];
+	int				counter = 0;
+
+	TestMethodClass::staticGetArchetype().getMethodByName("constIncrementParam")->invokeBatch<void, TestMethodClass, int&>(instances, 10u, counter);
+	EXPECT_EQ(counter, 10);
+}
+
+TEST(Rfk_Method_invokeBatch, EmptyBatch)
+{
+	int counter = 0;
+
+	TestMethodClass::staticGetArchetype().getMethodByName("constIncrementParam")->invokeBatch<void, TestMethodClass, int&>(nullptr, 0u, counter);
+	EXPECT_EQ(counter, 0);
+}
+
+TEST(Rfk_Method_invokeBatch, CallNonConstMethodOnConstInstances)
+{
+	TestMethodClass const	instances[10];
+	int						counter = 0;
+
+	EXPECT_THROW(TestMethodClass::staticGetArchetype().getMethodByName("noReturnNoParam")->invokeBatch(instances, 10u), rfk::ConstViolation);
+	EXPECT_NO_THROW((TestMethodClass::staticGetArchetype().getMethodByName("constIncrementParam")->invokeBatch<void, TestMethodClass const, int&>(instances, 10u, counter)));
+	EXPECT_EQ(counter, 10);
+}
+
+TEST(Rfk_Method_invokeBatch, StridedCallers)
+{
+	TestMethodClass instances[10];
+	int				counter = 0;
+
+	//Call every other instance
+	TestMethodClass::staticGetArchetype().getMethodByName("constIncrementParam")->invokeBatchUnsafe<void, int&>(instances, 5u, 2u * sizeof(TestMethodClass), counter);
+	EXPECT_EQ(counter, 5);
+}
+
+TEST(Rfk_Method_invokeBatch, ThrowingCall)
+{
+	TestMethodClass instances[10];
+
+	EXPECT_THROW(TestMethodClass::staticGetArchetype().getMethodByName("throwing")->invokeBatch(instances, 10u), std::logic_error);
+}
+
+TEST(Rfk_Method_checkedInvokeBatch, ThrowArgTypeMismatch)
+{
+	TestMethodClass instances[10];
+
+	EXPECT_THROW(TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt")->checkedInvokeBatch<int>(instances, 10u, 1.0f), rfk::ArgTypeMismatch);	//float instead of int
+	EXPECT_NO_THROW(TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt")->checkedInvokeBatch<int>(instances, 10u, 1));
+}
+
+TEST(Rfk_Method_invokeBatchParallel, CallEachInstance)
+{
+	TestMethodClass instances[10];
+	int				counter			= 0;
+	std::size_t		executedJobs	= 0u;
+
+	auto sequentialExecutor = [&executedJobs](std::size_t jobsCount, auto const& job)
+	{
+		for (std::size_t i = 0u; i < jobsCount; i++)
+		{
+			job(i);
+			executedJobs++;
+		}
+	};
+
+	TestMethodClass::staticGetArchetype().getMethodByName("constIncrementParam")->invokeBatchParallel<void>(sequentialExecutor, 3u, instances, 10u, counter);
+	EXPECT_EQ(counter, 10);
+	EXPECT_EQ(executedJobs, 4u);
+}
+
+//=========================================================
+//================= Method::invokeErased ==================
+//=========================================================
+
+TEST(Rfk_Method_invokeErased, SuccessfullCall)
+{
+	TestMethodClass instance;
+	int				arg		= 42;
+	void*			args[]	= { &arg };
+	int				result	= 0;
+
+	TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt")->invokeErased(instance, args, &result);
+	EXPECT_EQ(result, 42);
+}
+
+TEST(Rfk_Method_invokeErased, DiscardReturnValue)
+{
+	TestMethodClass instance;
+
+	EXPECT_NO_THROW(TestMethodClass::staticGetArchetype().getMethodByName("returnIntNoParam")->invokeErased(instance, nullptr));
+}
+
+TEST(Rfk_Method_invokeErased, CallNonConstMethodOnConstInstance)
+{
+	TestMethodClass const instance;
+
+	EXPECT_THROW(TestMethodClass::staticGetArchetype().getMethodByName("returnIntNoParam")->invokeErased(instance, nullptr), rfk::ConstViolation);
+	EXPECT_NO_THROW(TestMethodClass::staticGetArchetype().getMethodByName("constNoReturnNoParam")->invokeErased(instance, nullptr));
+}
+
+TEST(Rfk_Method_invokeErased, ThrowingCall)
+{
+	TestMethodClass instance;
+
+	EXPECT_THROW(TestMethodClass::staticGetArchetype().getMethodByName("throwing")->invokeErased(instance, nullptr), std::logic_error);
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <Refureku/Refureku.h>
+#include <Refureku/TypeInfo/Namespace/NamespaceFragment.h>
+#include <Refureku/TypeInfo/Namespace/NamespaceFragmentRegisterer.h>
 
 //=========================================================
 //============ Namespace::getNamespaceByName ==============
@@ -1008,4 +1010,56 @@ TEST(Rfk_Namespace_foreachFunction, ThrowingVisitor)
 	};
 
 	EXPECT_THROW(rfk::getDatabase().getNamespaceByName("test_namespace")->foreachFunction(visitor, nullptr), std::logic_error);
-}
\ No newline at end of file
+}
+
+//=========================================================
+//============ Namespace::reserveMembers ==================
+//=========================================================
+
+TEST(Rfk_Namespace_reserveMembers, MergedFragment)
+{
+	rfk::Struct const a("MergedA", 0xFAB0, 4u, false);
+	rfk::Struct const b("MergedB", 0xFAB1, 4u, false);
+	rfk::Struct const c("MergedC", 0xFAB3, 4u, false);
+	rfk::Struct const d("MergedD", 0xFAB4, 4u, false);
+
+	{
+		rfk::NamespaceFragment fragment("merged_namespace", 0xFAB2);
+		fragment.setNestedEntitiesCapacity(2u);
+		fragment.addNestedEntity(a);
+		fragment.addNestedEntity(b);
+
+		rfk::NamespaceFragmentRegisterer registerer(fragment);
+
+		rfk::Namespace const* np = rfk::getDatabase().getNamespaceByName("merged_namespace");
+
+		ASSERT_NE(np, nullptr);
+		EXPECT_EQ(np->getArchetypesCount(), 2u);
+		EXPECT_EQ(np->getStructByName("MergedA"), &a);
+		EXPECT_EQ(np->getStructByName("MergedB"), &b);
+
+		rfk::Namespace& mutableNp = const_cast<rfk::Namespace&>(*np);
+
+		//Reserving no more than the current members count must keep the members
+		mutableNp.reserveMembers(0u, 0u, 0u, 0u);
+
+		EXPECT_EQ(np->getArchetypesCount(), 2u);
+		EXPECT_EQ(np->getStructByName("MergedA"), &a);
+
+		//Reserve room for 2 more archetypes on top of the merged ones
+		mutableNp.reserveMembers(0u, 2u, 0u, 0u);
+		mutableNp.addArchetype(c);
+		mutableNp.addArchetype(d);
+
+		EXPECT_EQ(np->getArchetypesCount(), 4u);
+		EXPECT_EQ(np->getStructByName("MergedA"), &a);
+		EXPECT_EQ(np->getStructByName("MergedB"), &b);
+		EXPECT_EQ(np->getStructByName("MergedC"), &c);
+		EXPECT_EQ(np->getStructByName("MergedD"), &d);
+
+		mutableNp.removeArchetype(c);
+		mutableNp.removeArchetype(d);
+	}
+
+	EXPECT_EQ(rfk::getDatabase().getNamespaceByName("merged_namespace"), nullptr);
+}
@@ -0,0 +1,88 @@
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+#include <Refureku/Refureku.h>
+
+#include "TestFunctions.h"
+#include "TestMethods.h"
+#include "TestStaticMethods.h"
+
+//=========================================================
+//================ FunctionBase::prepare ==================
+//=========================================================
+
+TEST(Rfk_FunctionBase_prepare, ThrowSignatureMismatch)
+{
+	rfk::Function const* function = rfk::getDatabase().getFileLevelFunctionByName("func_return_singleParam");
+
+	EXPECT_THROW((void)function->prepare<void, int>(), rfk::ReturnTypeMismatch);
+	EXPECT_THROW((void)function->prepare<int>(), rfk::ArgCountMismatch);
+	EXPECT_THROW((void)function->prepare<int, float>(), rfk::ArgTypeMismatch);
+	EXPECT_NO_THROW((void)function->prepare<int, int>());
+}
+
+TEST(Rfk_FunctionBase_tryPrepare, SignatureMismatch)
+{
+	rfk::Function const* function = rfk::getDatabase().getFileLevelFunctionByName("func_return_singleParam");
+
+	EXPECT_EQ(function->tryPrepare<void, int>().getCode(), rfk::EResultCode::ReturnTypeMismatch);
+	EXPECT_EQ(function->tryPrepare<int>().getCode(), rfk::EResultCode::ArgCountMismatch);
+	EXPECT_EQ(function->tryPrepare<int, float>().getCode(), rfk::EResultCode::ArgTypeMismatch);
+	EXPECT_TRUE(function->tryPrepare<int, int>().isSuccess());
+}
+
+//=========================================================
+//==================== PreparedCall =======================
+//=========================================================
+
+TEST(Rfk_PreparedCall, DefaultConstructedIsInvalid)
+{
+	rfk::PreparedCall<void()> call;
+
+	EXPECT_FALSE(call.isValid());
+	EXPECT_EQ(call.getFunction(), nullptr);
+}
+
+TEST(Rfk_PreparedCall, CallFunction)
+{
+	rfk::Function const*		function	= rfk::getDatabase().getFileLevelFunctionByName("func_return_singleParam");
+	rfk::PreparedCall<int(int)>	call		= function->prepare<int, int>();
+
+	EXPECT_TRUE(call.isValid());
+	EXPECT_EQ(call.getFunction(), function);
+	EXPECT_EQ(call(42), 42);
+}
+
+TEST(Rfk_PreparedCall, CallStaticMethod)
+{
+	rfk::PreparedCall<int(int)> call = TestStaticMethodClass::staticGetArchetype().getStaticMethodByName("returnIntParamInt")->prepare<int, int>();
+
+	EXPECT_EQ(call(42), 42);
+}
+
+TEST(Rfk_PreparedCall, CallMethod)
+{
+	TestMethodClass				instance;
+	rfk::PreparedCall<int(int)>	call = TestMethodClass::staticGetArchetype().getMethodByName("returnIntParamInt")->prepare<int, int>();
+
+	EXPECT_EQ(call.invoke(instance, 42), 42);
+	EXPECT_EQ(call.invokeUnsafe(&instance, 21), 21);
+}
+
+TEST(Rfk_PreparedCall, CallNonConstMethodOnConstInstance)
+{
+	TestMethodClass const instance;
+
+	EXPECT_THROW(TestMethodClass::staticGetArchetype().getMethodByName("noReturnNoParam")->prepare<void>().invoke(instance), rfk::ConstViolation);
+	EXPECT_NO_THROW(TestMethodClass::staticGetArchetype().getMethodByName("constNoReturnNoParam")->prepare<void>().invoke(instance));
+}
+
+TEST(Rfk_PreparedCall, CacheByFunctionId)
+{
+	rfk::Function const*											function = rfk::getDatabase().getFileLevelFunctionByName("func_return_singleParam");
+	std::unordered_map<std::size_t, rfk::PreparedCall<int(int)>>	cache;
+
+	cache.emplace(function->getId(), function->prepare<int, int>());
+
+	EXPECT_EQ(cache.at(function->getId())(1), 1);
+}
@@ -44,6 +44,16 @@ void TestMethodClass::constNoReturnNoParam() const
 
 }
 
+void TestMethodClass::constIncrementParam(int& param) const
+{
+	param++;
+}
+
+void TestMethodClass::constIncrementPointee(int* pointee) const
+{
+	(*pointee)++;
+}
+
 
 //=====================
 
@@ -0,0 +1 @@
+#include "Generated/TestSerialization.rfks.h"
\ No newline at end of file
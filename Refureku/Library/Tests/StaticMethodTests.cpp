@@ -21,6 +21,25 @@ TEST(Rfk_StaticMethod_invoke, ThrowingCall)
 	EXPECT_THROW(TestStaticMethodClass::staticGetArchetype().getStaticMethodByName("throwing")->invoke(), std::logic_error);
 }
 
+//=========================================================
+//============= StaticMethod::invokeErased ================
+//=========================================================
+
+TEST(Rfk_StaticMethod_invokeErased, SuccessfullCall)
+{
+	int		arg		= 42;
+	void*	args[]	= { &arg };
+	int		result	= 0;
+
+	TestStaticMethodClass::staticGetArchetype().getStaticMethodByName("returnIntParamInt")->invokeErased(args, &result);
+	EXPECT_EQ(result, 42);
+}
+
+TEST(Rfk_StaticMethod_invokeErased, ThrowingCall)
+{
+	EXPECT_THROW(TestStaticMethodClass::staticGetArchetype().getStaticMethodByName("throwing")->invokeErased(nullptr), std::logic_error);
+}
+
 //=========================================================
 //============= StaticMethod::checkedInvoke ===============
 //=========================================================
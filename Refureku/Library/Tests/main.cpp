@@ -14,6 +14,9 @@ __RFK_DISABLE_WARNING_UNUSED_RESULT
 #include "FunctionTests.cpp"
 #include "MethodBaseTests.cpp"
 #include "MethodTests.cpp"
+#include "BoundMethodTests.cpp"
+#include "PreparedCallTests.cpp"
+#include "InvocationCommandBufferTests.cpp"
 #include "CastTests.cpp"
 #include "StaticMethodTests.cpp"
 #include "FieldBaseTests.cpp"
@@ -26,6 +29,8 @@ __RFK_DISABLE_WARNING_UNUSED_RESULT
 #include "PropertyInheritanceTests.cpp"
 #include "EntityCastTests.cpp"
 #include "DatabaseTests.cpp"
+#include "MetadataArenaTests.cpp"
+#include "BinarySerializationTests.cpp"
 #include "ManualReflectionTests.cpp"
 #include "InstantiatorTests.cpp"
 #include "NestedClassTests.cpp"